@@ -23,6 +23,22 @@ void ExecutionContext::setResult(const std::string& name, Result&& result) {
     hist.emplace_back(std::move(result));
 }
 
+std::unordered_map<std::string, Value> ExecutionContext::latestValues() const {
+    std::unordered_map<std::string, Value> values;
+    for (auto& kv : valueMap_) {
+        if (!kv.second.empty()) {
+            values.emplace(kv.first, kv.second.back().value());
+        }
+    }
+    return values;
+}
+
+void ExecutionContext::clear() {
+    for (auto& kv : valueMap_) {
+        kv.second.clear();
+    }
+}
+
 void ExecutionContext::deleteValue(const std::string& name) {
     valueMap_.erase(name);
 }
@@ -67,10 +67,18 @@ public:
     // Only keep the last several versoins of the Value
     void truncHistory(const std::string& name, size_t numVersionsToKeep);
 
+    // Drop the values of all the variables, but keep the variables and the
+    // capacity of their histories for the next execution
+    void clear();
+
     bool exist(const std::string& name) const {
         return valueMap_.find(name) != valueMap_.end();
     }
 
+    // The latest values of all the variables, e.g. the constant inputs the
+    // validators set before the execution
+    std::unordered_map<std::string, Value> latestValues() const;
+
 private:
     friend class QueryInstance;
     Value moveValue(const std::string& name);
@@ -0,0 +1,58 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "context/IndexStats.h"
+
+namespace nebula {
+namespace graph {
+
+// The latest lookups weigh more, it's the plain average of the first ones
+static constexpr int64_t kWindow = 16;
+
+// static
+IndexStats& IndexStats::instance() {
+    static IndexStats stats;
+    return stats;
+}
+
+// static
+std::string IndexStats::shape(const storage::cpp2::IndexQueryContext& ctx) {
+    auto shape = folly::to<std::string>(ctx.get_index_id());
+    for (auto& hint : ctx.get_column_hints()) {
+        shape += hint.get_scan_type() == storage::cpp2::ScanType::PREFIX ? ":=" : ":~";
+        shape += hint.get_column_name();
+    }
+    return shape;
+}
+
+void IndexStats::add(GraphSpaceID space,
+                     const storage::cpp2::IndexQueryContext& ctx,
+                     int64_t rows) {
+    auto key = folly::to<std::string>(space, "/", shape(ctx));
+    folly::SpinLockGuard g(lock_);
+    auto& entry = entries_[key];
+    entry.lookups = std::min(entry.lookups + 1, kWindow);
+    entry.rows += (rows - entry.rows) / entry.lookups;
+}
+
+folly::Optional<double> IndexStats::estimate(GraphSpaceID space,
+                                             const storage::cpp2::IndexQueryContext& ctx) const {
+    auto key = folly::to<std::string>(space, "/", shape(ctx));
+    folly::SpinLockGuard g(lock_);
+    auto found = entries_.find(key);
+    if (found == entries_.end()) {
+        return folly::none;
+    }
+    return found->second.rows;
+}
+
+void IndexStats::clear() {
+    folly::SpinLockGuard g(lock_);
+    entries_.clear();
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,60 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef CONTEXT_INDEXSTATS_H_
+#define CONTEXT_INDEXSTATS_H_
+
+#include <folly/Optional.h>
+#include <folly/SpinLock.h>
+
+#include "common/base/Base.h"
+#include "common/interface/gen-cpp2/storage_types.h"
+#include "common/thrift/ThriftTypes.h"
+
+namespace nebula {
+namespace graph {
+
+/***************************************************************************
+ *
+ * Process-wide statistics of the index lookups, the moving average of the
+ * rows returned by the lookups of an index with the same column hints, i.e.
+ * the same columns and scan types regardless of the values.
+ *
+ * They are the selectivity estimates of the optimizer, which picks the index
+ * reading the least rows. The meta service keeps no statistics of the index,
+ * so they are collected from the lookups through this graphd.
+ *
+ **************************************************************************/
+class IndexStats final {
+public:
+    static IndexStats& instance();
+
+    // The key of the lookups of the same index and column hints
+    static std::string shape(const storage::cpp2::IndexQueryContext& ctx);
+
+    void add(GraphSpaceID space, const storage::cpp2::IndexQueryContext& ctx, int64_t rows);
+
+    // None if the index was never looked up with the same column hints
+    folly::Optional<double> estimate(GraphSpaceID space,
+                                     const storage::cpp2::IndexQueryContext& ctx) const;
+
+    void clear();
+
+private:
+    IndexStats() = default;
+
+    struct Entry {
+        double      rows{0.0};
+        int64_t     lookups{0};
+    };
+
+    mutable folly::SpinLock                             lock_;
+    std::unordered_map<std::string, Entry>              entries_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+#endif   // CONTEXT_INDEXSTATS_H_
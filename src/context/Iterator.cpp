@@ -48,14 +48,16 @@ namespace nebula {
 namespace graph {
 
 GetNeighborsIter::GetNeighborsIter(std::shared_ptr<Value> value)
-    : Iterator(value, Kind::kGetNeighbors) {
+    : Iterator(value, Kind::kGetNeighbors),
+      logicalRows_(std::make_shared<RowsType<GetNbrLogicalRow>>()),
+      dsIndices_(std::make_shared<std::vector<DataSetIndex>>()) {
     auto status = processList(value);
     if (UNLIKELY(!status.ok())) {
         LOG(ERROR) << status;
         clear();
         return;
     }
-    iter_ = logicalRows_.begin();
+    iter_ = logicalRows_->begin();
     valid_ = true;
 }
 
@@ -72,7 +74,7 @@ Status GetNeighborsIter::processList(std::shared_ptr<Value> value) {
         }
         auto status = makeDataSetIndex(val.getDataSet(), idx++);
         NG_RETURN_IF_ERROR(status);
-        dsIndices_.emplace_back(std::move(status).value());
+        dsIndices_->emplace_back(std::move(status).value());
     }
     return Status::OK();
 }
@@ -86,7 +88,7 @@ StatusOr<GetNeighborsIter::DataSetIndex> GetNeighborsIter::makeDataSetIndex(cons
     int64_t edgeStartIndex = std::move(buildResult).value();
     if (edgeStartIndex < 0) {
         for (auto& row : dsIndex.ds->rows) {
-            logicalRows_.emplace_back(GetNbrLogicalRow{idx, &row, "", nullptr});
+            logicalRows_->emplace_back(GetNbrLogicalRow{idx, &row, "", nullptr});
         }
     } else {
         makeLogicalRowByEdge(edgeStartIndex, idx, dsIndex);
@@ -111,7 +113,7 @@ void GetNeighborsIter::makeLogicalRowByEdge(int64_t edgeStartIndex,
                 }
                 auto edgeName = dsIndex.tagEdgeNameIndices.find(column);
                 DCHECK(edgeName != dsIndex.tagEdgeNameIndices.end());
-                logicalRows_.emplace_back(
+                logicalRows_->emplace_back(
                     GetNbrLogicalRow{idx, &row, edgeName->second, &edge.getList()});
             }
         }
@@ -189,7 +191,7 @@ const Value& GetNeighborsIter::getColumn(const std::string& col) const {
         return Value::kNullValue;
     }
     auto segment = currentSeg();
-    auto& index = dsIndices_[segment].colIndices;
+    auto& index = (*dsIndices_)[segment].colIndices;
     auto found = index.find(col);
     if (found == index.end()) {
         return Value::kEmpty;
@@ -204,7 +206,7 @@ const Value& GetNeighborsIter::getTagProp(const std::string& tag,
     }
 
     auto segment = currentSeg();
-    auto &tagPropIndices = dsIndices_[segment].tagPropsMap;
+    auto &tagPropIndices = (*dsIndices_)[segment].tagPropsMap;
     auto index = tagPropIndices.find(tag);
     if (index == tagPropIndices.end()) {
         return Value::kEmpty;
@@ -229,15 +231,15 @@ const Value& GetNeighborsIter::getEdgeProp(const std::string& edge,
         return Value::kNullValue;
     }
 
-    auto currentEdge = currentEdgeName();
+    const auto& currentEdge = currentEdgeName();
     if (edge != "*" &&
             (currentEdge.compare(1, std::string::npos, edge) != 0)) {
         VLOG(1) << "Current edge: " << currentEdgeName() << " Wanted: " << edge;
         return Value::kEmpty;
     }
     auto segment = currentSeg();
-    auto index = dsIndices_[segment].edgePropsMap.find(currentEdge);
-    if (index == dsIndices_[segment].edgePropsMap.end()) {
+    auto index = (*dsIndices_)[segment].edgePropsMap.find(currentEdge);
+    if (index == (*dsIndices_)[segment].edgePropsMap.end()) {
         VLOG(1) << "No edge found: " << edge;
         VLOG(1) << "Current edge: " << currentEdge;
         return Value::kEmpty;
@@ -263,7 +265,7 @@ Value GetNeighborsIter::getVertex() const {
     }
     Vertex vertex;
     vertex.vid = vidVal.getStr();
-    auto& tagPropMap = dsIndices_[segment].tagPropsMap;
+    auto& tagPropMap = (*dsIndices_)[segment].tagPropsMap;
     for (auto& tagProp : tagPropMap) {
         auto& row = *(iter_->row_);
         auto& tagPropNameList = tagProp.second.propList;
@@ -319,7 +321,7 @@ Value GetNeighborsIter::getEdge() const {
     }
     edge.ranking = rank.getInt();
 
-    auto& edgePropMap = dsIndices_[segment].edgePropsMap;
+    auto& edgePropMap = (*dsIndices_)[segment].edgePropsMap;
     auto edgeProp = edgePropMap.find(currentEdgeName());
     if (edgeProp == edgePropMap.end()) {
         return Value::kNullValue;
@@ -338,6 +340,8 @@ Value GetNeighborsIter::getEdge() const {
     return Value(std::move(edge));
 }
 
+constexpr size_t JoinIter::SegmentArena::kChunkSize;
+
 void JoinIter::joinIndex(const Iterator* lhs, const Iterator* rhs) {
     size_t nextSeg = 0;
     if (lhs->isSequentialIter()) {
@@ -347,44 +351,88 @@ void JoinIter::joinIndex(const Iterator* lhs, const Iterator* rhs) {
     }
 
     if (rhs->isSequentialIter()) {
-        buildIndexFromSeqIter(static_cast<const SequentialIter*>(rhs), nextSeg);
+        nextSeg = buildIndexFromSeqIter(static_cast<const SequentialIter*>(rhs), nextSeg);
     } else if (rhs->isJoinIter()) {
-        buildIndexFromJoinIter(static_cast<const JoinIter*>(rhs), nextSeg);
+        nextSeg = buildIndexFromJoinIter(static_cast<const JoinIter*>(rhs), nextSeg);
     }
+    segsNum_ = nextSeg;
 }
 
 size_t JoinIter::buildIndexFromSeqIter(const SequentialIter* iter,
                                        size_t segIdx) {
-    auto colIdxStart = colIndices_.size();
-    for (auto& col : iter->getColIndices()) {
-        colIndices_.emplace(col.first, std::make_pair(segIdx, col.second));
-        colIdxIndices_.emplace(col.second + colIdxStart,
-                               std::make_pair(segIdx, col.second));
+    auto colIdxStart = colIdxIndices_->size();
+    auto& colIndices = iter->getColIndices();
+    // The columns not found are pointed to an invalid segment
+    colIdxIndices_->resize(colIdxStart + colIndices.size(),
+                           std::make_pair(std::numeric_limits<size_t>::max(), 0));
+    for (auto& col : colIndices) {
+        colIndices_->emplace(col.first, std::make_pair(segIdx, col.second));
+        (*colIdxIndices_)[col.second + colIdxStart] = std::make_pair(segIdx, col.second);
     }
     return segIdx + 1;
 }
 
 size_t JoinIter::buildIndexFromJoinIter(const JoinIter* iter, size_t segIdx) {
-    auto colIdxStart = colIndices_.size();
-    size_t nextSeg = 0;
+    // The segments of the joined rows are flattened, so just shift them
+    auto colIdxStart = colIdxIndices_->size();
     for (auto& col : iter->getColIndices()) {
-        auto oldSeg = col.second.first;
-        size_t newSeg = oldSeg + segIdx;
-        if (newSeg > nextSeg) {
-            nextSeg = newSeg;
+        colIndices_->emplace(col.first,
+                             std::make_pair(col.second.first + segIdx, col.second.second));
+    }
+    auto& colIdxIndices = iter->getColIdxIndices();
+    colIdxIndices_->resize(colIdxStart + colIdxIndices.size());
+    for (size_t i = 0; i < colIdxIndices.size(); ++i) {
+        auto& index = colIdxIndices[i];
+        (*colIdxIndices_)[colIdxStart + i] =
+            index.first < iter->segsNum()
+                ? std::make_pair(index.first + segIdx, index.second)
+                : index;
+    }
+    return segIdx + iter->segsNum();
+}
+
+size_t JoinIter::copySegments(const LogicalRow* row, const Row** dst) {
+    switch (row->kind()) {
+        case LogicalRow::Kind::kSequential: {
+            *dst = static_cast<const SequentialIter::SeqLogicalRow*>(row)->row_;
+            return 1;
+        }
+        case LogicalRow::Kind::kJoin: {
+            auto* joinRow = static_cast<const JoinLogicalRow*>(row);
+            std::copy(joinRow->segs_, joinRow->segs_ + joinRow->segsNum_, dst);
+            return joinRow->segsNum_;
+        }
+        default: {
+            auto segs = row->segments();
+            std::copy(segs.begin(), segs.end(), dst);
+            return segs.size();
         }
-        colIndices_.emplace(col.first,
-                            std::make_pair(newSeg, col.second.second));
-    }
-    for (auto& col : iter->getColIdxIndices()) {
-        colIdxIndices_.emplace(
-            col.first + colIdxStart,
-            std::make_pair(col.second.first + segIdx, col.second.second));
     }
-    return nextSeg + 1;
 }
 
-PropIter::PropIter(std::shared_ptr<Value> value) : Iterator(value, Kind::kProp) {
+void JoinIter::addRow(const LogicalRow* lhs, const LogicalRow* rhs) {
+    detach(rows_, iter_);
+    auto* segs = arena_->allocate(segsNum_);
+    auto num = copySegments(lhs, segs);
+    num += copySegments(rhs, segs + num);
+    DCHECK_EQ(num, segsNum_);
+    rows_->emplace_back(segs, num, lhs->size() + rhs->size(), colIdxIndices_.get());
+    iter_ = rows_->begin();
+}
+
+void JoinIter::addRow(std::initializer_list<const Row*> segs, size_t size) {
+    DCHECK_EQ(segs.size(), segsNum_);
+    detach(rows_, iter_);
+    auto* dst = arena_->allocate(segs.size());
+    std::copy(segs.begin(), segs.end(), dst);
+    rows_->emplace_back(dst, segs.size(), size, colIdxIndices_.get());
+    iter_ = rows_->begin();
+}
+
+PropIter::PropIter(std::shared_ptr<Value> value)
+    : Iterator(value, Kind::kProp),
+      rows_(std::make_shared<RowsType<PropLogicalRow>>()),
+      dsIndex_(std::make_shared<DataSetIndex>()) {
     DCHECK(value->isDataSet());
     auto& ds = value->getDataSet();
     auto status = makeDataSetIndex(ds);
@@ -393,17 +441,18 @@ PropIter::PropIter(std::shared_ptr<Value> value) : Iterator(value, Kind::kProp)
         clear();
         return;
     }
+    rows_->reserve(ds.rows.size());
     for (auto& row : ds.rows) {
-        rows_.emplace_back(&row);
+        rows_->emplace_back(&row);
     }
-    iter_ = rows_.begin();
+    iter_ = rows_->begin();
 }
 
 Status PropIter::makeDataSetIndex(const DataSet& ds) {
-    dsIndex_.ds = &ds;
+    dsIndex_->ds = &ds;
     auto& colNames = ds.colNames;
     for (size_t i = 0; i < colNames.size(); ++i) {
-        dsIndex_.colIndices.emplace(colNames[i], i);
+        dsIndex_->colIndices.emplace(colNames[i], i);
         auto& colName = colNames[i];
         if (colName.find(".") != std::string::npos) {
             NG_RETURN_IF_ERROR(buildPropIndex(colName, i));
@@ -419,7 +468,7 @@ Status PropIter::buildPropIndex(const std::string& props, size_t columnId) {
         return Status::Error("Bad column name format: %s", props.c_str());
     }
     std::string name = pieces[0];
-    auto& propsMap = dsIndex_.propsMap;
+    auto& propsMap = dsIndex_->propsMap;
     if (propsMap.find(name) != propsMap.end()) {
         propsMap[name].emplace(pieces[1], columnId);
     } else {
@@ -436,8 +485,8 @@ const Value& PropIter::getColumn(const std::string& col) const {
     }
 
     auto& logicalRow = *iter_;
-    auto index = dsIndex_.colIndices.find(col);
-    if (index == dsIndex_.colIndices.end()) {
+    auto index = dsIndex_->colIndices.find(col);
+    if (index == dsIndex_->colIndices.end()) {
         return Value::kNullValue;
     }
     DCHECK_LT(index->second, logicalRow.row_->values.size());
@@ -449,7 +498,7 @@ const Value& PropIter::getProp(const std::string& name, const std::string& prop)
         return Value::kNullValue;
     }
     auto& row = *(iter_->row_);
-    auto& propsMap = dsIndex_.propsMap;
+    auto& propsMap = dsIndex_->propsMap;
     auto index = propsMap.find(name);
     if (index == propsMap.end()) {
         return Value::kEmpty;
@@ -476,7 +525,7 @@ Value PropIter::getVertex() const {
     }
     Vertex vertex;
     vertex.vid = vidVal.getStr();
-    auto& tagPropsMap = dsIndex_.propsMap;
+    auto& tagPropsMap = dsIndex_->propsMap;
     bool isVertexProps = true;
     auto& row = *(iter_->row_);
     for (auto& tagProp : tagPropsMap) {
@@ -506,9 +555,9 @@ Value PropIter::getEdge() const {
         return Value::kNullValue;
     }
     Edge edge;
-    auto& edgePropsMap = dsIndex_.propsMap;
+    auto& edgePropsMap = dsIndex_->propsMap;
     bool isEdgeProps = true;
-    auto row = *(iter_->row_);
+    auto& row = *(iter_->row_);
     for (auto& edgeProp : edgePropsMap) {
         for (auto& propIndex : edgeProp.second) {
             if (row[propIndex.second].empty()) {
@@ -561,7 +610,7 @@ Value PropIter::getEdge() const {
 }
 
 List PropIter::getVertices() {
-    DCHECK(iter_ == rows_.begin());
+    DCHECK(iter_ == rows_->begin());
     List vertices;
     vertices.values.reserve(size());
     for (; valid(); next()) {
@@ -572,7 +621,7 @@ List PropIter::getVertices() {
 }
 
 List PropIter::getEdges() {
-    DCHECK(iter_ == rows_.begin());
+    DCHECK(iter_ == rows_->begin());
     List edges;
     edges.values.reserve(size());
     for (; valid(); next()) {
@@ -41,6 +41,8 @@ public:
     using RowsType = std::vector<T>;
     template <typename T>
     using RowsIter = typename RowsType<T>::iterator;
+    template <typename T>
+    using RowsPtr = std::shared_ptr<RowsType<T>>;
 
     enum class Kind : uint8_t {
         kDefault,
@@ -142,6 +144,18 @@ public:
 protected:
     virtual void doReset(size_t pos) = 0;
 
+    // The logical rows are shared by an iterator and its copies, so `copy()'
+    // is O(1) for the read-only consumers. An iterator detaches from the
+    // others before it erases or reorders the rows, keeping its position.
+    template <typename T>
+    static void detach(RowsPtr<T>& rows, RowsIter<T>& iter) {
+        if (rows.use_count() > 1) {
+            auto pos = iter - rows->begin();
+            rows = std::make_shared<RowsType<T>>(*rows);
+            iter = rows->begin() + pos;
+        }
+    }
+
     std::shared_ptr<Value> value_;
     Kind                   kind_;
 };
@@ -208,7 +222,7 @@ public:
     }
 
     bool valid() const override {
-        return valid_ && iter_ < logicalRows_.end();
+        return valid_ && iter_ < logicalRows_->end();
     }
 
     void next() override {
@@ -219,13 +233,15 @@ public:
 
     void clear() override {
         valid_ = false;
-        dsIndices_.clear();
-        logicalRows_.clear();
+        dsIndices_ = std::make_shared<std::vector<DataSetIndex>>();
+        logicalRows_ = std::make_shared<RowsType<GetNbrLogicalRow>>();
+        iter_ = logicalRows_->begin();
     }
 
     void erase() override {
         if (valid()) {
-            iter_ = logicalRows_.erase(iter_);
+            detach(logicalRows_, iter_);
+            iter_ = logicalRows_->erase(iter_);
         }
     }
 
@@ -233,16 +249,17 @@ public:
         if (first >= last || first >= size()) {
             return;
         }
+        detach(logicalRows_, iter_);
         if (last > size()) {
-            logicalRows_.erase(logicalRows_.begin() + first, logicalRows_.end());
+            logicalRows_->erase(logicalRows_->begin() + first, logicalRows_->end());
         } else {
-            logicalRows_.erase(logicalRows_.begin() + first, logicalRows_.begin() + last);
+            logicalRows_->erase(logicalRows_->begin() + first, logicalRows_->begin() + last);
         }
         reset();
     }
 
     size_t size() const override {
-        return logicalRows_.size();
+        return logicalRows_->size();
     }
 
     const Value& getColumn(const std::string& col) const override;
@@ -260,7 +277,7 @@ public:
     // getVertices and getEdges arg batch interface use for subgraph
     // Its unique based on the plan
     List getVertices() {
-        DCHECK(iter_ == logicalRows_.begin());
+        DCHECK(iter_ == logicalRows_->begin());
         List vertices;
         vertices.values.reserve(size());
         for (; valid(); next()) {
@@ -272,7 +289,7 @@ public:
 
     // Its unique based on the GN interface dedup
     List getEdges() {
-        DCHECK(iter_ == logicalRows_.begin());
+        DCHECK(iter_ == logicalRows_->begin());
         List edges;
         edges.values.reserve(size());
         for (; valid(); next()) {
@@ -292,7 +309,7 @@ public:
 
 private:
     void doReset(size_t pos) override {
-        iter_ = logicalRows_.begin() + pos;
+        iter_ = logicalRows_->begin() + pos;
     }
 
     inline size_t currentSeg() const {
@@ -371,10 +388,11 @@ private:
 
     FRIEND_TEST(IteratorTest, TestHead);
 
-    bool                       valid_{false};
-    RowsType<GetNbrLogicalRow> logicalRows_;
-    RowsIter<GetNbrLogicalRow> iter_;
-    std::vector<DataSetIndex>  dsIndices_;
+    bool                                        valid_{false};
+    RowsPtr<GetNbrLogicalRow>                   logicalRows_;
+    RowsIter<GetNbrLogicalRow>                  iter_;
+    // Immutable once built, shared by the copies
+    std::shared_ptr<std::vector<DataSetIndex>>  dsIndices_;
 };
 
 class SequentialIter final : public Iterator {
@@ -405,6 +423,7 @@ public:
 
     private:
         friend class SequentialIter;
+        friend class JoinIter;
         const Row* row_;
     };
 
@@ -412,13 +431,17 @@ public:
         : Iterator(value, Kind::kSequential) {
         DCHECK(value->isDataSet());
         auto& ds = value->getDataSet();
+        rows_ = std::make_shared<RowsType<SeqLogicalRow>>();
+        rows_->reserve(ds.rows.size());
         for (auto& row : ds.rows) {
-            rows_.emplace_back(&row);
+            rows_->emplace_back(&row);
         }
-        iter_ = rows_.begin();
+        iter_ = rows_->begin();
+        auto colIndices = std::make_shared<std::unordered_map<std::string, int64_t>>();
         for (size_t i = 0; i < ds.colNames.size(); ++i) {
-            colIndices_.emplace(ds.colNames[i], i);
+            colIndices->emplace(ds.colNames[i], i);
         }
+        colIndices_ = std::move(colIndices);
     }
 
     // union two sequential iterator.
@@ -428,15 +451,12 @@ public:
         DCHECK(right->isSequentialIter());
         auto lIter = static_cast<SequentialIter*>(left.get());
         auto rIter = static_cast<SequentialIter*>(right.get());
-        rows_.insert(rows_.end(),
-                     std::make_move_iterator(lIter->begin()),
-                     std::make_move_iterator(lIter->end()));
-
-        rows_.insert(rows_.end(),
-                     std::make_move_iterator(rIter->begin()),
-                     std::make_move_iterator(rIter->end()));
-        iter_ = rows_.begin();
-        colIndices_ = lIter->getColIndices();
+        rows_ = std::make_shared<RowsType<SeqLogicalRow>>();
+        rows_->reserve(lIter->size() + rIter->size());
+        rows_->insert(rows_->end(), lIter->rows_->begin(), lIter->rows_->end());
+        rows_->insert(rows_->end(), rIter->rows_->begin(), rIter->rows_->end());
+        iter_ = rows_->begin();
+        colIndices_ = lIter->colIndices_;
     }
 
     std::unique_ptr<Iterator> copy() const override {
@@ -446,7 +466,7 @@ public:
     }
 
     bool valid() const override {
-        return iter_ < rows_.end();
+        return iter_ < rows_->end();
     }
 
     void next() override {
@@ -456,49 +476,54 @@ public:
     }
 
     void erase() override {
-        iter_ = rows_.erase(iter_);
+        detach(rows_, iter_);
+        iter_ = rows_->erase(iter_);
     }
 
     void eraseRange(size_t first, size_t last) override {
         if (first >= last || first >= size()) {
             return;
         }
+        detach(rows_, iter_);
         if (last > size()) {
-            rows_.erase(rows_.begin() + first, rows_.end());
+            rows_->erase(rows_->begin() + first, rows_->end());
         } else {
-            rows_.erase(rows_.begin() + first, rows_.begin() + last);
+            rows_->erase(rows_->begin() + first, rows_->begin() + last);
         }
         reset();
     }
 
     void clear() override {
-        rows_.clear();
+        rows_ = std::make_shared<RowsType<SeqLogicalRow>>();
         reset();
     }
 
+    // For reordering the rows in place, e.g. sort
     RowsIter<SeqLogicalRow> begin() {
-        return rows_.begin();
+        detach(rows_, iter_);
+        return rows_->begin();
     }
 
     RowsIter<SeqLogicalRow> end() {
-        return rows_.end();
+        detach(rows_, iter_);
+        return rows_->end();
     }
 
     const std::unordered_map<std::string, int64_t>& getColIndices() const {
-        return colIndices_;
+        return *colIndices_;
     }
 
     size_t size() const override {
-        return rows_.size();
+        return rows_->size();
     }
 
     const Value& getColumn(const std::string& col) const override {
         if (!valid()) {
             return Value::kNullValue;
         }
-        auto logicalRow = *iter_;
-        auto index = colIndices_.find(col);
-        if (index == colIndices_.end()) {
+        auto& logicalRow = *iter_;
+        auto index = colIndices_->find(col);
+        if (index == colIndices_->end()) {
             return Value::kNullValue;
         } else {
             DCHECK_LT(index->second, logicalRow.row_->values.size());
@@ -535,37 +560,45 @@ protected:
 
 private:
     void doReset(size_t pos) override {
-        iter_ = rows_.begin() + pos;
+        iter_ = rows_->begin() + pos;
     }
 
 private:
-    RowsType<SeqLogicalRow>                      rows_;
-    RowsIter<SeqLogicalRow>                      iter_;
-    std::unordered_map<std::string, int64_t>     colIndices_;
+    RowsPtr<SeqLogicalRow>                                          rows_;
+    RowsIter<SeqLogicalRow>                                         iter_;
+    // Immutable once built, shared by the copies
+    std::shared_ptr<const std::unordered_map<std::string, int64_t>> colIndices_;
 };
 
 class JoinIter final : public Iterator {
+private:
+    // colName -> segIdx, currentSegColIdx
+    using ColIndices = std::unordered_map<std::string, std::pair<size_t, size_t>>;
+    // colIdx -> segIdx, currentSegColIdx, indexed by the column index
+    using ColIdxIndices = std::vector<std::pair<size_t, size_t>>;
+
 public:
     class JoinLogicalRow final : public LogicalRow {
     public:
-        explicit JoinLogicalRow(
-            std::vector<const Row*> values,
-            size_t size,
-            const std::unordered_map<size_t, std::pair<size_t, size_t>>* colIdxIndices)
-            : values_(std::move(values)), size_(size), colIdxIndices_(colIdxIndices) {}
+        JoinLogicalRow(const Row* const* segs,
+                       size_t segsNum,
+                       size_t size,
+                       const ColIdxIndices* colIdxIndices)
+            : segs_(segs), segsNum_(segsNum), size_(size), colIdxIndices_(colIdxIndices) {}
 
         const Value& operator[](size_t idx) const override {
             if (idx < size_) {
-                auto index = colIdxIndices_->find(idx);
-                if (index == colIdxIndices_->end()) {
+                if (idx >= colIdxIndices_->size()) {
                     return Value::kNullValue;
-                } else {
-                    auto keyIdx = index->second.first;
-                    auto valIdx = index->second.second;
-                    DCHECK_LT(keyIdx, values_.size());
-                    DCHECK_LT(valIdx, values_[keyIdx]->values.size());
-                    return values_[keyIdx]->values[valIdx];
                 }
+                const auto& index = (*colIdxIndices_)[idx];
+                auto keyIdx = index.first;
+                auto valIdx = index.second;
+                if (keyIdx >= segsNum_) {
+                    return Value::kNullValue;
+                }
+                DCHECK_LT(valIdx, segs_[keyIdx]->values.size());
+                return segs_[keyIdx]->values[valIdx];
             } else {
                 return Value::kEmpty;
             }
@@ -580,24 +613,35 @@ public:
         }
 
         std::vector<const Row*> segments() const override {
-            return values_;
+            return std::vector<const Row*>(segs_, segs_ + segsNum_);
         }
 
     private:
         friend class JoinIter;
-        std::vector<const Row*> values_;
-        size_t size_;
-        const std::unordered_map<size_t, std::pair<size_t, size_t>>* colIdxIndices_;
+        // Points to the fixed-width segments in the arena of the iterator
+        const Row* const*                                       segs_;
+        size_t                                                  segsNum_;
+        size_t                                                  size_;
+        const ColIdxIndices*                                    colIdxIndices_;
     };
 
-    JoinIter() : Iterator(nullptr, Kind::kJoin) {}
+    JoinIter()
+        : Iterator(nullptr, Kind::kJoin),
+          rows_(std::make_shared<RowsType<JoinLogicalRow>>()),
+          iter_(rows_->begin()),
+          colIndices_(std::make_shared<ColIndices>()),
+          colIdxIndices_(std::make_shared<ColIdxIndices>()),
+          arena_(std::make_shared<SegmentArena>()) {}
 
+    // Build the column indices before adding any row
     void joinIndex(const Iterator* lhs, const Iterator* rhs);
 
-    void addRow(JoinLogicalRow row) {
-        rows_.emplace_back(std::move(row));
-        iter_ = rows_.begin();
-    }
+    // Append a row made up of the segments of lhs followed by the ones of rhs,
+    // the segments of a joined row are flattened into the new one.
+    void addRow(const LogicalRow* lhs, const LogicalRow* rhs);
+
+    // Append a row made up of the segments in the order of joinIndex()
+    void addRow(std::initializer_list<const Row*> segs, size_t size);
 
     std::unique_ptr<Iterator> copy() const override {
         auto copy = std::make_unique<JoinIter>(*this);
@@ -606,7 +650,7 @@ public:
     }
 
     bool valid() const override {
-        return iter_ < rows_.end();
+        return iter_ < rows_->end();
     }
 
     void next() override {
@@ -616,62 +660,72 @@ public:
     }
 
     void erase() override {
-        iter_ = rows_.erase(iter_);
+        detach(rows_, iter_);
+        iter_ = rows_->erase(iter_);
     }
 
     void eraseRange(size_t first, size_t last) override {
         if (first >= last || first >= size()) {
             return;
         }
+        detach(rows_, iter_);
         if (last > size()) {
-            rows_.erase(rows_.begin() + first, rows_.end());
+            rows_->erase(rows_->begin() + first, rows_->end());
         } else {
-            rows_.erase(rows_.begin() + first, rows_.begin() + last);
+            rows_->erase(rows_->begin() + first, rows_->begin() + last);
         }
         reset();
     }
 
     void clear() override {
-        rows_.clear();
+        rows_ = std::make_shared<RowsType<JoinLogicalRow>>();
         reset();
     }
 
+    // For reordering the rows in place, e.g. sort
     RowsIter<JoinLogicalRow> begin() {
-        return rows_.begin();
+        detach(rows_, iter_);
+        return rows_->begin();
     }
 
     RowsIter<JoinLogicalRow> end() {
-        return rows_.end();
+        detach(rows_, iter_);
+        return rows_->end();
     }
 
     const std::unordered_map<std::string, std::pair<size_t, size_t>>&
     getColIndices() const {
-        return colIndices_;
+        return *colIndices_;
     }
 
-    const std::unordered_map<size_t, std::pair<size_t, size_t>>&
-    getColIdxIndices() const {
-        return colIdxIndices_;
+    // The rows refer to it, it's kept alive by the copies of the iterator
+    const std::vector<std::pair<size_t, size_t>>& getColIdxIndices() const {
+        return *colIdxIndices_;
+    }
+
+    // Number of the segments of each row
+    size_t segsNum() const {
+        return segsNum_;
     }
 
     size_t size() const override {
-        return rows_.size();
+        return rows_->size();
     }
 
     const Value& getColumn(const std::string& col) const override {
         if (!valid()) {
             return Value::kNullValue;
         }
-        auto row = *iter_;
-        auto index = colIndices_.find(col);
-        if (index == colIndices_.end()) {
+        auto& row = *iter_;
+        auto index = colIndices_->find(col);
+        if (index == colIndices_->end()) {
             return Value::kNullValue;
         } else {
             auto segIdx = index->second.first;
             auto colIdx = index->second.second;
-            DCHECK_LT(segIdx, row.values_.size());
-            DCHECK_LT(colIdx, row.values_[segIdx]->values.size());
-            return row.values_[segIdx]->values[colIdx];
+            DCHECK_LT(segIdx, row.segsNum_);
+            DCHECK_LT(colIdx, row.segs_[segIdx]->values.size());
+            return row.segs_[segIdx]->values[colIdx];
         }
     }
 
@@ -683,21 +737,50 @@ public:
     }
 
 private:
+    /**
+     * Stores the segments of the rows back to back in fixed size chunks, so
+     * the segments of a row are contiguous and never move once allocated.
+     * It's append only and shared by the copies of the iterator.
+     */
+    class SegmentArena final {
+    public:
+        const Row** allocate(size_t num) {
+            if (chunks_.empty() || used_ + num > chunkSize_) {
+                chunkSize_ = std::max(kChunkSize, num);
+                chunks_.emplace_back(std::make_unique<const Row*[]>(chunkSize_));
+                used_ = 0;
+            }
+            auto* segs = chunks_.back().get() + used_;
+            used_ += num;
+            return segs;
+        }
+
+    private:
+        static constexpr size_t kChunkSize = 4096;
+
+        std::vector<std::unique_ptr<const Row*[]>>              chunks_;
+        size_t                                                  chunkSize_{0};
+        size_t                                                  used_{0};
+    };
+
     void doReset(size_t pos) override {
-        iter_ = rows_.begin() + pos;
+        iter_ = rows_->begin() + pos;
     }
 
     size_t buildIndexFromSeqIter(const SequentialIter* iter, size_t segIdx);
 
     size_t buildIndexFromJoinIter(const JoinIter* iter, size_t segIdx);
 
-private:
-    RowsType<JoinLogicalRow>                                       rows_;
+    // Copy the segments of the row to dst, returns the number of them
+    static size_t copySegments(const LogicalRow* row, const Row** dst);
+
+    RowsPtr<JoinLogicalRow>                                        rows_;
     RowsIter<JoinLogicalRow>                                       iter_;
-    // colName -> segIdx, currentSegColIdx
-    std::unordered_map<std::string, std::pair<size_t, size_t>>     colIndices_;
-    // colIdx -> segIdx, currentSegColIdx
-    std::unordered_map<size_t, std::pair<size_t, size_t>>          colIdxIndices_;
+    // Built by joinIndex() and shared by the copies
+    std::shared_ptr<ColIndices>                                    colIndices_;
+    std::shared_ptr<ColIdxIndices>                                 colIdxIndices_;
+    std::shared_ptr<SegmentArena>                                  arena_;
+    size_t                                                         segsNum_{0};
 };
 
 class PropIter final : public Iterator {
@@ -742,7 +825,7 @@ public:
     }
 
     bool valid() const override {
-        return iter_ < rows_.end();
+        return iter_ < rows_->end();
     }
 
     void next() override {
@@ -752,36 +835,41 @@ public:
     }
 
     void erase() override {
-        iter_ = rows_.erase(iter_);
+        detach(rows_, iter_);
+        iter_ = rows_->erase(iter_);
     }
 
     void eraseRange(size_t first, size_t last) override {
         if (first >= last || first >= size()) {
             return;
         }
+        detach(rows_, iter_);
         if (last > size()) {
-            rows_.erase(rows_.begin() + first, rows_.end());
+            rows_->erase(rows_->begin() + first, rows_->end());
         } else {
-            rows_.erase(rows_.begin() + first, rows_.begin() + last);
+            rows_->erase(rows_->begin() + first, rows_->begin() + last);
         }
         reset();
     }
 
     void clear() override {
-        rows_.clear();
+        rows_ = std::make_shared<RowsType<PropLogicalRow>>();
         reset();
     }
 
+    // For reordering the rows in place, e.g. sort
     RowsIter<PropLogicalRow> begin() {
-        return rows_.begin();
+        detach(rows_, iter_);
+        return rows_->begin();
     }
 
     RowsIter<PropLogicalRow> end() {
-        return rows_.end();
+        detach(rows_, iter_);
+        return rows_->end();
     }
 
     size_t size() const override {
-        return rows_.size();
+        return rows_->size();
     }
 
     const LogicalRow* row() const override {
@@ -815,7 +903,7 @@ public:
 
 private:
     void doReset(size_t pos) override {
-        iter_ = rows_.begin() + pos;
+        iter_ = rows_->begin() + pos;
     }
 
     struct DataSetIndex {
@@ -831,9 +919,10 @@ private:
     };
 
 private:
-    RowsType<PropLogicalRow>                                       rows_;
+    RowsPtr<PropLogicalRow>                                        rows_;
     RowsIter<PropLogicalRow>                                       iter_;
-    DataSetIndex                                                   dsIndex_;
+    // Immutable once built, shared by the copies
+    std::shared_ptr<DataSetIndex>                                  dsIndex_;
 };
 
 
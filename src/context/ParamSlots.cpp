@@ -0,0 +1,56 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "context/ParamSlots.h"
+
+#include "util/SchemaUtil.h"
+
+namespace nebula {
+namespace graph {
+
+void ParamSlots::add(const std::string& param,
+                     const std::string& var,
+                     size_t row,
+                     meta::cpp2::PropertyType type) {
+    // All the vids of a space are of the same type
+    DCHECK(types_.find(param) == types_.end() || types_[param] == type);
+    types_.emplace(param, type);
+    slots_.emplace_back(Slot{param, var, row});
+}
+
+Status ParamSlots::bind(const std::unordered_map<std::string, Value>& params,
+                        std::unordered_map<std::string, Value>* vars) const {
+    for (auto& kv : params) {
+        if (types_.find(kv.first) == types_.end()) {
+            return Status::SemanticError("Unknown parameter `$%s'", kv.first.c_str());
+        }
+    }
+    for (auto& type : types_) {
+        auto found = params.find(type.first);
+        if (found == params.end()) {
+            return Status::SemanticError("Parameter `$%s' is not bound", type.first.c_str());
+        }
+        if (!SchemaUtil::isValidVid(found->second, type.second)) {
+            return Status::SemanticError(
+                "Parameter `$%s' should be a %s, but was `%s'",
+                type.first.c_str(),
+                meta::cpp2::_PropertyType_VALUES_TO_NAMES.at(type.second),
+                found->second.toString().c_str());
+        }
+    }
+    for (auto& slot : slots_) {
+        auto var = vars->find(slot.var);
+        DCHECK(var != vars->end());
+        DCHECK_EQ(var->second.type(), Value::Type::DATASET);
+        auto& rows = var->second.mutableDataSet().rows;
+        DCHECK_LT(slot.row, rows.size());
+        rows[slot.row].values.front() = params.at(slot.param);
+    }
+    return Status::OK();
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,64 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef CONTEXT_PARAMSLOTS_H_
+#define CONTEXT_PARAMSLOTS_H_
+
+#include "common/base/Base.h"
+#include "common/base/Status.h"
+#include "common/datatypes/Value.h"
+#include "common/interface/gen-cpp2/meta_types.h"
+
+namespace nebula {
+namespace graph {
+
+/***************************************************************************
+ *
+ * The parameters of a prepared statement, e.g. `GO FROM $id OVER like', and
+ * where they are bound into the constant inputs of the plan, which are the
+ * rows of the start vids the validators put into the variables.
+ *
+ * The parameters are only allowed as the vids for the time being, so they are
+ * typed by the vid type of the space.
+ *
+ **************************************************************************/
+class ParamSlots final {
+public:
+    // The vid in the first column of the row `row' of the dataset in the
+    // variable `var' is the parameter `param'
+    void add(const std::string& param,
+             const std::string& var,
+             size_t row,
+             meta::cpp2::PropertyType type);
+
+    // The parameter names without `$' and their types
+    const std::map<std::string, meta::cpp2::PropertyType>& types() const {
+        return types_;
+    }
+
+    bool empty() const {
+        return slots_.empty();
+    }
+
+    // Bind the parameters into the values of the variables, all the parameters
+    // are required and type checked
+    Status bind(const std::unordered_map<std::string, Value>& params,
+                std::unordered_map<std::string, Value>* vars) const;
+
+private:
+    struct Slot {
+        std::string     param;
+        std::string     var;
+        size_t          row;
+    };
+
+    std::map<std::string, meta::cpp2::PropertyType>     types_;
+    std::vector<Slot>                                   slots_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+#endif   // CONTEXT_PARAMSLOTS_H_
@@ -0,0 +1,92 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "context/PreparedStatement.h"
+
+namespace nebula {
+namespace graph {
+
+PreparedStatement::PreparedStatement(std::string stmt,
+                                     std::unique_ptr<Sentence> sentence,
+                                     std::unique_ptr<QueryContext> qctx,
+                                     GraphSpaceID space,
+                                     std::string schemaVersion)
+    : stmt_(std::move(stmt)),
+      sentence_(std::move(sentence)),
+      qctx_(std::move(qctx)),
+      space_(space),
+      schemaVersion_(std::move(schemaVersion)) {
+    DCHECK_NOTNULL(qctx_->paramSlots());
+    constants_ = qctx_->ectx()->latestValues();
+}
+
+// static
+StatusOr<std::string> PreparedStatement::schemaVersion(QueryContext* qctx, GraphSpaceID space) {
+    auto tags = qctx->schemaMng()->getAllVerTagSchema(space);
+    NG_RETURN_IF_ERROR(tags);
+    auto edges = qctx->schemaMng()->getAllVerEdgeSchema(space);
+    NG_RETURN_IF_ERROR(edges);
+    auto tagIndexes = qctx->getMetaClient()->getTagIndexesFromCache(space);
+    NG_RETURN_IF_ERROR(tagIndexes);
+    auto edgeIndexes = qctx->getMetaClient()->getEdgeIndexesFromCache(space);
+    NG_RETURN_IF_ERROR(edgeIndexes);
+
+    // The versions of a schema are all kept, the latest one is the last
+    std::vector<std::string> items;
+    for (auto& tag : tags.value()) {
+        items.emplace_back(folly::stringPrintf("t%d:%zu", tag.first, tag.second.size()));
+    }
+    for (auto& edge : edges.value()) {
+        items.emplace_back(folly::stringPrintf("e%d:%zu", edge.first, edge.second.size()));
+    }
+    for (auto& index : tagIndexes.value()) {
+        items.emplace_back(folly::stringPrintf("ti%d", index->get_index_id()));
+    }
+    for (auto& index : edgeIndexes.value()) {
+        items.emplace_back(folly::stringPrintf("ei%d", index->get_index_id()));
+    }
+    std::sort(items.begin(), items.end());
+    return folly::join(",", items);
+}
+
+bool PreparedStatement::acquire() {
+    bool expected = false;
+    return running_.compare_exchange_strong(expected, true, std::memory_order_acquire);
+}
+
+Status PreparedStatement::bind(const std::unordered_map<std::string, Value>& params) {
+    DCHECK(running_.load(std::memory_order_relaxed));
+    // The executors may change their inputs, so always start from a copy
+    auto values = constants_;
+    NG_RETURN_IF_ERROR(qctx_->paramSlots()->bind(params, &values));
+    qctx_->resetExecution();
+    auto* ectx = qctx_->ectx();
+    for (auto& kv : values) {
+        ectx->setResult(kv.first, ResultBuilder().value(std::move(kv.second)).finish());
+    }
+    return Status::OK();
+}
+
+void PreparedStatement::replan(std::unique_ptr<Sentence> sentence,
+                               std::unique_ptr<QueryContext> qctx,
+                               std::string schemaVersion) {
+    DCHECK(running_.load(std::memory_order_relaxed));
+    DCHECK_NOTNULL(qctx->paramSlots());
+    // The plan refers to the sentence
+    qctx_ = std::move(qctx);
+    sentence_ = std::move(sentence);
+    schemaVersion_ = std::move(schemaVersion);
+    constants_ = qctx_->ectx()->latestValues();
+}
+
+void PreparedStatement::release() {
+    qctx_->resetExecution();
+    qctx_->setRCtx(nullptr);
+    running_.store(false, std::memory_order_release);
+}
+
+}   // namespace graph
+}   // namespace nebula
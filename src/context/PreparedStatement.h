@@ -0,0 +1,103 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef CONTEXT_PREPAREDSTATEMENT_H_
+#define CONTEXT_PREPAREDSTATEMENT_H_
+
+#include "common/base/Base.h"
+#include "common/cpp/helpers.h"
+#include "context/QueryContext.h"
+#include "parser/Sentence.h"
+
+namespace nebula {
+namespace graph {
+
+/***************************************************************************
+ *
+ * A read-only statement validated and optimized once, and run many times
+ * with the different parameters, e.g. `FETCH PROP ON person $id'. It keeps the
+ * query context with the plan, and the constant inputs of the plan, which the
+ * parameters are bound into before each execution.
+ *
+ * The plan is only run by one query at a time, which holds the statement
+ * from acquire() to release().
+ *
+ **************************************************************************/
+class PreparedStatement final : public cpp::NonCopyable, public cpp::NonMovable {
+public:
+    // The plan of the qctx has been optimized
+    PreparedStatement(std::string stmt,
+                      std::unique_ptr<Sentence> sentence,
+                      std::unique_ptr<QueryContext> qctx,
+                      GraphSpaceID space,
+                      std::string schemaVersion);
+
+    // The latest versions of the tags and the edges, and the indexes of the
+    // space. Taken before planning, the plan is made again once it's changed.
+    static StatusOr<std::string> schemaVersion(QueryContext* qctx, GraphSpaceID space);
+
+    int64_t id() const {
+        return id_;
+    }
+
+    void setId(int64_t id) {
+        id_ = id;
+    }
+
+    const std::string& stmt() const {
+        return stmt_;
+    }
+
+    QueryContext* qctx() const {
+        return qctx_.get();
+    }
+
+    Sentence* sentence() const {
+        return sentence_.get();
+    }
+
+    // The space where the statement is prepared
+    GraphSpaceID space() const {
+        return space_;
+    }
+
+    const std::string& schemaVersion() const {
+        return schemaVersion_;
+    }
+
+    const std::map<std::string, meta::cpp2::PropertyType>& params() const {
+        return qctx_->paramSlots()->types();
+    }
+
+    // Returns false if it's running
+    bool acquire();
+
+    // Set up the execution context with the parameters
+    Status bind(const std::unordered_map<std::string, Value>& params);
+
+    // Replace the plan by the one made for the changed schema, while it's acquired
+    void replan(std::unique_ptr<Sentence> sentence,
+                std::unique_ptr<QueryContext> qctx,
+                std::string schemaVersion);
+
+    // Drop the request and the execution of the last run
+    void release();
+
+private:
+    int64_t                                         id_{0};
+    std::string                                     stmt_;
+    // The plan refers to the sentence
+    std::unique_ptr<Sentence>                       sentence_;
+    std::unique_ptr<QueryContext>                   qctx_;
+    GraphSpaceID                                    space_;
+    std::string                                     schemaVersion_;
+    std::unordered_map<std::string, Value>          constants_;
+    std::atomic<bool>                               running_{false};
+};
+
+}   // namespace graph
+}   // namespace nebula
+#endif   // CONTEXT_PREPAREDSTATEMENT_H_
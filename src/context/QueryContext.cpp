@@ -32,6 +32,7 @@ QueryContext::QueryContext() {
 
 void QueryContext::init() {
     objPool_ = std::make_unique<ObjectPool>();
+    execPool_ = std::make_unique<ObjectPool>();
     ep_ = std::make_unique<ExecutionPlan>();
     ectx_ = std::make_unique<ExecutionContext>();
     idGen_ = std::make_unique<IdGenerator>(0);
@@ -39,6 +40,14 @@ void QueryContext::init() {
     vctx_ = std::make_unique<ValidateContext>(std::make_unique<AnonVarGenerator>(symTable_.get()));
 }
 
+void QueryContext::resetExecution() {
+    // The executors refer to the ectx, which keeps the variables of the plan
+    ectx_->clear();
+    planDescription_.reset();
+    moveOperatorStats();
+    partialSuccess_ = false;
+}
+
 void QueryContext::addProfilingData(int64_t planNodeId, cpp2::ProfilingStats&& profilingStats) {
     // return directly if not enable profile
     if (!planDescription_) return;
@@ -59,5 +68,36 @@ void QueryContext::fillPlanDescription() {
     ep_->fillPlanDescription(planDescription_.get());
 }
 
+void QueryContext::addOperatorStats(OperatorStats&& stats) {
+    folly::SpinLockGuard g(operatorStatsLock_);
+    auto found = operatorStats_.find(stats.planNodeId);
+    if (found == operatorStats_.end()) {
+        operatorStats_.emplace(stats.planNodeId, std::move(stats));
+        return;
+    }
+    auto& sum = found->second;
+    sum.executions += stats.executions;
+    sum.rows += stats.rows;
+    sum.execDurationInUs += stats.execDurationInUs;
+    sum.totalDurationInUs += stats.totalDurationInUs;
+}
+
+std::vector<OperatorStats> QueryContext::moveOperatorStats() {
+    std::unordered_map<int64_t, OperatorStats> operatorStats;
+    {
+        folly::SpinLockGuard g(operatorStatsLock_);
+        operatorStats.swap(operatorStats_);
+    }
+    std::vector<OperatorStats> result;
+    result.reserve(operatorStats.size());
+    for (auto& stats : operatorStats) {
+        result.emplace_back(std::move(stats.second));
+    }
+    std::sort(result.begin(), result.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.planNodeId < rhs.planNodeId;
+    });
+    return result;
+}
+
 }   // namespace graph
 }   // namespace nebula
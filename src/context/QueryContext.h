@@ -7,6 +7,8 @@
 #ifndef CONTEXT_QUERYCONTEXT_H_
 #define CONTEXT_QUERYCONTEXT_H_
 
+#include <folly/SpinLock.h>
+
 #include "common/base/Base.h"
 #include "common/charset/Charset.h"
 #include "common/clients/meta/MetaClient.h"
@@ -16,6 +18,8 @@
 #include "common/meta/SchemaManager.h"
 #include "common/meta/IndexManager.h"
 #include "context/ExecutionContext.h"
+#include "context/ParamSlots.h"
+#include "context/QueryLog.h"
 #include "context/ValidateContext.h"
 #include "parser/SequentialSentences.h"
 #include "service/RequestContext.h"
@@ -31,6 +35,8 @@ class ProfilingStats;
 class PlanDescription;
 }   // namespace cpp2
 
+class Executor;
+
 /***************************************************************************
  *
  * The context for each query request
@@ -86,6 +92,10 @@ public:
         return rctx_.get();
     }
 
+    RequestContextPtr moveRCtx() {
+        return std::move(rctx_);
+    }
+
     ValidateContext* vctx() const {
         return vctx_.get();
     }
@@ -126,6 +136,33 @@ public:
         return objPool_.get();
     }
 
+    // The executors of the plan, kept across the executions of the plan
+    ObjectPool* execPool() const {
+        return execPool_.get();
+    }
+
+    // The root of the executors created for the plan, null if not created yet
+    Executor* executor() const {
+        return executor_;
+    }
+
+    void setExecutor(Executor* executor) {
+        executor_ = executor;
+    }
+
+    // Drop the results of the last execution, so the plan could be run again,
+    // e.g. by the prepared statements. The executors are reused by the next one.
+    void resetExecution();
+
+    // Not null only if preparing a statement
+    ParamSlots* paramSlots() const {
+        return paramSlots_.get();
+    }
+
+    void setParamSlots(std::unique_ptr<ParamSlots> paramSlots) {
+        paramSlots_ = std::move(paramSlots);
+    }
+
     int64_t genId() const {
         return idGen_->id();
     }
@@ -142,6 +179,22 @@ public:
 
     void fillPlanDescription();
 
+    // Executors of different branches may finish concurrently, and the ones
+    // in a loop close once for each round, summed up by the plan node
+    void addOperatorStats(OperatorStats&& stats);
+
+    // Ordered by the plan node id
+    std::vector<OperatorStats> moveOperatorStats();
+
+    // Some of the storage parts failed, the result is incomplete
+    bool partialSuccess() const {
+        return partialSuccess_.load(std::memory_order_relaxed);
+    }
+
+    void markPartialSuccess() {
+        partialSuccess_.store(true, std::memory_order_relaxed);
+    }
+
     SymbolTable* symTable() const {
         return symTable_.get();
     }
@@ -160,11 +213,18 @@ private:
     CharsetInfo*                                            charsetInfo_{nullptr};
 
     // The Object Pool holds all internal generated objects.
-    // e.g. expressions, plan nodes, executors
+    // e.g. expressions, plan nodes
     std::unique_ptr<ObjectPool>                             objPool_;
+    std::unique_ptr<ObjectPool>                             execPool_;
+    Executor*                                               executor_{nullptr};
+    std::unique_ptr<ParamSlots>                             paramSlots_;
 
     // plan description for explain and profile query
     std::unique_ptr<cpp2::PlanDescription>                  planDescription_;
+    // lightweight profiling stats collected for all queries
+    folly::SpinLock                                         operatorStatsLock_;
+    std::unordered_map<int64_t, OperatorStats>              operatorStats_;
+    std::atomic<bool>                                       partialSuccess_{false};
     std::unique_ptr<IdGenerator>                            idGen_;
     std::unique_ptr<SymbolTable>                            symTable_;
 };
@@ -0,0 +1,152 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "context/QueryLog.h"
+
+#include "common/time/WallClock.h"
+#include "service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+std::string OperatorStats::toString() const {
+    return folly::stringPrintf("%s(id:%ld, executions:%ld, rows:%ld, exec:%ldus, total:%ldus)",
+                               name.c_str(),
+                               planNodeId,
+                               executions,
+                               rows,
+                               execDurationInUs,
+                               totalDurationInUs);
+}
+
+// static
+QueryLog& QueryLog::instance() {
+    static QueryLog log;
+    return log;
+}
+
+int64_t QueryLog::onStart(int64_t sessionId,
+                          std::string user,
+                          std::string space,
+                          std::string query) {
+    QueryLogEntry entry;
+    entry.sessionId = sessionId;
+    entry.user = std::move(user);
+    entry.space = std::move(space);
+    entry.query = std::move(query);
+    entry.startTime = time::WallClock::fastNowInMicroSec();
+    entry.status = "RUNNING";
+
+    folly::SpinLockGuard g(lock_);
+    auto id = nextId_++;
+    entry.queryId = id;
+    running_.emplace(id, std::move(entry));
+    return id;
+}
+
+// static
+bool QueryLog::isSlow(int64_t latencyInUs) {
+    return FLAGS_slow_query_threshold_us >= 0 && latencyInUs >= FLAGS_slow_query_threshold_us;
+}
+
+void QueryLog::onFinish(int64_t queryId,
+                        int64_t latencyInUs,
+                        const Status& status,
+                        std::vector<OperatorStats> operators,
+                        std::shared_ptr<const cpp2::PlanDescription> plan) {
+    QueryLogEntry entry;
+    {
+        folly::SpinLockGuard g(lock_);
+        auto found = running_.find(queryId);
+        if (found == running_.end()) {
+            return;
+        }
+        entry = std::move(found->second);
+        running_.erase(found);
+    }
+
+    if (!isSlow(latencyInUs)) {
+        return;
+    }
+
+    entry.latencyInUs = latencyInUs;
+    entry.status = status.ok() ? "SUCCEEDED" : status.toString();
+    entry.operators = std::move(operators);
+    entry.plan = std::move(plan);
+
+    std::vector<std::string> ops;
+    ops.reserve(entry.operators.size());
+    for (auto& op : entry.operators) {
+        ops.emplace_back(op.toString());
+    }
+    LOG(WARNING) << "Slow query, session: " << entry.sessionId << ", user: " << entry.user
+                 << ", space: " << entry.space << ", latency: " << latencyInUs << "us"
+                 << ", status: " << entry.status << ", query: " << entry.query
+                 << ", operators: [" << folly::join(", ", ops) << "]";
+
+    folly::SpinLockGuard g(lock_);
+    addSlowQuery(std::move(entry));
+}
+
+void QueryLog::addSlowQuery(QueryLogEntry&& entry) {
+    auto capacity = static_cast<size_t>(std::max(FLAGS_slow_query_log_capacity, 0));
+    if (capacity == 0) {
+        slow_.clear();
+        head_ = 0;
+        return;
+    }
+    if (slow_.size() > capacity) {
+        // The capacity has been decreased at runtime, keep the latest ones
+        std::rotate(slow_.begin(), slow_.begin() + head_, slow_.end());
+        slow_.erase(slow_.begin(), slow_.end() - capacity);
+        head_ = 0;
+    }
+    if (slow_.size() < capacity) {
+        if (head_ != 0) {
+            std::rotate(slow_.begin(), slow_.begin() + head_, slow_.end());
+            head_ = 0;
+        }
+        slow_.emplace_back(std::move(entry));
+        return;
+    }
+    slow_[head_] = std::move(entry);
+    head_ = (head_ + 1) % slow_.size();
+}
+
+std::vector<QueryLogEntry> QueryLog::runningQueries() const {
+    std::vector<QueryLogEntry> queries;
+    {
+        folly::SpinLockGuard g(lock_);
+        queries.reserve(running_.size());
+        for (auto& query : running_) {
+            queries.emplace_back(query.second);
+        }
+    }
+    std::sort(queries.begin(), queries.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.queryId < rhs.queryId;
+    });
+    return queries;
+}
+
+std::vector<QueryLogEntry> QueryLog::slowQueries() const {
+    std::vector<QueryLogEntry> queries;
+    folly::SpinLockGuard g(lock_);
+    queries.reserve(slow_.size());
+    for (size_t i = 0; i < slow_.size(); ++i) {
+        queries.emplace_back(slow_[(head_ + i) % slow_.size()]);
+    }
+    return queries;
+}
+
+void QueryLog::clear() {
+    folly::SpinLockGuard g(lock_);
+    running_.clear();
+    slow_.clear();
+    head_ = 0;
+}
+
+}   // namespace graph
+}   // namespace nebula
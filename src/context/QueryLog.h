@@ -0,0 +1,102 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef CONTEXT_QUERYLOG_H_
+#define CONTEXT_QUERYLOG_H_
+
+#include <folly/SpinLock.h>
+
+#include "common/base/Base.h"
+#include "common/base/Status.h"
+
+namespace nebula {
+namespace graph {
+
+namespace cpp2 {
+class PlanDescription;
+}   // namespace cpp2
+
+// Compact per-operator statistics collected for every query when the
+// lightweight profiling is enabled, independent of PROFILE. The node run
+// several times, e.g. in a loop, is summed up over all the runs.
+struct OperatorStats {
+    int64_t planNodeId{-1};
+    std::string name;
+    int64_t executions{1};
+    int64_t rows{0};
+    int64_t execDurationInUs{0};
+    int64_t totalDurationInUs{0};
+
+    std::string toString() const;
+};
+
+struct QueryLogEntry {
+    int64_t queryId{0};
+    int64_t sessionId{0};
+    std::string user;
+    std::string space;
+    std::string query;
+    // Unix timestamp in microseconds
+    int64_t startTime{0};
+    int64_t latencyInUs{0};
+    std::string status;
+    std::vector<OperatorStats> operators;
+    // The plan executed, only kept for the slow queries
+    std::shared_ptr<const cpp2::PlanDescription> plan;
+};
+
+/***************************************************************************
+ *
+ * Process-wide registry of the running queries and a bounded ring buffer
+ * of the recent slow queries, the backend of SHOW [SLOW] QUERIES.
+ *
+ * It's thread-safe, all the queries of all the sessions report here.
+ *
+ **************************************************************************/
+class QueryLog final {
+public:
+    static QueryLog& instance();
+
+    // Register a running query, returns the query id
+    int64_t onStart(int64_t sessionId,
+                    std::string user,
+                    std::string space,
+                    std::string query);
+
+    // Whether the query of the latency is recorded as a slow one
+    static bool isSlow(int64_t latencyInUs);
+
+    // Unregister the running query, and record it into the slow query log
+    // if its latency reaches FLAGS_slow_query_threshold_us.
+    void onFinish(int64_t queryId,
+                  int64_t latencyInUs,
+                  const Status& status,
+                  std::vector<OperatorStats> operators,
+                  std::shared_ptr<const cpp2::PlanDescription> plan = nullptr);
+
+    std::vector<QueryLogEntry> runningQueries() const;
+
+    // Ordered from the oldest to the latest
+    std::vector<QueryLogEntry> slowQueries() const;
+
+    void clear();
+
+private:
+    QueryLog() = default;
+
+    void addSlowQuery(QueryLogEntry&& entry);
+
+    mutable folly::SpinLock                         lock_;
+    int64_t                                         nextId_{1};
+    std::unordered_map<int64_t, QueryLogEntry>      running_;
+    // Ring buffer, head_ points to the oldest entry once it's full
+    std::vector<QueryLogEntry>                      slow_;
+    size_t                                          head_{0};
+};
+
+}   // namespace graph
+}   // namespace nebula
+#endif   // CONTEXT_QUERYLOG_H_
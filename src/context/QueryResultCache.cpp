@@ -0,0 +1,436 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "context/QueryResultCache.h"
+
+#include "common/time/WallClock.h"
+#include "parser/AdminSentences.h"
+#include "parser/ExplainSentence.h"
+#include "parser/SequentialSentences.h"
+#include "parser/TraverseSentences.h"
+#include "service/GraphFlags.h"
+#include "util/GraphStats.h"
+
+namespace nebula {
+namespace graph {
+
+// static
+QueryResultCache& QueryResultCache::instance() {
+    static QueryResultCache cache;
+    return cache;
+}
+
+// static
+bool QueryResultCache::enabled() {
+    return FLAGS_enable_query_result_cache && FLAGS_query_result_cache_capacity_mb > 0;
+}
+
+// static
+std::string QueryResultCache::normalize(const std::string& query) {
+    std::string result;
+    result.reserve(query.size());
+    char quote = '\0';
+    bool blank = false;
+    for (size_t i = 0; i < query.size(); ++i) {
+        auto c = query[i];
+        if (quote != '\0') {
+            result += c;
+            if (c == '\\' && i + 1 < query.size()) {
+                result += query[++i];
+            } else if (c == quote) {
+                quote = '\0';
+            }
+            continue;
+        }
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            blank = true;
+            continue;
+        }
+        if (blank && !result.empty()) {
+            result += ' ';
+        }
+        blank = false;
+        if (c == '"' || c == '\'' || c == '`') {
+            quote = c;
+        }
+        result += c;
+    }
+    while (quote == '\0' && !result.empty() && (result.back() == ';' || result.back() == ' ')) {
+        result.pop_back();
+    }
+    return result;
+}
+
+// static
+bool QueryResultCache::isCacheable(const Sentence* sentence) {
+    // The sentences could be the input of a pipe, but not a query by itself
+    auto isPipeInput = [](const Sentence* s) {
+        switch (s->kind()) {
+            case Sentence::Kind::kYield:
+            case Sentence::Kind::kOrderBy:
+            case Sentence::Kind::kLimit:
+            case Sentence::Kind::kGroupBy:
+                return true;
+            default:
+                return false;
+        }
+    };
+    switch (sentence->kind()) {
+        case Sentence::Kind::kGo:
+        case Sentence::Kind::kMatch:
+        case Sentence::Kind::kLookup:
+        case Sentence::Kind::kFetchVertices:
+        case Sentence::Kind::kFetchEdges:
+        case Sentence::Kind::kFindPath:
+        case Sentence::Kind::kGetSubgraph:
+            return true;
+        case Sentence::Kind::kPipe: {
+            auto pipe = static_cast<const PipedSentence*>(sentence);
+            return isCacheable(pipe->left()) &&
+                   (isPipeInput(pipe->right()) || isCacheable(pipe->right()));
+        }
+        case Sentence::Kind::kSet: {
+            auto set = static_cast<const SetSentence*>(sentence);
+            return isCacheable(set->left()) && isCacheable(set->right());
+        }
+        case Sentence::Kind::kSequential: {
+            // The sentences before the last one may switch the space or
+            // assign the variables
+            auto sentences = static_cast<const SequentialSentences*>(sentence)->sentences();
+            return sentences.size() == 1 && isCacheable(sentences.front());
+        }
+        default:
+            // The EXPLAIN, the assignment, the admin and the mutations
+            return false;
+    }
+}
+
+// static
+bool QueryResultCache::mayModify(const Sentence* sentence) {
+    switch (sentence->kind()) {
+        case Sentence::Kind::kGo:
+        case Sentence::Kind::kMatch:
+        case Sentence::Kind::kLookup:
+        case Sentence::Kind::kFetchVertices:
+        case Sentence::Kind::kFetchEdges:
+        case Sentence::Kind::kFindPath:
+        case Sentence::Kind::kGetSubgraph:
+        case Sentence::Kind::kUse:
+        case Sentence::Kind::kYield:
+        case Sentence::Kind::kOrderBy:
+        case Sentence::Kind::kLimit:
+        case Sentence::Kind::kGroupBy:
+        case Sentence::Kind::kReturn:
+        case Sentence::Kind::kGetConfig:
+        case Sentence::Kind::kShowConfigs:
+        case Sentence::Kind::kDescribeTag:
+        case Sentence::Kind::kDescribeEdge:
+        case Sentence::Kind::kDescribeTagIndex:
+        case Sentence::Kind::kDescribeEdgeIndex:
+        case Sentence::Kind::kDescribeSpace:
+        case Sentence::Kind::kShowHosts:
+        case Sentence::Kind::kShowSpaces:
+        case Sentence::Kind::kShowParts:
+        case Sentence::Kind::kShowTags:
+        case Sentence::Kind::kShowEdges:
+        case Sentence::Kind::kShowTagIndexes:
+        case Sentence::Kind::kShowEdgeIndexes:
+        case Sentence::Kind::kShowUsers:
+        case Sentence::Kind::kShowRoles:
+        case Sentence::Kind::kShowCreateSpace:
+        case Sentence::Kind::kShowCreateTag:
+        case Sentence::Kind::kShowCreateEdge:
+        case Sentence::Kind::kShowCreateTagIndex:
+        case Sentence::Kind::kShowCreateEdgeIndex:
+        case Sentence::Kind::kShowSnapshots:
+        case Sentence::Kind::kShowCharset:
+        case Sentence::Kind::kShowCollation:
+        case Sentence::Kind::kShowQueries:
+            return false;
+        case Sentence::Kind::kExplain: {
+            // Only the PROFILE runs the sentences
+            auto explain = static_cast<const ExplainSentence*>(sentence);
+            return explain->isProfile() && mayModify(explain->seqSentences());
+        }
+        case Sentence::Kind::kAssignment:
+            return mayModify(static_cast<const AssignmentSentence*>(sentence)->sentence());
+        case Sentence::Kind::kPipe: {
+            auto pipe = static_cast<const PipedSentence*>(sentence);
+            return mayModify(pipe->left()) || mayModify(pipe->right());
+        }
+        case Sentence::Kind::kSet: {
+            auto set = static_cast<const SetSentence*>(sentence);
+            return mayModify(set->left()) || mayModify(set->right());
+        }
+        case Sentence::Kind::kSequential: {
+            auto sentences = static_cast<const SequentialSentences*>(sentence)->sentences();
+            return std::any_of(sentences.begin(), sentences.end(), [](auto s) {
+                return mayModify(s);
+            });
+        }
+        default:
+            return true;
+    }
+}
+
+// static
+bool QueryResultCache::isDeterministic(const std::string& query) {
+    // The current time is only read by them without any argument
+    static const std::unordered_set<std::string> kNoArgs = {
+        "timestamp", "date", "time", "datetime"};
+    static const std::unordered_set<std::string> kAlways = {
+        "rand", "rand32", "rand64", "now", "uuid"};
+    auto isIdChar = [](char c) {
+        return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+    };
+    char quote = '\0';
+    for (size_t i = 0; i < query.size(); ++i) {
+        auto c = query[i];
+        if (quote != '\0') {
+            if (c == '\\') {
+                ++i;
+            } else if (c == quote) {
+                quote = '\0';
+            }
+            continue;
+        }
+        if (c == '"' || c == '\'' || c == '`') {
+            quote = c;
+            continue;
+        }
+        if (!isIdChar(c)) {
+            continue;
+        }
+        auto end = i;
+        while (end < query.size() && isIdChar(query[end])) {
+            ++end;
+        }
+        auto name = query.substr(i, end - i);
+        folly::toLowerAscii(name);
+        auto next = end;
+        while (next < query.size() && query[next] == ' ') {
+            ++next;
+        }
+        if (next < query.size() && query[next] == '(') {
+            if (kAlways.count(name) != 0) {
+                return false;
+            }
+            auto arg = next + 1;
+            while (arg < query.size() && query[arg] == ' ') {
+                ++arg;
+            }
+            if (kNoArgs.count(name) != 0 && arg < query.size() && query[arg] == ')') {
+                return false;
+            }
+        }
+        i = end - 1;
+    }
+    return true;
+}
+
+// static
+bool QueryResultCache::modifiedSpaces(const Sentence* sentence,
+                                      std::string* space,
+                                      std::vector<std::string>* spaces) {
+    if (sentence->kind() == Sentence::Kind::kUse) {
+        *space = *static_cast<const UseSentence*>(sentence)->space();
+        return true;
+    }
+    if (!mayModify(sentence)) {
+        return true;
+    }
+    switch (sentence->kind()) {
+        case Sentence::Kind::kInsertVertices:
+        case Sentence::Kind::kInsertEdges:
+        case Sentence::Kind::kUpdateVertex:
+        case Sentence::Kind::kUpdateEdge:
+        case Sentence::Kind::kDeleteVertices:
+        case Sentence::Kind::kDeleteEdges:
+            if (space->empty()) {
+                return false;
+            }
+            spaces->emplace_back(*space);
+            return true;
+        case Sentence::Kind::kDropSpace:
+            spaces->emplace_back(*static_cast<const DropSpaceSentence*>(sentence)->spaceName());
+            return true;
+        case Sentence::Kind::kExplain:
+            return modifiedSpaces(
+                static_cast<const ExplainSentence*>(sentence)->seqSentences(), space, spaces);
+        case Sentence::Kind::kAssignment:
+            return modifiedSpaces(
+                static_cast<const AssignmentSentence*>(sentence)->sentence(), space, spaces);
+        case Sentence::Kind::kPipe: {
+            auto pipe = static_cast<const PipedSentence*>(sentence);
+            return modifiedSpaces(pipe->left(), space, spaces) &&
+                   modifiedSpaces(pipe->right(), space, spaces);
+        }
+        case Sentence::Kind::kSet: {
+            auto set = static_cast<const SetSentence*>(sentence);
+            return modifiedSpaces(set->left(), space, spaces) &&
+                   modifiedSpaces(set->right(), space, spaces);
+        }
+        case Sentence::Kind::kSequential: {
+            for (auto s : static_cast<const SequentialSentences*>(sentence)->sentences()) {
+                if (!modifiedSpaces(s, space, spaces)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        default:
+            // The schema, the users, the configs and the other admin ones
+            return false;
+    }
+}
+
+std::shared_ptr<const DataSet> QueryResultCache::get(GraphSpaceID space,
+                                                     const std::string& role,
+                                                     const std::string& query) {
+    std::shared_ptr<const DataSet> result;
+    {
+        folly::SpinLockGuard g(lock_);
+        auto found = entries_.find(makeKey(space, role, query));
+        if (found != entries_.end()) {
+            auto entry = found->second;
+            auto modified = modified_.find(space);
+            if (entry->expireAt <= time::WallClock::fastNowInSec() ||
+                (modified != modified_.end() && entry->version < modified->second)) {
+                erase(entry);
+            } else {
+                lru_.splice(lru_.begin(), lru_, entry);
+                result = entry->result;
+            }
+        }
+    }
+    GraphStats::addCacheLookups(GraphStats::Cache::kQueryResult, result ? 1 : 0, result ? 0 : 1);
+    return result;
+}
+
+void QueryResultCache::put(GraphSpaceID space,
+                           const std::string& role,
+                           const std::string& query,
+                           int64_t version,
+                           const DataSet& result) {
+    Entry entry;
+    entry.key = makeKey(space, role, query);
+    entry.version = version;
+    entry.expireAt = time::WallClock::fastNowInSec() + FLAGS_query_result_cache_ttl_secs;
+    entry.bytes = sizeof(Entry) + entry.key.size() * 2;
+    for (auto& colName : result.colNames) {
+        entry.bytes += sizeof(std::string) + colName.size();
+    }
+    for (auto& row : result.rows) {
+        entry.bytes += sizeof(Row);
+        for (auto& value : row.values) {
+            entry.bytes += approximateBytes(value);
+        }
+    }
+    auto capacity = static_cast<size_t>(FLAGS_query_result_cache_capacity_mb) * 1024 * 1024;
+    if (entry.bytes > capacity) {
+        return;
+    }
+    entry.result = std::make_shared<const DataSet>(result);
+
+    folly::SpinLockGuard g(lock_);
+    auto modified = modified_.find(space);
+    if (version < cleared_ || (modified != modified_.end() && version < modified->second)) {
+        return;
+    }
+    auto found = entries_.find(entry.key);
+    if (found != entries_.end()) {
+        // Someone else got it at the same time
+        erase(found->second);
+    }
+    bytes_ += entry.bytes;
+    lru_.emplace_front(std::move(entry));
+    entries_.emplace(lru_.front().key, lru_.begin());
+    while (bytes_ > capacity) {
+        erase(std::prev(lru_.end()));
+    }
+}
+
+int64_t QueryResultCache::version() const {
+    folly::SpinLockGuard g(lock_);
+    return version_;
+}
+
+void QueryResultCache::invalidate(GraphSpaceID space) {
+    // The stale entries are dropped on the access or the eviction
+    folly::SpinLockGuard g(lock_);
+    modified_[space] = ++version_;
+}
+
+void QueryResultCache::clear() {
+    folly::SpinLockGuard g(lock_);
+    cleared_ = ++version_;
+    lru_.clear();
+    entries_.clear();
+    bytes_ = 0;
+}
+
+size_t QueryResultCache::size() const {
+    folly::SpinLockGuard g(lock_);
+    return lru_.size();
+}
+
+// static
+std::string QueryResultCache::makeKey(GraphSpaceID space,
+                                      const std::string& role,
+                                      const std::string& query) {
+    std::string key;
+    key.reserve(sizeof(space) + role.size() + query.size() + 2);
+    key.append(reinterpret_cast<const char*>(&space), sizeof(space));
+    key.append(role);
+    key.push_back('\0');
+    key.append(query);
+    return key;
+}
+
+void QueryResultCache::erase(std::list<Entry>::iterator entry) {
+    entries_.erase(entry->key);
+    bytes_ -= entry->bytes;
+    lru_.erase(entry);
+}
+
+// static
+size_t QueryResultCache::approximateBytes(const Value& value) {
+    switch (value.type()) {
+        case Value::Type::STRING:
+            return sizeof(Value) + value.getStr().size();
+        case Value::Type::LIST: {
+            size_t bytes = sizeof(Value) + sizeof(List);
+            for (auto& v : value.getList().values) {
+                bytes += approximateBytes(v);
+            }
+            return bytes;
+        }
+        case Value::Type::SET: {
+            size_t bytes = sizeof(Value) + sizeof(Set);
+            for (auto& v : value.getSet().values) {
+                bytes += approximateBytes(v);
+            }
+            return bytes;
+        }
+        case Value::Type::MAP: {
+            size_t bytes = sizeof(Value) + sizeof(Map);
+            for (auto& kv : value.getMap().kvs) {
+                bytes += sizeof(std::string) + kv.first.size() + approximateBytes(kv.second);
+            }
+            return bytes;
+        }
+        case Value::Type::VERTEX:
+        case Value::Type::EDGE:
+        case Value::Type::PATH:
+        case Value::Type::DATASET:
+            return sizeof(Value) + value.toString().size();
+        default:
+            return sizeof(Value);
+    }
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,113 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef CONTEXT_QUERYRESULTCACHE_H_
+#define CONTEXT_QUERYRESULTCACHE_H_
+
+#include <folly/SpinLock.h>
+
+#include "common/base/Base.h"
+#include "common/datatypes/DataSet.h"
+#include "common/thrift/ThriftTypes.h"
+#include "parser/Sentence.h"
+
+namespace nebula {
+namespace graph {
+
+/***************************************************************************
+ *
+ * Process-wide LRU cache of the results of the read-only queries, keyed by
+ * the space, the role of the user in the space and the normalized query, so
+ * the users of different roles never share a result.
+ *
+ * A query which may modify a space through this graphd drops all the
+ * results of the space, the others are only seen after the TTL,
+ * FLAGS_query_result_cache_ttl_secs. It's bounded by the approximate memory
+ * of the results, FLAGS_query_result_cache_capacity_mb.
+ *
+ **************************************************************************/
+class QueryResultCache final {
+public:
+    static QueryResultCache& instance();
+
+    static bool enabled();
+
+    // Collapse the blanks out of the quotes and drop the trailing semicolons
+    static std::string normalize(const std::string& query);
+
+    // Whether the result only depends on the data, e.g. GO, LOOKUP and MATCH
+    static bool isCacheable(const Sentence* sentence);
+
+    // Whether it may change the data or the schema
+    static bool mayModify(const Sentence* sentence);
+
+    // Whether the normalized query calls none of the functions returning
+    // different values each time, e.g. rand32(), now() and uuid()
+    static bool isDeterministic(const std::string& query);
+
+    // Collect the names of the spaces whose data it may change, following the
+    // USE sentences from the current `space'. Returns false if they're not
+    // known, e.g. it changes the schema, then all the results are dropped.
+    static bool modifiedSpaces(const Sentence* sentence,
+                               std::string* space,
+                               std::vector<std::string>* spaces);
+
+    // Returns nullptr if missed or expired
+    std::shared_ptr<const DataSet> get(GraphSpaceID space,
+                                       const std::string& role,
+                                       const std::string& query);
+
+    // Taken before running the query, so the result is not put if the space
+    // is modified meanwhile
+    int64_t version() const;
+
+    void put(GraphSpaceID space,
+             const std::string& role,
+             const std::string& query,
+             int64_t version,
+             const DataSet& result);
+
+    void invalidate(GraphSpaceID space);
+
+    void clear();
+
+    size_t size() const;
+
+private:
+    QueryResultCache() = default;
+
+    struct Entry {
+        std::string                         key;
+        // The results of the queries started before the space is modified
+        // are stale
+        int64_t                             version;
+        std::shared_ptr<const DataSet>      result;
+        int64_t                             expireAt;
+        size_t                              bytes;
+    };
+
+    static std::string makeKey(GraphSpaceID space,
+                               const std::string& role,
+                               const std::string& query);
+
+    static size_t approximateBytes(const Value& value);
+
+    void erase(std::list<Entry>::iterator entry);
+
+    mutable folly::SpinLock                                         lock_;
+    // The most recently used at the front
+    std::list<Entry>                                                lru_;
+    std::unordered_map<std::string, std::list<Entry>::iterator>     entries_;
+    int64_t                                                         version_{0};
+    // The versions when the spaces are last modified
+    std::unordered_map<GraphSpaceID, int64_t>                       modified_;
+    int64_t                                                         cleared_{0};
+    size_t                                                          bytes_{0};
+};
+
+}   // namespace graph
+}   // namespace nebula
+#endif   // CONTEXT_QUERYRESULTCACHE_H_
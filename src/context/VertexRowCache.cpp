@@ -0,0 +1,262 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "context/VertexRowCache.h"
+
+#include "common/time/WallClock.h"
+#include "service/GraphFlags.h"
+#include "util/GraphStats.h"
+
+namespace nebula {
+namespace graph {
+
+constexpr size_t VertexRowCache::kShards;
+
+// static
+VertexRowCache& VertexRowCache::instance(Kind kind) {
+    static VertexRowCache neighbors(Kind::kNeighbor);
+    static VertexRowCache vertexProps(Kind::kVertexProp);
+    switch (kind) {
+        case Kind::kNeighbor:
+            return neighbors;
+        case Kind::kVertexProp:
+            return vertexProps;
+    }
+    LOG(FATAL) << "Unknown vertex row cache " << static_cast<int32_t>(kind);
+    return neighbors;
+}
+
+// static
+void VertexRowCache::invalidateAll(GraphSpaceID space, const Value& vid) {
+    for (auto kind : {Kind::kNeighbor, Kind::kVertexProp}) {
+        auto& cache = instance(kind);
+        if (cache.enabled()) {
+            cache.invalidate(space, vid);
+        }
+    }
+}
+
+bool VertexRowCache::enabled() const {
+    switch (kind_) {
+        case Kind::kNeighbor:
+            return FLAGS_enable_neighbor_cache && capacityInBytes() > 0;
+        case Kind::kVertexProp:
+            return FLAGS_enable_vertex_cache && capacityInBytes() > 0;
+    }
+    return false;
+}
+
+int64_t VertexRowCache::capacityInBytes() const {
+    auto mb = kind_ == Kind::kNeighbor ? FLAGS_neighbor_cache_capacity_mb
+                                       : FLAGS_vertex_cache_capacity_mb;
+    return mb * 1024 * 1024;
+}
+
+int32_t VertexRowCache::ttlInSecs() const {
+    return kind_ == Kind::kNeighbor ? FLAGS_neighbor_cache_ttl_secs
+                                    : FLAGS_vertex_cache_ttl_secs;
+}
+
+VertexRowCache::Shard& VertexRowCache::shard(GraphSpaceID space, const Value& vid) {
+    return shards_[VertexKeyHash()(VertexKey(space, vid)) % kShards];
+}
+
+bool VertexRowCache::get(GraphSpaceID space,
+                        const std::string& request,
+                        const Value& vid,
+                        Row* row,
+                        ColNames* colNames) {
+    auto& s = shard(space, vid);
+    folly::SpinLockGuard g(s.lock);
+    auto found = s.vertices.find(VertexKey(space, vid));
+    if (found == s.vertices.end()) {
+        return false;
+    }
+    for (auto entry : found->second) {
+        if (entry->request != request) {
+            continue;
+        }
+        if (entry->expireAt <= time::WallClock::fastNowInSec()) {
+            erase(s, entry);
+            return false;
+        }
+        s.lru.splice(s.lru.begin(), s.lru, entry);
+        *row = entry->row;
+        *colNames = entry->colNames;
+        return true;
+    }
+    return false;
+}
+
+void VertexRowCache::put(GraphSpaceID space,
+                        const std::string& request,
+                        const Value& vid,
+                        const Row& row,
+                        ColNames colNames) {
+    Entry entry;
+    entry.vertex = VertexKey(space, vid);
+    entry.request = request;
+    entry.row = row;
+    entry.colNames = std::move(colNames);
+    entry.expireAt = time::WallClock::fastNowInSec() + ttlInSecs();
+    entry.bytes = sizeof(Entry) + request.size();
+    for (auto& value : row.values) {
+        entry.bytes += approximateBytes(value);
+    }
+    auto capacity = static_cast<size_t>(capacityInBytes()) / kShards;
+    if (entry.bytes > capacity) {
+        return;
+    }
+
+    auto& s = shard(space, vid);
+    folly::SpinLockGuard g(s.lock);
+    auto found = s.vertices.find(entry.vertex);
+    if (found != s.vertices.end()) {
+        auto& entries = found->second;
+        auto same = std::find_if(entries.begin(), entries.end(), [&request](auto it) {
+            return it->request == request;
+        });
+        if (same != entries.end()) {
+            // Someone else got it at the same time
+            erase(s, *same);
+        }
+    }
+    s.bytes += entry.bytes;
+    s.lru.emplace_front(std::move(entry));
+    s.vertices[s.lru.front().vertex].emplace_back(s.lru.begin());
+    while (s.bytes > capacity) {
+        erase(s, std::prev(s.lru.end()));
+    }
+}
+
+void VertexRowCache::lookup(GraphSpaceID space,
+                            const std::string& request,
+                            std::vector<Row>* rows,
+                            std::vector<DataSet>* cached) {
+    // The groups of the rows in `cached' start from here
+    auto base = cached->size();
+    std::vector<ColNames> cachedColNames;
+    std::vector<Row> misses;
+    int64_t hits = 0;
+    for (auto& req : *rows) {
+        Row row;
+        ColNames colNames;
+        if (req.values.empty() || !get(space, request, req.values.front(), &row, &colNames)) {
+            misses.emplace_back(std::move(req));
+            continue;
+        }
+        ++hits;
+        size_t i = 0;
+        for (; i < cachedColNames.size(); ++i) {
+            if (cachedColNames[i] == colNames || *cachedColNames[i] == *colNames) {
+                break;
+            }
+        }
+        if (i == cachedColNames.size()) {
+            cachedColNames.emplace_back(colNames);
+            cached->emplace_back();
+            cached->back().colNames = *colNames;
+        }
+        (*cached)[base + i].rows.emplace_back(std::move(row));
+    }
+    GraphStats::addCacheLookups(kind_ == Kind::kNeighbor ? GraphStats::Cache::kNeighbor
+                                                         : GraphStats::Cache::kVertexProp,
+                                hits,
+                                misses.size());
+    *rows = std::move(misses);
+}
+
+void VertexRowCache::putAll(GraphSpaceID space, const std::string& request, const DataSet& ds) {
+    auto colNames = std::make_shared<const std::vector<std::string>>(ds.colNames);
+    for (auto& row : ds.rows) {
+        if (row.values.empty()) {
+            continue;
+        }
+        put(space, request, row.values.front(), row, colNames);
+    }
+}
+
+void VertexRowCache::invalidate(GraphSpaceID space, const Value& vid) {
+    auto& s = shard(space, vid);
+    folly::SpinLockGuard g(s.lock);
+    auto found = s.vertices.find(VertexKey(space, vid));
+    if (found == s.vertices.end()) {
+        return;
+    }
+    for (auto entry : found->second) {
+        s.bytes -= entry->bytes;
+        s.lru.erase(entry);
+    }
+    s.vertices.erase(found);
+}
+
+void VertexRowCache::invalidateSpace(GraphSpaceID space) {
+    for (auto& s : shards_) {
+        folly::SpinLockGuard g(s.lock);
+        for (auto it = s.vertices.begin(); it != s.vertices.end();) {
+            if (it->first.first != space) {
+                ++it;
+                continue;
+            }
+            for (auto entry : it->second) {
+                s.bytes -= entry->bytes;
+                s.lru.erase(entry);
+            }
+            it = s.vertices.erase(it);
+        }
+    }
+}
+
+void VertexRowCache::clear() {
+    for (auto& s : shards_) {
+        folly::SpinLockGuard g(s.lock);
+        s.lru.clear();
+        s.vertices.clear();
+        s.bytes = 0;
+    }
+}
+
+size_t VertexRowCache::size() const {
+    size_t size = 0;
+    for (auto& s : shards_) {
+        folly::SpinLockGuard g(s.lock);
+        size += s.lru.size();
+    }
+    return size;
+}
+
+// static
+void VertexRowCache::erase(Shard& shard, std::list<Entry>::iterator entry) {
+    auto found = shard.vertices.find(entry->vertex);
+    DCHECK(found != shard.vertices.end());
+    auto& entries = found->second;
+    entries.erase(std::find(entries.begin(), entries.end(), entry));
+    if (entries.empty()) {
+        shard.vertices.erase(found);
+    }
+    shard.bytes -= entry->bytes;
+    shard.lru.erase(entry);
+}
+
+// static
+size_t VertexRowCache::approximateBytes(const Value& value) {
+    switch (value.type()) {
+        case Value::Type::STRING:
+            return sizeof(Value) + value.getStr().size();
+        case Value::Type::LIST: {
+            size_t bytes = sizeof(Value) + sizeof(List);
+            for (auto& v : value.getList().values) {
+                bytes += approximateBytes(v);
+            }
+            return bytes;
+        }
+        default:
+            return sizeof(Value);
+    }
+}
+
+}   // namespace graph
+}   // namespace nebula
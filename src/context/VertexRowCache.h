@@ -0,0 +1,136 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef CONTEXT_VERTEXROWCACHE_H_
+#define CONTEXT_VERTEXROWCACHE_H_
+
+#include <folly/SpinLock.h>
+#include <folly/hash/Hash.h>
+
+#include "common/base/Base.h"
+#include "common/datatypes/DataSet.h"
+#include "common/thrift/ThriftTypes.h"
+
+namespace nebula {
+namespace graph {
+
+/***************************************************************************
+ *
+ * Process-wide LRU caches of the rows the storage returns per vertex, keyed
+ * by the space, the vid and the request, which is everything of the request
+ * except the vids, e.g. the edge types and the props. There is one cache of
+ * each kind:
+ *
+ *   kNeighbor      the GetNeighbors rows, FLAGS_neighbor_cache_*
+ *   kVertexProp    the GetVertices rows, FLAGS_vertex_cache_*
+ *
+ * The rows of the different requests of a vertex are kept together, so the
+ * writes through this graphd drop all of them at once. The others are only
+ * seen after the TTL.
+ *
+ * It's sharded by the vid with a lock for each shard, and bounded by the
+ * approximate memory of the rows.
+ *
+ **************************************************************************/
+class VertexRowCache final {
+public:
+    enum class Kind : uint8_t {
+        kNeighbor = 0,
+        kVertexProp,
+    };
+
+    using ColNames = std::shared_ptr<const std::vector<std::string>>;
+
+    static VertexRowCache& instance(Kind kind);
+
+    // Drop the rows of the vertex in all the caches
+    static void invalidateAll(GraphSpaceID space, const Value& vid);
+
+    bool enabled() const;
+
+    // Returns false if missed or expired
+    bool get(GraphSpaceID space,
+             const std::string& request,
+             const Value& vid,
+             Row* row,
+             ColNames* colNames);
+
+    void put(GraphSpaceID space,
+             const std::string& request,
+             const Value& vid,
+             const Row& row,
+             ColNames colNames);
+
+    // Take the rows whose vid in the first column is cached out of `rows', and
+    // append the cached rows into `cached', grouped by the column names
+    void lookup(GraphSpaceID space,
+                const std::string& request,
+                std::vector<Row>* rows,
+                std::vector<DataSet>* cached);
+
+    // Put the rows of the dataset, keyed by the vid in the first column
+    void putAll(GraphSpaceID space, const std::string& request, const DataSet& ds);
+
+    // Drop the rows of all the requests of the vertex
+    void invalidate(GraphSpaceID space, const Value& vid);
+
+    // Drop the rows of all the vertices of the space
+    void invalidateSpace(GraphSpaceID space);
+
+    void clear();
+
+    size_t size() const;
+
+private:
+    explicit VertexRowCache(Kind kind) : kind_(kind) {}
+
+    using VertexKey = std::pair<GraphSpaceID, Value>;
+
+    struct VertexKeyHash {
+        size_t operator()(const VertexKey& key) const {
+            return folly::hash::hash_combine(key.first, std::hash<Value>()(key.second));
+        }
+    };
+
+    struct Entry {
+        VertexKey               vertex;
+        std::string             request;
+        Row                     row;
+        ColNames                colNames;
+        int64_t                 expireAt;
+        size_t                  bytes;
+    };
+
+    struct Shard {
+        mutable folly::SpinLock                                 lock;
+        // The most recently used at the front
+        std::list<Entry>                                        lru;
+        std::unordered_map<VertexKey,
+                           std::vector<std::list<Entry>::iterator>,
+                           VertexKeyHash>                       vertices;
+        size_t                                                  bytes{0};
+    };
+
+    static constexpr size_t kShards = 32;
+
+    int64_t capacityInBytes() const;
+
+    int32_t ttlInSecs() const;
+
+    Shard& shard(GraphSpaceID space, const Value& vid);
+
+    // Unlink the entry from its vertex and drop it
+    static void erase(Shard& shard, std::list<Entry>::iterator entry);
+
+    static size_t approximateBytes(const Value& value);
+
+    const Kind                      kind_;
+    std::array<Shard, kShards>      shards_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+#endif   // CONTEXT_VERTEXROWCACHE_H_
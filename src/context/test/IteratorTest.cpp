@@ -79,6 +79,44 @@ TEST(IteratorTest, Sequential) {
     }
 }
 
+TEST(IteratorTest, CopyOnWrite) {
+    DataSet ds;
+    ds.colNames = {"col1"};
+    for (auto i = 0; i < 10; ++i) {
+        ds.rows.emplace_back(Row({i}));
+    }
+    auto val = std::make_shared<Value>(std::move(ds));
+    SequentialIter iter(val);
+    iter.next();
+    auto copyIter = iter.copy();
+    EXPECT_EQ(copyIter->getColumn("col1"), 0);
+
+    // Erasing the copy doesn't affect the origin
+    while (copyIter->valid()) {
+        if (copyIter->getColumn("col1").getInt() % 2 == 0) {
+            copyIter->erase();
+        } else {
+            copyIter->next();
+        }
+    }
+    EXPECT_EQ(copyIter->size(), 5);
+    EXPECT_EQ(iter.size(), 10);
+    // The origin keeps its position
+    EXPECT_EQ(iter.getColumn("col1"), 1);
+
+    // Erasing the origin doesn't affect the copy of copy
+    auto copyOfCopy = copyIter->copy();
+    iter.eraseRange(0, 8);
+    EXPECT_EQ(iter.size(), 2);
+    EXPECT_EQ(copyOfCopy->size(), 5);
+    EXPECT_EQ(copyOfCopy->getColumn("col1"), 1);
+
+    // Clearing the copy doesn't affect the origin
+    copyIter->clear();
+    EXPECT_EQ(copyIter->size(), 0);
+    EXPECT_EQ(copyOfCopy->size(), 5);
+}
+
 TEST(IteratorTest, GetNeighbor) {
     DataSet ds1;
     ds1.colNames = {kVid,
@@ -625,8 +663,8 @@ TEST(IteratorTest, Join) {
     joinIter.joinIndex(&iter1, &iter2);
     EXPECT_EQ(joinIter.getColIdxIndices().size(), 6);
     EXPECT_EQ(joinIter.getColIdxIndices().size(), 6);
-    joinIter.addRow(JoinIter::JoinLogicalRow({ &row1, &row2 }, 6, &joinIter.getColIdxIndices()));
-    joinIter.addRow(JoinIter::JoinLogicalRow({ &row1, &row2 }, 6, &joinIter.getColIdxIndices()));
+    joinIter.addRow({&row1, &row2}, 6);
+    joinIter.addRow({&row1, &row2}, 6);
 
     for (; joinIter.valid(); joinIter.next()) {
         const auto& row = *joinIter.row();
@@ -672,10 +710,8 @@ TEST(IteratorTest, Join) {
         joinIter2.joinIndex(&iter3, &joinIter);
         EXPECT_EQ(joinIter2.getColIndices().size(), 8);
         EXPECT_EQ(joinIter2.getColIdxIndices().size(), 8);
-        joinIter2.addRow(JoinIter::JoinLogicalRow({ &row3, &row1, &row2}, 8,
-                                                &joinIter2.getColIdxIndices()));
-        joinIter2.addRow(JoinIter::JoinLogicalRow({ &row3, &row1, &row2}, 8,
-                                                &joinIter2.getColIdxIndices()));
+        joinIter2.addRow({&row3, &row1, &row2}, 8);
+        joinIter2.addRow({&row3, &row1, &row2}, 8);
 
         for (; joinIter2.valid(); joinIter2.next()) {
             const auto& row = *joinIter2.row();
@@ -715,10 +751,15 @@ TEST(IteratorTest, Join) {
         joinIter2.joinIndex(&joinIter, &iter3);
         EXPECT_EQ(joinIter2.getColIndices().size(), 8);
         EXPECT_EQ(joinIter2.getColIdxIndices().size(), 8);
-        joinIter2.addRow(JoinIter::JoinLogicalRow({ &row1, &row2, &row3 }, 8,
-                                                &joinIter2.getColIdxIndices()));
-        joinIter2.addRow(JoinIter::JoinLogicalRow({ &row1, &row2, &row3 }, 8,
-                                                &joinIter2.getColIdxIndices()));
+        EXPECT_EQ(joinIter2.segsNum(), 3);
+        // The segments of the joined row are flattened into the new row
+        DataSet ds4 = ds3;
+        ds4.rows.emplace_back(row3);
+        SequentialIter iter4(std::make_shared<Value>(std::move(ds4)));
+        joinIter.reset();
+        joinIter2.addRow(joinIter.row(), iter4.row());
+        joinIter2.addRow({&row1, &row2, &row3}, 8);
+        EXPECT_EQ(joinIter2.row()->segments().size(), 3);
 
         for (; joinIter2.valid(); joinIter2.next()) {
             const auto& row = *joinIter2.row();
@@ -747,6 +788,58 @@ TEST(IteratorTest, Join) {
     }
 }
 
+TEST(IteratorTest, JoinDuplicateColumns) {
+    DataSet ds1;
+    ds1.colNames = {"a", "b"};
+    SequentialIter iter1(std::make_shared<Value>(ds1));
+    DataSet ds2;
+    ds2.colNames = {"a", "c"};
+    SequentialIter iter2(std::make_shared<Value>(ds2));
+    DataSet ds3;
+    ds3.colNames = {"d"};
+    SequentialIter iter3(std::make_shared<Value>(ds3));
+
+    Row row1;
+    row1.values = {1, 2};
+    Row row2;
+    row2.values = {3, 4};
+    Row row3;
+    row3.values = {5};
+
+    // The column indices are built by the position, not by the name
+    JoinIter joinIter1;
+    joinIter1.joinIndex(&iter1, &iter2);
+    EXPECT_EQ(joinIter1.getColIndices().size(), 3);
+    EXPECT_EQ(joinIter1.getColIdxIndices().size(), 4);
+
+    {
+        JoinIter joinIter2;
+        joinIter2.joinIndex(&joinIter1, &iter3);
+        EXPECT_EQ(joinIter2.getColIdxIndices().size(), 5);
+        joinIter2.addRow({&row1, &row2, &row3}, 5);
+        const auto& row = *joinIter2.row();
+        std::vector<Value> result;
+        for (size_t i = 0; i < 5; ++i) {
+            result.emplace_back(row[i]);
+        }
+        EXPECT_EQ(result, std::vector<Value>({1, 2, 3, 4, 5}));
+        EXPECT_EQ(joinIter2.getColumn("d"), 5);
+    }
+    {
+        JoinIter joinIter2;
+        joinIter2.joinIndex(&iter3, &joinIter1);
+        EXPECT_EQ(joinIter2.getColIdxIndices().size(), 5);
+        joinIter2.addRow({&row3, &row1, &row2}, 5);
+        const auto& row = *joinIter2.row();
+        std::vector<Value> result;
+        for (size_t i = 0; i < 5; ++i) {
+            result.emplace_back(row[i]);
+        }
+        EXPECT_EQ(result, std::vector<Value>({5, 1, 2, 3, 4}));
+        EXPECT_EQ(joinIter2.getColumn("c"), 4);
+    }
+}
+
 TEST(IteratorTest, VertexProp) {
     DataSet ds;
     ds.colNames = {kVid, "tag1.prop1", "tag2.prop1", "tag2.prop2", "tag3.prop1", "tag3.prop2"};
@@ -0,0 +1,108 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "context/PreparedStatement.h"
+
+#include <gtest/gtest.h>
+#include "common/base/Base.h"
+#include "parser/GQLParser.h"
+
+namespace nebula {
+namespace graph {
+
+class PreparedStatementTest : public ::testing::Test {
+protected:
+    static std::shared_ptr<PreparedStatement> makeStatement() {
+        auto qctx = std::make_unique<QueryContext>();
+        qctx->setParamSlots(std::make_unique<ParamSlots>());
+        DataSet vids({"vid"});
+        vids.emplace_back(Row({Value::kNullValue}));
+        vids.emplace_back(Row({"b"}));
+        vids.emplace_back(Row({Value::kNullValue}));
+        qctx->ectx()->setResult("vids", ResultBuilder().value(Value(std::move(vids))).finish());
+        qctx->paramSlots()->add("src", "vids", 0, meta::cpp2::PropertyType::FIXED_STRING);
+        qctx->paramSlots()->add("dst", "vids", 2, meta::cpp2::PropertyType::FIXED_STRING);
+
+        auto result = GQLParser().parse("GO FROM $src, \"b\", $dst OVER like");
+        CHECK(result.ok()) << result.status();
+        return std::make_shared<PreparedStatement>("GO FROM $src, \"b\", $dst OVER like",
+                                                   std::move(result).value(),
+                                                   std::move(qctx),
+                                                   1,
+                                                   "t1:1");
+    }
+
+    static DataSet makeVids(const std::string& src, const std::string& dst) {
+        DataSet vids({"vid"});
+        vids.emplace_back(Row({src}));
+        vids.emplace_back(Row({"b"}));
+        vids.emplace_back(Row({dst}));
+        return vids;
+    }
+};
+
+TEST_F(PreparedStatementTest, Bind) {
+    auto stmt = makeStatement();
+    ASSERT_EQ(2, stmt->params().size());
+    EXPECT_EQ(meta::cpp2::PropertyType::FIXED_STRING, stmt->params().at("src"));
+
+    ASSERT_TRUE(stmt->acquire());
+    // Run by one query at a time
+    EXPECT_FALSE(stmt->acquire());
+    auto status = stmt->bind({{"src", "a"}, {"dst", "c"}});
+    ASSERT_TRUE(status.ok()) << status;
+    EXPECT_EQ(Value(makeVids("a", "c")), stmt->qctx()->ectx()->getValue("vids"));
+    stmt->release();
+
+    // Bound again from the constants
+    ASSERT_TRUE(stmt->acquire());
+    status = stmt->bind({{"src", "d"}, {"dst", "e"}});
+    ASSERT_TRUE(status.ok()) << status;
+    EXPECT_EQ(Value(makeVids("d", "e")), stmt->qctx()->ectx()->getValue("vids"));
+    EXPECT_EQ(1, stmt->qctx()->ectx()->numVersions("vids"));
+    stmt->release();
+}
+
+TEST_F(PreparedStatementTest, BadParams) {
+    auto stmt = makeStatement();
+    ASSERT_TRUE(stmt->acquire());
+    // Not bound
+    EXPECT_FALSE(stmt->bind({{"src", "a"}}).ok());
+    // Unknown
+    EXPECT_FALSE(stmt->bind({{"src", "a"}, {"dst", "c"}, {"id", "d"}}).ok());
+    // Not a vid of the space
+    EXPECT_FALSE(stmt->bind({{"src", "a"}, {"dst", 1}}).ok());
+    stmt->release();
+}
+
+TEST_F(PreparedStatementTest, Replan) {
+    auto stmt = makeStatement();
+    EXPECT_EQ("t1:1", stmt->schemaVersion());
+
+    // Planned again for the new version of the tag
+    auto qctx = std::make_unique<QueryContext>();
+    qctx->setParamSlots(std::make_unique<ParamSlots>());
+    DataSet vids({"vid"});
+    vids.emplace_back(Row({Value::kNullValue}));
+    qctx->ectx()->setResult("src", ResultBuilder().value(Value(std::move(vids))).finish());
+    qctx->paramSlots()->add("src", "src", 0, meta::cpp2::PropertyType::FIXED_STRING);
+    auto sentence = GQLParser().parse("GO FROM $src OVER like");
+    ASSERT_TRUE(sentence.ok()) << sentence.status();
+
+    ASSERT_TRUE(stmt->acquire());
+    stmt->replan(std::move(sentence).value(), std::move(qctx), "t1:2");
+    EXPECT_EQ("t1:2", stmt->schemaVersion());
+    ASSERT_EQ(1, stmt->params().size());
+    auto status = stmt->bind({{"src", "a"}});
+    ASSERT_TRUE(status.ok()) << status;
+    DataSet expected({"vid"});
+    expected.emplace_back(Row({"a"}));
+    EXPECT_EQ(Value(std::move(expected)), stmt->qctx()->ectx()->getValue("src"));
+    stmt->release();
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,147 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "context/QueryLog.h"
+
+#include <gtest/gtest.h>
+#include "common/base/Base.h"
+#include "common/interface/gen-cpp2/graph_types.h"
+#include "context/QueryContext.h"
+#include "service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+class QueryLogTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        QueryLog::instance().clear();
+        threshold_ = FLAGS_slow_query_threshold_us;
+        capacity_ = FLAGS_slow_query_log_capacity;
+    }
+
+    void TearDown() override {
+        QueryLog::instance().clear();
+        FLAGS_slow_query_threshold_us = threshold_;
+        FLAGS_slow_query_log_capacity = capacity_;
+    }
+
+    int64_t threshold_;
+    int32_t capacity_;
+};
+
+TEST_F(QueryLogTest, RunningQueries) {
+    auto& log = QueryLog::instance();
+    auto id1 = log.onStart(1, "root", "nba", "GO FROM 1 OVER like");
+    auto id2 = log.onStart(2, "user", "nba", "FETCH PROP ON player 1");
+    ASSERT_NE(id1, id2);
+
+    auto running = log.runningQueries();
+    ASSERT_EQ(2, running.size());
+    EXPECT_EQ(id1, running[0].queryId);
+    EXPECT_EQ("GO FROM 1 OVER like", running[0].query);
+    EXPECT_EQ(id2, running[1].queryId);
+    EXPECT_EQ("user", running[1].user);
+
+    log.onFinish(id1, 10, Status::OK(), {});
+    running = log.runningQueries();
+    ASSERT_EQ(1, running.size());
+    EXPECT_EQ(id2, running[0].queryId);
+}
+
+TEST_F(QueryLogTest, SlowQueries) {
+    FLAGS_slow_query_threshold_us = 100;
+    FLAGS_slow_query_log_capacity = 2;
+    auto& log = QueryLog::instance();
+
+    auto fast = log.onStart(1, "root", "nba", "YIELD 1");
+    log.onFinish(fast, 99, Status::OK(), {});
+    EXPECT_TRUE(log.slowQueries().empty());
+
+    std::vector<int64_t> ids;
+    for (int i = 0; i < 3; ++i) {
+        auto id = log.onStart(1, "root", "nba", folly::stringPrintf("YIELD %d", i));
+        OperatorStats stats;
+        stats.planNodeId = 1;
+        stats.name = "Project";
+        stats.rows = 1;
+        auto status = i == 2 ? Status::Error("failed") : Status::OK();
+        log.onFinish(id, 100 + i, status, {stats});
+        ids.emplace_back(id);
+    }
+
+    // The oldest one has been evicted from the ring buffer
+    auto slow = log.slowQueries();
+    ASSERT_EQ(2, slow.size());
+    EXPECT_EQ(ids[1], slow[0].queryId);
+    EXPECT_EQ(101, slow[0].latencyInUs);
+    EXPECT_EQ("SUCCEEDED", slow[0].status);
+    ASSERT_EQ(1, slow[0].operators.size());
+    EXPECT_EQ("Project", slow[0].operators[0].name);
+    EXPECT_EQ(ids[2], slow[1].queryId);
+    EXPECT_NE("SUCCEEDED", slow[1].status);
+    EXPECT_TRUE(log.runningQueries().empty());
+
+    FLAGS_slow_query_threshold_us = -1;
+    auto id = log.onStart(1, "root", "nba", "YIELD 3");
+    log.onFinish(id, 1000, Status::OK(), {});
+    EXPECT_EQ(2, log.slowQueries().size());
+}
+
+TEST_F(QueryLogTest, Plan) {
+    FLAGS_slow_query_threshold_us = 100;
+    auto& log = QueryLog::instance();
+    auto plan = std::make_shared<cpp2::PlanDescription>();
+    cpp2::PlanNodeDescription node;
+    node.set_name("Project");
+    node.set_id(1);
+    plan->plan_node_descs.emplace_back(std::move(node));
+
+    auto fast = log.onStart(1, "root", "nba", "YIELD 1");
+    EXPECT_FALSE(QueryLog::isSlow(99));
+    log.onFinish(fast, 99, Status::OK(), {}, plan);
+    auto id = log.onStart(1, "root", "nba", "YIELD 2");
+    EXPECT_TRUE(QueryLog::isSlow(100));
+    log.onFinish(id, 100, Status::OK(), {}, plan);
+
+    auto slow = log.slowQueries();
+    ASSERT_EQ(1, slow.size());
+    ASSERT_NE(nullptr, slow[0].plan);
+    ASSERT_EQ(1, slow[0].plan->get_plan_node_descs().size());
+    EXPECT_EQ("Project", slow[0].plan->get_plan_node_descs()[0].get_name());
+}
+
+TEST_F(QueryLogTest, OperatorStats) {
+    QueryContext qctx;
+    // The nodes in a loop close once for each round
+    for (int64_t i = 0; i < 3; ++i) {
+        OperatorStats stats;
+        stats.planNodeId = 2;
+        stats.name = "GetNeighbors";
+        stats.rows = 10;
+        stats.execDurationInUs = 5;
+        stats.totalDurationInUs = 7;
+        qctx.addOperatorStats(std::move(stats));
+    }
+    OperatorStats stats;
+    stats.planNodeId = 1;
+    stats.name = "Start";
+    qctx.addOperatorStats(std::move(stats));
+
+    auto operators = qctx.moveOperatorStats();
+    ASSERT_EQ(2, operators.size());
+    EXPECT_EQ(1, operators[0].planNodeId);
+    EXPECT_EQ(1, operators[0].executions);
+    EXPECT_EQ(2, operators[1].planNodeId);
+    EXPECT_EQ(3, operators[1].executions);
+    EXPECT_EQ(30, operators[1].rows);
+    EXPECT_EQ(15, operators[1].execDurationInUs);
+    EXPECT_EQ(21, operators[1].totalDurationInUs);
+    EXPECT_TRUE(qctx.moveOperatorStats().empty());
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,203 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "context/QueryResultCache.h"
+
+#include <gtest/gtest.h>
+#include "common/base/Base.h"
+#include "parser/GQLParser.h"
+#include "service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+class QueryResultCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        QueryResultCache::instance().clear();
+        capacity_ = FLAGS_query_result_cache_capacity_mb;
+        ttl_ = FLAGS_query_result_cache_ttl_secs;
+    }
+
+    void TearDown() override {
+        QueryResultCache::instance().clear();
+        FLAGS_query_result_cache_capacity_mb = capacity_;
+        FLAGS_query_result_cache_ttl_secs = ttl_;
+    }
+
+    static DataSet makeResult(const std::string& dst) {
+        DataSet ds({"like._dst"});
+        ds.rows.emplace_back(Row({dst}));
+        return ds;
+    }
+
+    static std::unique_ptr<Sentence> parse(const std::string& query) {
+        auto result = GQLParser().parse(query);
+        CHECK(result.ok()) << result.status();
+        return std::move(result).value();
+    }
+
+    int64_t     capacity_;
+    int32_t     ttl_;
+};
+
+TEST_F(QueryResultCacheTest, Normalize) {
+    EXPECT_EQ("GO FROM \"a\" OVER like",
+              QueryResultCache::normalize("  GO   FROM \"a\"\n\tOVER like ; "));
+    // The blanks in the quotes are kept
+    EXPECT_EQ("FETCH PROP ON person \"a  b\"",
+              QueryResultCache::normalize("FETCH PROP ON person  \"a  b\";;"));
+    EXPECT_EQ("YIELD 'a \\'  b'", QueryResultCache::normalize("YIELD  'a \\'  b'"));
+}
+
+TEST_F(QueryResultCacheTest, GetAndPut) {
+    auto& cache = QueryResultCache::instance();
+    EXPECT_EQ(nullptr, cache.get(1, "ADMIN", "GO FROM \"a\" OVER like"));
+
+    cache.put(1, "ADMIN", "GO FROM \"a\" OVER like", cache.version(), makeResult("b"));
+    auto result = cache.get(1, "ADMIN", "GO FROM \"a\" OVER like");
+    ASSERT_NE(nullptr, result);
+    EXPECT_EQ(makeResult("b"), *result);
+
+    // Never shared by the other roles or spaces
+    EXPECT_EQ(nullptr, cache.get(1, "GUEST", "GO FROM \"a\" OVER like"));
+    EXPECT_EQ(nullptr, cache.get(2, "ADMIN", "GO FROM \"a\" OVER like"));
+
+    // Replaced by the latest
+    cache.put(1, "ADMIN", "GO FROM \"a\" OVER like", cache.version(), makeResult("c"));
+    result = cache.get(1, "ADMIN", "GO FROM \"a\" OVER like");
+    ASSERT_NE(nullptr, result);
+    EXPECT_EQ(makeResult("c"), *result);
+    EXPECT_EQ(1, cache.size());
+}
+
+TEST_F(QueryResultCacheTest, Expired) {
+    FLAGS_query_result_cache_ttl_secs = -1;
+    auto& cache = QueryResultCache::instance();
+    cache.put(1, "ADMIN", "GO FROM \"a\" OVER like", cache.version(), makeResult("b"));
+    EXPECT_EQ(nullptr, cache.get(1, "ADMIN", "GO FROM \"a\" OVER like"));
+    EXPECT_EQ(0, cache.size());
+}
+
+TEST_F(QueryResultCacheTest, Evict) {
+    FLAGS_query_result_cache_capacity_mb = 1;
+    auto& cache = QueryResultCache::instance();
+    std::string dst(4096, 'x');
+    for (auto i = 0; i < 1000; ++i) {
+        cache.put(1, "ADMIN", folly::to<std::string>(i), cache.version(), makeResult(dst));
+    }
+    EXPECT_LT(cache.size(), 1024 * 1024 / dst.size());
+    // The latest one is still there
+    EXPECT_NE(nullptr, cache.get(1, "ADMIN", "999"));
+    EXPECT_EQ(nullptr, cache.get(1, "ADMIN", "0"));
+}
+
+TEST_F(QueryResultCacheTest, Invalidate) {
+    auto& cache = QueryResultCache::instance();
+    cache.put(1, "ADMIN", "GO FROM \"a\" OVER like", cache.version(), makeResult("b"));
+    cache.put(2, "ADMIN", "GO FROM \"a\" OVER like", cache.version(), makeResult("b"));
+
+    // Started before the modification
+    auto version = cache.version();
+    cache.invalidate(1);
+    EXPECT_EQ(nullptr, cache.get(1, "ADMIN", "GO FROM \"a\" OVER like"));
+    EXPECT_NE(nullptr, cache.get(2, "ADMIN", "GO FROM \"a\" OVER like"));
+    cache.put(1, "ADMIN", "GO FROM \"a\" OVER like", version, makeResult("b"));
+    EXPECT_EQ(nullptr, cache.get(1, "ADMIN", "GO FROM \"a\" OVER like"));
+
+    // Started after the modification
+    cache.put(1, "ADMIN", "GO FROM \"a\" OVER like", cache.version(), makeResult("c"));
+    auto result = cache.get(1, "ADMIN", "GO FROM \"a\" OVER like");
+    ASSERT_NE(nullptr, result);
+    EXPECT_EQ(makeResult("c"), *result);
+}
+
+TEST_F(QueryResultCacheTest, Sentences) {
+    auto isCacheable = [](const std::string& query) {
+        return QueryResultCache::isCacheable(parse(query).get());
+    };
+    auto mayModify = [](const std::string& query) {
+        return QueryResultCache::mayModify(parse(query).get());
+    };
+
+    EXPECT_TRUE(isCacheable("GO FROM \"a\" OVER like"));
+    EXPECT_TRUE(isCacheable("GO FROM \"a\" OVER like YIELD like._dst AS id | "
+                            "FETCH PROP ON person $-.id"));
+    EXPECT_TRUE(isCacheable("GO FROM \"a\" OVER like YIELD like._dst AS id | LIMIT 10"));
+    EXPECT_TRUE(isCacheable("LOOKUP ON person WHERE person.age > 10"));
+    EXPECT_FALSE(isCacheable("YIELD 1"));
+    EXPECT_FALSE(isCacheable("USE nba; GO FROM \"a\" OVER like"));
+    EXPECT_FALSE(isCacheable("$a = GO FROM \"a\" OVER like"));
+    EXPECT_FALSE(isCacheable("EXPLAIN GO FROM \"a\" OVER like"));
+    EXPECT_FALSE(isCacheable("SHOW SPACES"));
+    EXPECT_FALSE(isCacheable("INSERT VERTEX person(name) VALUES \"a\":(\"a\")"));
+
+    EXPECT_FALSE(mayModify("GO FROM \"a\" OVER like"));
+    EXPECT_FALSE(mayModify("USE nba; SHOW TAGS"));
+    EXPECT_FALSE(mayModify("EXPLAIN INSERT VERTEX person(name) VALUES \"a\":(\"a\")"));
+    EXPECT_TRUE(mayModify("PROFILE INSERT VERTEX person(name) VALUES \"a\":(\"a\")"));
+    EXPECT_TRUE(mayModify("INSERT VERTEX person(name) VALUES \"a\":(\"a\")"));
+    EXPECT_TRUE(mayModify("GO FROM \"a\" OVER like YIELD like._dst AS id | "
+                          "DELETE VERTEX $-.id"));
+    EXPECT_TRUE(mayModify("CREATE TAG t(name string)"));
+    EXPECT_TRUE(mayModify("USE nba; DROP TAG t"));
+}
+
+TEST_F(QueryResultCacheTest, Deterministic) {
+    EXPECT_TRUE(QueryResultCache::isDeterministic("GO FROM \"a\" OVER like"));
+    EXPECT_TRUE(QueryResultCache::isDeterministic(
+        "LOOKUP ON person WHERE person.birth > timestamp(\"2020-01-01T00:00:00\")"));
+    // Not called in the quotes
+    EXPECT_TRUE(QueryResultCache::isDeterministic("FETCH PROP ON person \"rand()\""));
+    EXPECT_TRUE(QueryResultCache::isDeterministic("GO FROM \"a\" OVER like YIELD like.`now`"));
+
+    EXPECT_FALSE(QueryResultCache::isDeterministic(
+        "GO FROM \"a\" OVER like WHERE rand32(10) > 5"));
+    EXPECT_FALSE(QueryResultCache::isDeterministic("GO FROM \"a\" OVER like YIELD NOW ()"));
+    EXPECT_FALSE(QueryResultCache::isDeterministic(
+        "LOOKUP ON person WHERE person.birth > timestamp( )"));
+    EXPECT_FALSE(QueryResultCache::isDeterministic("FETCH PROP ON person uuid(\"a\")"));
+}
+
+TEST_F(QueryResultCacheTest, ModifiedSpaces) {
+    auto modifiedSpaces = [](const std::string& query, std::vector<std::string>* spaces) {
+        std::string space = "nba";
+        return QueryResultCache::modifiedSpaces(parse(query).get(), &space, spaces);
+    };
+    {
+        std::vector<std::string> spaces;
+        ASSERT_TRUE(modifiedSpaces("INSERT VERTEX person(name) VALUES \"a\":(\"a\")", &spaces));
+        EXPECT_EQ(std::vector<std::string>({"nba"}), spaces);
+    }
+    {
+        // Switched by the USE in the sentences
+        std::vector<std::string> spaces;
+        ASSERT_TRUE(modifiedSpaces("USE test; DELETE VERTEX \"a\"; USE nba; SHOW TAGS",
+                                   &spaces));
+        EXPECT_EQ(std::vector<std::string>({"test"}), spaces);
+    }
+    {
+        std::vector<std::string> spaces;
+        ASSERT_TRUE(modifiedSpaces("DROP SPACE test", &spaces));
+        EXPECT_EQ(std::vector<std::string>({"test"}), spaces);
+    }
+    {
+        std::vector<std::string> spaces;
+        ASSERT_TRUE(modifiedSpaces("GO FROM \"a\" OVER like YIELD like._dst AS id | "
+                                   "DELETE VERTEX $-.id",
+                                   &spaces));
+        EXPECT_EQ(std::vector<std::string>({"nba"}), spaces);
+    }
+    {
+        // The schema is changed
+        std::vector<std::string> spaces;
+        EXPECT_FALSE(modifiedSpaces("USE test; CREATE TAG t(name string)", &spaces));
+        EXPECT_FALSE(modifiedSpaces("DROP USER u", &spaces));
+    }
+}
+
+}   // namespace graph
+}   // namespace nebula
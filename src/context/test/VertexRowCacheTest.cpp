@@ -0,0 +1,155 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "context/VertexRowCache.h"
+
+#include <gtest/gtest.h>
+#include "common/base/Base.h"
+#include "service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+class VertexRowCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        VertexRowCache::instance(VertexRowCache::Kind::kNeighbor).clear();
+        capacity_ = FLAGS_neighbor_cache_capacity_mb;
+        ttl_ = FLAGS_neighbor_cache_ttl_secs;
+        colNames_ = std::make_shared<const std::vector<std::string>>(
+            std::vector<std::string>{kVid, "_stats", "_edge:+like:_dst", "_expr"});
+    }
+
+    void TearDown() override {
+        VertexRowCache::instance(VertexRowCache::Kind::kNeighbor).clear();
+        VertexRowCache::instance(VertexRowCache::Kind::kVertexProp).clear();
+        FLAGS_enable_neighbor_cache = false;
+        FLAGS_enable_vertex_cache = false;
+        FLAGS_neighbor_cache_capacity_mb = capacity_;
+        FLAGS_neighbor_cache_ttl_secs = ttl_;
+    }
+
+    static Row makeRow(const std::string& vid, const std::string& dst) {
+        return Row({vid, Value(), List({List({dst})}), Value()});
+    }
+
+    int64_t                     capacity_;
+    int32_t                     ttl_;
+    VertexRowCache::ColNames     colNames_;
+};
+
+TEST_F(VertexRowCacheTest, GetAndPut) {
+    auto& cache = VertexRowCache::instance(VertexRowCache::Kind::kNeighbor);
+    Row row;
+    VertexRowCache::ColNames colNames;
+    EXPECT_FALSE(cache.get(1, "out", "a", &row, &colNames));
+
+    cache.put(1, "out", "a", makeRow("a", "b"), colNames_);
+    ASSERT_TRUE(cache.get(1, "out", "a", &row, &colNames));
+    EXPECT_EQ(makeRow("a", "b"), row);
+    EXPECT_EQ(*colNames_, *colNames);
+
+    // The others requests and spaces are not the same
+    EXPECT_FALSE(cache.get(1, "in", "a", &row, &colNames));
+    EXPECT_FALSE(cache.get(2, "out", "a", &row, &colNames));
+
+    // Replaced by the latest
+    cache.put(1, "out", "a", makeRow("a", "c"), colNames_);
+    ASSERT_TRUE(cache.get(1, "out", "a", &row, &colNames));
+    EXPECT_EQ(makeRow("a", "c"), row);
+    EXPECT_EQ(1, cache.size());
+}
+
+TEST_F(VertexRowCacheTest, Invalidate) {
+    auto& cache = VertexRowCache::instance(VertexRowCache::Kind::kNeighbor);
+    cache.put(1, "out", "a", makeRow("a", "b"), colNames_);
+    cache.put(1, "in", "a", makeRow("a", "c"), colNames_);
+    cache.put(1, "out", "b", makeRow("b", "c"), colNames_);
+    cache.put(2, "out", "a", makeRow("a", "b"), colNames_);
+    EXPECT_EQ(4, cache.size());
+
+    cache.invalidate(1, "a");
+    Row row;
+    VertexRowCache::ColNames colNames;
+    EXPECT_FALSE(cache.get(1, "out", "a", &row, &colNames));
+    EXPECT_FALSE(cache.get(1, "in", "a", &row, &colNames));
+    EXPECT_TRUE(cache.get(1, "out", "b", &row, &colNames));
+    EXPECT_TRUE(cache.get(2, "out", "a", &row, &colNames));
+    EXPECT_EQ(2, cache.size());
+}
+
+TEST_F(VertexRowCacheTest, Expired) {
+    FLAGS_neighbor_cache_ttl_secs = -1;
+    auto& cache = VertexRowCache::instance(VertexRowCache::Kind::kNeighbor);
+    cache.put(1, "out", "a", makeRow("a", "b"), colNames_);
+    Row row;
+    VertexRowCache::ColNames colNames;
+    EXPECT_FALSE(cache.get(1, "out", "a", &row, &colNames));
+    EXPECT_EQ(0, cache.size());
+}
+
+TEST_F(VertexRowCacheTest, Evict) {
+    FLAGS_neighbor_cache_capacity_mb = 1;
+    auto& cache = VertexRowCache::instance(VertexRowCache::Kind::kNeighbor);
+    // Far beyond the capacity of a shard
+    std::string dst(4096, 'x');
+    for (auto i = 0; i < 10000; ++i) {
+        auto vid = folly::to<std::string>(i);
+        cache.put(1, "out", vid, makeRow(vid, dst), colNames_);
+    }
+    EXPECT_LT(cache.size(), 1024 * 1024 / dst.size());
+    // The latest one is still there
+    Row row;
+    VertexRowCache::ColNames colNames;
+    EXPECT_TRUE(cache.get(1, "out", "9999", &row, &colNames));
+}
+
+TEST_F(VertexRowCacheTest, Lookup) {
+    auto& cache = VertexRowCache::instance(VertexRowCache::Kind::kVertexProp);
+    DataSet ds;
+    ds.colNames = {kVid, "player.name"};
+    ds.rows = {Row({"a", "Tim"}), Row({"b", "Tony"})};
+    cache.putAll(1, "player", ds);
+
+    std::vector<Row> rows = {Row({"a"}), Row({"c"}), Row({"b"})};
+    std::vector<DataSet> cached;
+    cache.lookup(1, "player", &rows, &cached);
+    EXPECT_EQ(std::vector<Row>{Row({"c"})}, rows);
+    ASSERT_EQ(1, cached.size());
+    EXPECT_EQ(ds, cached.front());
+}
+
+TEST_F(VertexRowCacheTest, InvalidateAll) {
+    FLAGS_enable_neighbor_cache = true;
+    FLAGS_enable_vertex_cache = true;
+    auto& neighbors = VertexRowCache::instance(VertexRowCache::Kind::kNeighbor);
+    auto& props = VertexRowCache::instance(VertexRowCache::Kind::kVertexProp);
+    neighbors.put(1, "out", "a", makeRow("a", "b"), colNames_);
+    props.put(1, "player", "a", Row({"a", "Tim"}), colNames_);
+    props.put(1, "player", "b", Row({"b", "Tony"}), colNames_);
+
+    VertexRowCache::invalidateAll(1, "a");
+    EXPECT_EQ(0, neighbors.size());
+    EXPECT_EQ(1, props.size());
+}
+
+TEST_F(VertexRowCacheTest, InvalidateSpace) {
+    auto& cache = VertexRowCache::instance(VertexRowCache::Kind::kNeighbor);
+    cache.put(1, "out", "a", makeRow("a", "b"), colNames_);
+    cache.put(1, "in", "b", makeRow("b", "a"), colNames_);
+    cache.put(2, "out", "a", makeRow("a", "b"), colNames_);
+
+    cache.invalidateSpace(1);
+    Row row;
+    VertexRowCache::ColNames colNames;
+    EXPECT_FALSE(cache.get(1, "out", "a", &row, &colNames));
+    EXPECT_FALSE(cache.get(1, "in", "b", &row, &colNames));
+    EXPECT_TRUE(cache.get(2, "out", "a", &row, &colNames));
+    EXPECT_EQ(1, cache.size());
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -25,6 +25,7 @@
 #include "executor/admin/ListUserRolesExecutor.h"
 #include "executor/admin/ListUsersExecutor.h"
 #include "executor/admin/PartExecutor.h"
+#include "executor/admin/QueriesExecutor.h"
 #include "executor/admin/RevokeRoleExecutor.h"
 #include "executor/admin/ShowBalanceExecutor.h"
 #include "executor/admin/ShowHostsExecutor.h"
@@ -35,6 +36,7 @@
 #include "executor/admin/SwitchSpaceExecutor.h"
 #include "executor/admin/UpdateUserExecutor.h"
 #include "executor/algo/BFSShortestPathExecutor.h"
+#include "executor/algo/DijkstraShortestPathExecutor.h"
 #include "executor/algo/ProduceSemiShortestPathExecutor.h"
 #include "executor/algo/ConjunctPathExecutor.h"
 #include "executor/algo/ProduceAllPathsExecutor.h"
@@ -56,8 +58,11 @@
 #include "executor/query/FilterExecutor.h"
 #include "executor/query/GetEdgesExecutor.h"
 #include "executor/query/GetNeighborsExecutor.h"
+#include "executor/query/GetNeighborsProjectDedupExecutor.h"
 #include "executor/query/GetVerticesExecutor.h"
 #include "executor/query/IndexScanExecutor.h"
+#include "executor/query/ScanVerticesExecutor.h"
+#include "executor/query/TraverseExecutor.h"
 #include "executor/query/IntersectExecutor.h"
 #include "executor/query/LimitExecutor.h"
 #include "executor/query/MinusExecutor.h"
@@ -71,6 +76,8 @@
 #include "planner/Mutate.h"
 #include "planner/PlanNode.h"
 #include "planner/Query.h"
+#include "service/GraphFlags.h"
+#include "util/GraphStats.h"
 #include "util/ObjectPool.h"
 #include "util/ScopedTimer.h"
 
@@ -139,7 +146,7 @@ Executor *Executor::makeExecutor(const PlanNode *node,
 
 // static
 Executor *Executor::makeExecutor(QueryContext *qctx, const PlanNode *node) {
-    auto pool = qctx->objPool();
+    auto pool = qctx->execPool();
     switch (node->kind()) {
         case PlanNode::Kind::kPassThrough: {
             return pool->add(new PassThroughExecutor(node, qctx));
@@ -174,6 +181,15 @@ Executor *Executor::makeExecutor(QueryContext *qctx, const PlanNode *node) {
         case PlanNode::Kind::kIndexScan: {
             return pool->add(new IndexScanExecutor(node, qctx));
         }
+        case PlanNode::Kind::kScanVertices: {
+            return pool->add(new ScanVerticesExecutor(node, qctx));
+        }
+        case PlanNode::Kind::kTraverse: {
+            return pool->add(new TraverseExecutor(node, qctx));
+        }
+        case PlanNode::Kind::kGetNeighborsProjectDedup: {
+            return pool->add(new GetNeighborsProjectDedupExecutor(node, qctx));
+        }
         case PlanNode::Kind::kStart: {
             return pool->add(new StartExecutor(node, qctx));
         }
@@ -375,6 +391,9 @@ Executor *Executor::makeExecutor(QueryContext *qctx, const PlanNode *node) {
         case PlanNode::Kind::kShowCollation: {
             return pool->add(new ShowCollationExecutor(node, qctx));
         }
+        case PlanNode::Kind::kShowQueries: {
+            return pool->add(new ShowQueriesExecutor(node, qctx));
+        }
         case PlanNode::Kind::kBFSShortest: {
             return pool->add(new BFSShortestPathExecutor(node, qctx));
         }
@@ -387,6 +406,9 @@ Executor *Executor::makeExecutor(QueryContext *qctx, const PlanNode *node) {
         case PlanNode::Kind::kProduceAllPaths: {
             return pool->add(new ProduceAllPathsExecutor(node, qctx));
         }
+        case PlanNode::Kind::kDijkstraShortest: {
+            return pool->add(new DijkstraShortestPathExecutor(node, qctx));
+        }
         case PlanNode::Kind::kUnknown: {
             break;
         }
@@ -418,14 +440,33 @@ Status Executor::open() {
 }
 
 Status Executor::close() {
-    cpp2::ProfilingStats stats;
-    stats.set_total_duration_in_us(totalDuration_.elapsedInUSec());
-    stats.set_rows(numRows_);
-    stats.set_exec_duration_in_us(execTime_);
-    qctx()->addProfilingData(node_->id(), std::move(stats));
+    addProfilingStats(node_, numRows_, execTime_, totalDuration_.elapsedInUSec());
     return Status::OK();
 }
 
+void Executor::recycle() {}
+
+void Executor::addProfilingStats(const PlanNode *node,
+                                 int64_t rows,
+                                 int64_t execTimeInUs,
+                                 int64_t totalDurationInUs) {
+    cpp2::ProfilingStats stats;
+    stats.set_total_duration_in_us(totalDurationInUs);
+    stats.set_rows(rows);
+    stats.set_exec_duration_in_us(execTimeInUs);
+    GraphStats::addExecutorStats(node->kind(), totalDurationInUs, rows);
+    if (FLAGS_enable_lightweight_profiling) {
+        OperatorStats opStats;
+        opStats.planNodeId = node->id();
+        opStats.name = PlanNode::toString(node->kind());
+        opStats.rows = rows;
+        opStats.execDurationInUs = execTimeInUs;
+        opStats.totalDurationInUs = totalDurationInUs;
+        qctx()->addOperatorStats(std::move(opStats));
+    }
+    qctx()->addProfilingData(node->id(), std::move(stats));
+}
+
 folly::Future<Status> Executor::start(Status status) const {
     return folly::makeFuture(std::move(status)).via(runner());
 }
@@ -436,6 +477,9 @@ folly::Future<Status> Executor::error(Status status) const {
 
 Status Executor::finish(Result &&result) {
     numRows_ = result.size();
+    if (result.state() == Result::State::kPartialSuccess) {
+        qctx()->markPartialSuccess();
+    }
     ectx_->setResult(node()->outputVar(), std::move(result));
     return Status::OK();
 }
@@ -44,6 +44,11 @@ public:
     // Cleanup or reset executor some states after each execution
     virtual Status close();
 
+    // Drop the states kept across the executions, e.g. by the iterations of a
+    // loop, before the executor is reused to run the plan again. The memory
+    // allocated for them is kept if possible.
+    virtual void recycle();
+
     QueryContext *qctx() const {
         return qctx_;
     }
@@ -103,6 +108,12 @@ protected:
     // Store the default result which not used for later executor
     Status finish(Value &&value);
 
+    // Report the profiling stats of the plan node, called by `close'
+    void addProfilingStats(const PlanNode *node,
+                           int64_t rows,
+                           int64_t execTimeInUs,
+                           int64_t totalDurationInUs);
+
     int64_t id_;
 
     // Executor name
@@ -0,0 +1,91 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "executor/admin/QueriesExecutor.h"
+
+#include "common/interface/gen-cpp2/graph_types.h"
+#include "common/time/WallClock.h"
+#include "context/QueryContext.h"
+#include "context/QueryLog.h"
+#include "planner/Admin.h"
+#include "util/ScopedTimer.h"
+
+namespace nebula {
+namespace graph {
+
+folly::Future<Status> ShowQueriesExecutor::execute() {
+    SCOPED_TIMER(&execTime_);
+
+    auto *showQueries = asNode<ShowQueries>(node());
+    if (showQueries->isSlow()) {
+        return showSlowQueries();
+    }
+    return showRunningQueries();
+}
+
+folly::Future<Status> ShowQueriesExecutor::showRunningQueries() {
+    DataSet dataSet({"QueryId", "SessionId", "User", "Space", "StartTime", "Duration(us)",
+                     "Query"});
+    auto now = time::WallClock::fastNowInMicroSec();
+    for (auto &query : QueryLog::instance().runningQueries()) {
+        Row row;
+        row.values.emplace_back(query.queryId);
+        row.values.emplace_back(query.sessionId);
+        row.values.emplace_back(std::move(query.user));
+        row.values.emplace_back(std::move(query.space));
+        row.values.emplace_back(query.startTime);
+        row.values.emplace_back(std::max<int64_t>(now - query.startTime, 0));
+        row.values.emplace_back(std::move(query.query));
+        dataSet.emplace_back(std::move(row));
+    }
+    return finish(ResultBuilder().value(Value(std::move(dataSet))).finish());
+}
+
+folly::Future<Status> ShowQueriesExecutor::showSlowQueries() {
+    DataSet dataSet({"QueryId", "SessionId", "User", "Space", "StartTime", "Latency(us)",
+                     "Status", "Query", "Operators", "Plan"});
+    for (auto &query : QueryLog::instance().slowQueries()) {
+        Row row;
+        row.values.emplace_back(query.queryId);
+        row.values.emplace_back(query.sessionId);
+        row.values.emplace_back(std::move(query.user));
+        row.values.emplace_back(std::move(query.space));
+        row.values.emplace_back(query.startTime);
+        row.values.emplace_back(query.latencyInUs);
+        row.values.emplace_back(std::move(query.status));
+        row.values.emplace_back(std::move(query.query));
+        List operators;
+        operators.values.reserve(query.operators.size());
+        for (auto &op : query.operators) {
+            operators.values.emplace_back(op.toString());
+        }
+        row.values.emplace_back(std::move(operators));
+        row.values.emplace_back(describePlan(query.plan.get()));
+        dataSet.emplace_back(std::move(row));
+    }
+    return finish(ResultBuilder().value(Value(std::move(dataSet))).finish());
+}
+
+// static
+Value ShowQueriesExecutor::describePlan(const cpp2::PlanDescription *plan) {
+    if (plan == nullptr) {
+        return Value::kNullValue;
+    }
+    List nodes;
+    nodes.values.reserve(plan->get_plan_node_descs().size());
+    for (auto &node : plan->get_plan_node_descs()) {
+        std::string deps;
+        if (node.get_dependencies() != nullptr) {
+            deps = folly::join(",", *node.get_dependencies());
+        }
+        nodes.values.emplace_back(folly::stringPrintf(
+            "%s(id:%ld, deps:[%s])", node.get_name().c_str(), node.get_id(), deps.c_str()));
+    }
+    return Value(std::move(nodes));
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,34 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef EXECUTOR_ADMIN_QUERIESEXECUTOR_H_
+#define EXECUTOR_ADMIN_QUERIESEXECUTOR_H_
+
+#include "executor/Executor.h"
+
+namespace nebula {
+namespace graph {
+
+class ShowQueriesExecutor final : public Executor {
+public:
+    ShowQueriesExecutor(const PlanNode *node, QueryContext *qctx)
+        : Executor("ShowQueriesExecutor", node, qctx) {}
+
+    folly::Future<Status> execute() override;
+
+private:
+    folly::Future<Status> showRunningQueries();
+
+    folly::Future<Status> showSlowQueries();
+
+    // The nodes of the plan with their dependencies, NULL if it's not kept
+    static Value describePlan(const cpp2::PlanDescription *plan);
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // EXECUTOR_ADMIN_QUERIESEXECUTOR_H_
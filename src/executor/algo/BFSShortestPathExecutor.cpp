@@ -49,5 +49,9 @@ folly::Future<Status> BFSShortestPathExecutor::execute() {
     }
     return finish(ResultBuilder().value(Value(std::move(ds))).finish());
 }
+
+void BFSShortestPathExecutor::recycle() {
+    visited_.clear();
+}
 }  // namespace graph
 }  // namespace nebula
@@ -18,6 +18,8 @@ public:
 
     folly::Future<Status> execute() override;
 
+    void recycle() override;
+
 private:
     std::unordered_set<Value>               visited_;
 };
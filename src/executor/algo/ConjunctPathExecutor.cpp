@@ -25,6 +25,14 @@ folly::Future<Status> ConjunctPathExecutor::execute() {
     }
 }
 
+void ConjunctPathExecutor::recycle() {
+    forward_.clear();
+    backward_.clear();
+    count_ = 0;
+    backwardIndices_.clear();
+    shortestCost_.clear();
+}
+
 folly::Future<Status> ConjunctPathExecutor::bfsShortestPath() {
     auto* conjunct = asNode<ConjunctPath>(node());
     auto lIter = ectx_->getResult(conjunct->leftInputVar()).iter();
@@ -185,38 +193,57 @@ folly::Future<Status> ConjunctPathExecutor::floydShortestPath() {
     DataSet ds;
     ds.colNames = conjunct->colNames();
 
-    CostPathsValMap forwardCostPathMap;
-    for (; lIter->valid(); lIter->next()) {
-        auto& dst = lIter->getColumn(kDst);
-        auto& src = lIter->getColumn(kSrc);
-        auto cost = lIter->getColumn("cost");
-
-        auto& pathList = lIter->getColumn("paths");
-        if (!pathList.isList()) {
-            continue;
-        }
-        auto& srcPaths = forwardCostPathMap[dst];
-        srcPaths.emplace(src, CostPaths(cost, pathList.getList()));
-    }
-
     if (rHist.size() >= 2) {
-        auto previous = rHist[rHist.size() - 2].iter();
         VLOG(1) << "Find odd length path.";
-        findPath(previous.get(), forwardCostPathMap, ds);
+        findPath(lIter.get(), backwardIndex(rHist, rHist.size() - 2), ds);
     }
 
     if (count_ * 2 < steps) {
         VLOG(1) << "Find even length path.";
-        auto latest = rHist.back().iter();
-        findPath(latest.get(), forwardCostPathMap, ds);
+        lIter->reset();
+        findPath(lIter.get(), backwardIndex(rHist, rHist.size() - 1), ds);
     }
 
     return finish(ResultBuilder().value(Value(std::move(ds))).finish());
 }
 
+const ConjunctPathExecutor::BackwardIndex& ConjunctPathExecutor::backwardIndex(
+    const std::vector<Result>& hist,
+    size_t version) {
+    auto found = backwardIndices_.find(version);
+    if (found != backwardIndices_.end()) {
+        return found->second;
+    }
+    // The latest version of this round is the previous one of the next round,
+    // so the older ones will never be probed again.
+    for (auto it = backwardIndices_.begin(); it != backwardIndices_.end();) {
+        if (it->first + 1 < version) {
+            it = backwardIndices_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    auto& index = backwardIndices_[version];
+    // The values of the history are kept by the execution context during the loop
+    for (auto iter = hist[version].iter(); iter->valid(); iter->next()) {
+        auto& pathList = iter->getColumn("paths");
+        if (!pathList.isList()) {
+            continue;
+        }
+        auto& dst = iter->getColumn(kDst);
+        auto& src = iter->getColumn(kSrc);
+        // The end vids themselves are the start of the backward search
+        auto& endVid = src.type() == Value::Type::__EMPTY__ ? dst : src;
+        index[dst].emplace_back(
+            BackwardPaths{endVid, iter->getColumn("cost"), &pathList.getList()});
+    }
+    return index;
+}
+
 Status ConjunctPathExecutor::conjunctPath(const List& forwardPaths,
                                           const List& backwardPaths,
-                                          Value& cost,
+                                          const Value& cost,
                                           DataSet& ds) {
     for (auto& i : forwardPaths.values) {
         if (!i.isPath()) {
@@ -243,39 +270,56 @@ Status ConjunctPathExecutor::conjunctPath(const List& forwardPaths,
     return Status::OK();
 }
 
-bool ConjunctPathExecutor::findPath(Iterator* backwardPathIter,
-                                    CostPathsValMap& forwardPathTable,
+bool ConjunctPathExecutor::findPath(Iterator* forwardPathIter,
+                                    const BackwardIndex& backwardIndex,
                                     DataSet& ds) {
-    bool found = false;
-    for (; backwardPathIter->valid(); backwardPathIter->next()) {
-        auto& dst = backwardPathIter->getColumn(kDst);
-        auto& endVid = backwardPathIter->getColumn(kSrc);
-        auto cost = backwardPathIter->getColumn("cost");
-        VLOG(1) << "Backward dst: " << dst;
-        auto& pathList = backwardPathIter->getColumn("paths");
+    // Hash join the forward paths with the backward ones on the meeting vid,
+    // and keep the cheapest meets of each pair before building any path.
+    MeetsMap meets;
+    for (; forwardPathIter->valid(); forwardPathIter->next()) {
+        auto& pathList = forwardPathIter->getColumn("paths");
         if (!pathList.isList()) {
             continue;
         }
-        auto forwardPaths = forwardPathTable.find(dst);
-        if (forwardPaths == forwardPathTable.end()) {
+        auto& dst = forwardPathIter->getColumn(kDst);
+        VLOG(1) << "Forward dst: " << dst;
+        auto backwardPaths = backwardIndex.find(dst);
+        if (backwardPaths == backwardIndex.end()) {
             continue;
         }
-        for (auto& srcPaths : forwardPaths->second) {
-            auto& startVid = srcPaths.first;
-            auto totalCost = cost + srcPaths.second.cost_;
-            if (historyCostMap_.find(startVid) != historyCostMap_.end() &&
-                historyCostMap_[startVid].find(endVid) != historyCostMap_[startVid].end() &&
-                historyCostMap_[startVid][endVid] < totalCost) {
+        auto& startVid = forwardPathIter->getColumn(kSrc);
+        auto& cost = forwardPathIter->getColumn("cost");
+        for (auto& backward : backwardPaths->second) {
+            auto key = std::make_pair(startVid, backward.endVid);
+            auto totalCost = cost + backward.cost;
+            auto shortest = shortestCost_.find(key);
+            if (shortest != shortestCost_.end() && !(totalCost < shortest->second)) {
+                // Found in the previous passes
                 continue;
             }
-            // update history cost
-            auto& hist = historyCostMap_[startVid];
-            hist[endVid] = totalCost;
-            conjunctPath(srcPaths.second.paths_, pathList.getList(), totalCost, ds);
-            found = true;
+            auto meet = meets.find(key);
+            if (meet == meets.end()) {
+                meets.emplace(std::move(key), Meets{std::move(totalCost), {}})
+                    .first->second.paths.emplace_back(&pathList.getList(), backward.paths);
+                continue;
+            }
+            if (totalCost < meet->second.cost) {
+                meet->second.cost = std::move(totalCost);
+                meet->second.paths.clear();
+            } else if (meet->second.cost < totalCost) {
+                continue;
+            }
+            meet->second.paths.emplace_back(&pathList.getList(), backward.paths);
         }
     }
-    return found;
+
+    for (auto& meet : meets) {
+        shortestCost_[meet.first] = meet.second.cost;
+        for (auto& paths : meet.second.paths) {
+            conjunctPath(*paths.first, *paths.second, meet.second.cost, ds);
+        }
+    }
+    return !meets.empty();
 }
 
 folly::Future<Status> ConjunctPathExecutor::allPaths() {
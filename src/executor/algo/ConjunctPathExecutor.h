@@ -7,6 +7,8 @@
 #ifndef EXECUTOR_ALGO_CONJUNCTPATHEXECUTOR_H_
 #define EXECUTOR_ALGO_CONJUNCTPATHEXECUTOR_H_
 
+#include <folly/hash/Hash.h>
+
 #include "executor/Executor.h"
 
 namespace nebula {
@@ -18,14 +20,33 @@ public:
 
     folly::Future<Status> execute() override;
 
-    struct CostPaths {
-        CostPaths(Value& cost, const List& paths) : cost_(cost), paths_(paths) {}
-        Value cost_;
-        const List& paths_;
-    };
+    void recycle() override;
 
 private:
-    using CostPathsValMap = std::unordered_map<Value, std::unordered_map<Value, CostPaths>>;
+    // The backward paths from the end vid to the meeting vid
+    struct BackwardPaths {
+        Value           endVid;
+        Value           cost;
+        const List*     paths;
+    };
+
+    // meeting vid : {BackwardPaths}, built once for each version of the backward result
+    using BackwardIndex = std::unordered_map<Value, std::vector<BackwardPaths>>;
+
+    struct PairHash {
+        size_t operator()(const std::pair<Value, Value>& pair) const {
+            return folly::hash::hash_combine(std::hash<Value>()(pair.first),
+                                             std::hash<Value>()(pair.second));
+        }
+    };
+
+    // The shortest paths of a (startVid, endVid) pair found in one pass
+    struct Meets {
+        Value                                           cost;
+        std::vector<std::pair<const List*, const List*>> paths;
+    };
+
+    using MeetsMap = std::unordered_map<std::pair<Value, Value>, Meets, PairHash>;
 
     folly::Future<Status> bfsShortestPath();
 
@@ -41,11 +62,13 @@ private:
 
     folly::Future<Status> floydShortestPath();
 
-    bool findPath(Iterator* backwardPathIter, CostPathsValMap& forwardPathtable, DataSet& ds);
+    const BackwardIndex& backwardIndex(const std::vector<Result>& hist, size_t version);
+
+    bool findPath(Iterator* forwardPathIter, const BackwardIndex& backwardIndex, DataSet& ds);
 
     Status conjunctPath(const List& forwardPaths,
                         const List& backwardPaths,
-                        Value& cost,
+                        const Value& cost,
                         DataSet& ds);
 
     bool findAllPaths(Iterator* backwardPathsIter,
@@ -56,8 +79,10 @@ private:
     std::vector<std::multimap<Value, const Edge*>> forward_;
     std::vector<std::multimap<Value, const Edge*>> backward_;
     size_t count_{0};
-    // startVid : {endVid, cost}
-    std::unordered_map<Value, std::unordered_map<Value, Value>> historyCostMap_;
+    // version of the backward result : index, only the last two versions are kept
+    std::unordered_map<size_t, BackwardIndex> backwardIndices_;
+    // (startVid, endVid) : cost of the shortest paths found
+    std::unordered_map<std::pair<Value, Value>, Value, PairHash> shortestCost_;
 };
 }  // namespace graph
 }  // namespace nebula
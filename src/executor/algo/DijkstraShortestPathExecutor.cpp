@@ -0,0 +1,338 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "executor/algo/DijkstraShortestPathExecutor.h"
+
+#include "context/QueryContext.h"
+#include "planner/Algo.h"
+#include "util/GraphStats.h"
+#include "util/ScopedTimer.h"
+
+using nebula::storage::GraphStorageClient;
+
+namespace nebula {
+namespace graph {
+
+DijkstraShortestPathExecutor::DijkstraShortestPathExecutor(const PlanNode* node,
+                                                           QueryContext* qctx)
+    : QueryStorageExecutor("DijkstraShortestPathExecutor", node, qctx) {
+    dijkstra_ = asNode<DijkstraShortestPath>(node);
+
+    auto makeProps = [this](const std::vector<EdgeType>& edgeTypes) {
+        auto props = std::make_unique<std::vector<storage::cpp2::EdgeProp>>();
+        props->reserve(edgeTypes.size());
+        for (auto type : edgeTypes) {
+            storage::cpp2::EdgeProp ep;
+            ep.type = type;
+            ep.props = {kDst, kType, kRank, dijkstra_->weight()};
+            props->emplace_back(std::move(ep));
+        }
+        return props;
+    };
+
+    auto steps = dijkstra_->steps();
+    forward_.edgeTypes = dijkstra_->edgeTypes();
+    forward_.maxHops = steps / 2 + steps % 2;
+    backward_.edgeTypes.reserve(forward_.edgeTypes.size());
+    for (auto type : forward_.edgeTypes) {
+        backward_.edgeTypes.emplace_back(-type);
+    }
+    backward_.maxHops = steps / 2;
+    forwardProps_ = makeProps(forward_.edgeTypes);
+    backwardProps_ = makeProps(backward_.edgeTypes);
+}
+
+folly::Future<Status> DijkstraShortestPathExecutor::execute() {
+    SCOPED_TIMER(&execTime_);
+    ds_.colNames = node()->colNames();
+    pairIdx_ = 0;
+    if (dijkstra_->srcs().empty() || dijkstra_->dsts().empty()) {
+        return finishSearch();
+    }
+    startPair();
+    return search();
+}
+
+DijkstraShortestPathExecutor::Label& DijkstraShortestPathExecutor::Direction::label(
+    const Value& vid,
+    size_t hops) {
+    auto& vidLabels = labels[vid];
+    if (vidLabels.empty()) {
+        vidLabels.resize(maxHops + 1);
+    }
+    return vidLabels[hops];
+}
+
+const DijkstraShortestPathExecutor::Label* DijkstraShortestPathExecutor::Direction::cheapest(
+    const Value& vid,
+    size_t* hops) const {
+    auto found = labels.find(vid);
+    if (found == labels.end()) {
+        return nullptr;
+    }
+    const Label* result = nullptr;
+    for (size_t i = 0; i < found->second.size(); ++i) {
+        auto& label = found->second[i];
+        if (result == nullptr || label.cost < result->cost) {
+            result = &label;
+            *hops = i;
+        }
+    }
+    return result->cost == std::numeric_limits<double>::infinity() ? nullptr : result;
+}
+
+void DijkstraShortestPathExecutor::Direction::prune() {
+    while (!heap.empty()) {
+        auto& item = heap.top();
+        auto& found = label(item.vid, item.hops);
+        if (!found.settled && found.cost == item.cost) {
+            return;
+        }
+        heap.pop();
+    }
+}
+
+void DijkstraShortestPathExecutor::startPair() {
+    const auto& dsts = dijkstra_->dsts();
+    const auto& src = dijkstra_->srcs()[pairIdx_ / dsts.size()];
+    const auto& dst = dsts[pairIdx_ % dsts.size()];
+    VLOG(1) << "Search from " << src << " to " << dst;
+
+    for (auto* dir : {&forward_, &backward_}) {
+        dir->labels.clear();
+        dir->heap = decltype(dir->heap)();
+        dir->expanding.clear();
+    }
+    forward_.label(src, 0).cost = 0;
+    forward_.heap.emplace(HeapItem{0, src, 0});
+    backward_.label(dst, 0).cost = 0;
+    backward_.heap.emplace(HeapItem{0, dst, 0});
+
+    best_ = std::numeric_limits<double>::infinity();
+    meet_ = Value();
+    meetForwardHops_ = 0;
+    meetBackwardHops_ = 0;
+    if (src == dst) {
+        best_ = 0;
+        meet_ = src;
+    }
+}
+
+std::vector<Row> DijkstraShortestPathExecutor::nextRound(bool& isForward) {
+    auto numPairs = dijkstra_->srcs().size() * dijkstra_->dsts().size();
+    while (pairIdx_ < numPairs) {
+        // The cheaper path may meet the other direction by more hops of this
+        // one, which has been settled by the other direction within its hops,
+        // so the sum of both is not a bound
+        auto forwardTop = forward_.top();
+        auto backwardTop = backward_.top();
+        if (forwardTop >= best_ && backwardTop >= best_) {
+            // No cheaper meeting is possible
+            collectPath();
+            if (++pairIdx_ < numPairs) {
+                startPair();
+            }
+            continue;
+        }
+
+        // Expand the smaller frontier which could be cheaper
+        isForward = backwardTop >= best_ ||
+                    (forwardTop < best_ && forward_.heap.size() <= backward_.heap.size());
+        auto rows = settle(isForward ? forward_ : backward_);
+        if (!rows.empty()) {
+            return rows;
+        }
+    }
+    return {};
+}
+
+folly::Future<Status> DijkstraShortestPathExecutor::search() {
+    SCOPED_TIMER(&execTime_);
+    bool isForward = true;
+    auto rows = nextRound(isForward);
+    if (rows.empty()) {
+        return finishSearch();
+    }
+
+    time::Duration getNbrTime;
+    GraphStorageClient* storageClient = qctx_->getStorageClient();
+    return storageClient
+        ->getNeighbors(dijkstra_->space(),
+                       {kVid},
+                       std::move(rows),
+                       isForward ? forward_.edgeTypes : backward_.edgeTypes,
+                       storage::cpp2::EdgeDirection::OUT_EDGE,
+                       nullptr,
+                       nullptr,
+                       isForward ? forwardProps_.get() : backwardProps_.get(),
+                       nullptr,
+                       false,
+                       false,
+                       {},
+                       std::numeric_limits<int64_t>::max(),
+                       "")
+        .via(runner())
+        .ensure([getNbrTime]() {
+            GraphStats::addStorageRpcLatency(GraphStats::StorageRpc::kGetNeighbors,
+                                             getNbrTime.elapsedInUSec());
+        })
+        .then([this, isForward](RpcResponse&& resps) -> folly::Future<Status> {
+            {
+                SCOPED_TIMER(&execTime_);
+                auto result = handleCompleteness(resps, false);
+                if (!result.ok()) {
+                    return error(std::move(result).status());
+                }
+                List datasets;
+                for (auto& resp : resps.responses()) {
+                    auto dataset = resp.get_vertices();
+                    if (dataset != nullptr) {
+                        datasets.values.emplace_back(std::move(*dataset));
+                    }
+                }
+                auto status = isForward ? relax(forward_, backward_, std::move(datasets))
+                                        : relax(backward_, forward_, std::move(datasets));
+                if (!status.ok()) {
+                    return error(std::move(status));
+                }
+            }
+            return search();
+        });
+}
+
+std::vector<Row> DijkstraShortestPathExecutor::settle(Direction& dir) {
+    std::vector<Row> rows;
+    dir.expanding.clear();
+    auto cost = dir.top();
+    while (!dir.exhausted() && dir.heap.top().cost == cost) {
+        auto item = dir.heap.top();
+        dir.heap.pop();
+        dir.label(item.vid, item.hops).settled = true;
+        if (item.hops < dir.maxHops) {
+            // Fetched once even if it's settled by different hops
+            auto& hops = dir.expanding[item.vid];
+            if (hops.empty()) {
+                rows.emplace_back(Row({item.vid}));
+            }
+            hops.emplace_back(item.hops);
+        }
+    }
+    return rows;
+}
+
+Status DijkstraShortestPathExecutor::relax(Direction& dir, Direction& other, List&& datasets) {
+    GetNeighborsIter iter(std::make_shared<Value>(std::move(datasets)));
+    const auto& weightProp = dijkstra_->weight();
+    for (; iter.valid(); iter.next()) {
+        auto edgeVal = iter.getEdge();
+        if (!edgeVal.isEdge()) {
+            continue;
+        }
+        auto& edge = edgeVal.getEdge();
+        auto& weightVal = iter.getEdgeProp(edge.name, weightProp);
+        double weight = 0;
+        if (weightVal.isInt()) {
+            weight = weightVal.getInt();
+        } else if (weightVal.isFloat()) {
+            weight = weightVal.getFloat();
+        } else {
+            return Status::Error("The weight `%s' of edge `%s' is not a number.",
+                                 weightProp.c_str(), edge.name.c_str());
+        }
+        if (weight < 0) {
+            return Status::Error("The weight `%s' of edge `%s' is negative.",
+                                 weightProp.c_str(), edge.name.c_str());
+        }
+        relax(dir, other, Value(edge.src), Value(edge.dst), weight, edge);
+    }
+    return Status::OK();
+}
+
+void DijkstraShortestPathExecutor::relax(Direction& dir,
+                                         Direction& other,
+                                         const Value& src,
+                                         const Value& dst,
+                                         double weight,
+                                         const Edge& edge) {
+    auto from = dir.expanding.find(src);
+    if (from == dir.expanding.end()) {
+        return;
+    }
+    for (auto fromHops : from->second) {
+        auto cost = dir.label(src, fromHops).cost + weight;
+        auto hops = fromHops + 1;
+        // Dropped if it's not cheaper than the one of no more hops
+        bool dominated = false;
+        for (size_t i = 0; i <= hops && !dominated; ++i) {
+            dominated = dir.label(dst, i).cost <= cost;
+        }
+        if (dominated) {
+            continue;
+        }
+        dir.label(dst, hops) = Label{cost, src, edge.type, edge.name, edge.ranking, false};
+        dir.heap.emplace(HeapItem{cost, dst, hops});
+
+        // The hops of both the directions are always within the steps
+        size_t otherHops = 0;
+        auto meet = other.cheapest(dst, &otherHops);
+        if (meet != nullptr && cost + meet->cost < best_) {
+            best_ = cost + meet->cost;
+            meet_ = dst;
+            meetForwardHops_ = &dir == &forward_ ? hops : otherHops;
+            meetBackwardHops_ = &dir == &forward_ ? otherHops : hops;
+        }
+    }
+}
+
+void DijkstraShortestPathExecutor::collectPath() {
+    if (best_ == std::numeric_limits<double>::infinity()) {
+        return;
+    }
+    auto path = buildPath();
+    VLOG(1) << "Found path: " << path << " cost: " << best_;
+    Row row;
+    row.values.emplace_back(std::move(path));
+    row.values.emplace_back(best_);
+    ds_.rows.emplace_back(std::move(row));
+}
+
+Path DijkstraShortestPathExecutor::buildPath() const {
+    // From the meeting vertex back to the src
+    std::vector<Step> steps;
+    Value vid = meet_;
+    for (auto hops = meetForwardHops_; hops > 0; --hops) {
+        const auto& label = forward_.labels.at(vid)[hops];
+        steps.emplace_back(
+            Step(Vertex(vid.getStr(), {}), label.type, label.name, label.ranking, {}));
+        vid = label.prev;
+    }
+    Path path;
+    path.src = Vertex(vid.getStr(), {});
+    path.steps.assign(std::make_move_iterator(steps.rbegin()),
+                      std::make_move_iterator(steps.rend()));
+
+    // From the meeting vertex on to the dst, the edges were traversed reversely
+    vid = meet_;
+    for (auto hops = meetBackwardHops_; hops > 0; --hops) {
+        const auto& label = backward_.labels.at(vid)[hops];
+        path.steps.emplace_back(
+            Step(Vertex(label.prev.getStr(), {}), -label.type, label.name, label.ranking, {}));
+        vid = label.prev;
+    }
+    return path;
+}
+
+folly::Future<Status> DijkstraShortestPathExecutor::finishSearch() {
+    for (auto* dir : {&forward_, &backward_}) {
+        dir->labels.clear();
+        dir->expanding.clear();
+    }
+    return folly::makeFuture<Status>(
+        finish(ResultBuilder().value(Value(std::move(ds_))).finish()));
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,144 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef EXECUTOR_ALGO_DIJKSTRASHORTESTPATHEXECUTOR_H_
+#define EXECUTOR_ALGO_DIJKSTRASHORTESTPATHEXECUTOR_H_
+
+#include "common/clients/storage/GraphStorageClient.h"
+#include "executor/QueryStorageExecutor.h"
+
+namespace nebula {
+namespace graph {
+
+class DijkstraShortestPath;
+
+/**
+ * The bidirectional Dijkstra, searching from the src and the dst in turn.
+ *
+ * Each round settles the vertices with the minimal cost in the direction which
+ * has the smaller frontier, and fetches their neighbors with the weight only.
+ * The search of a pair stops once the minimal costs of both the frontiers are
+ * not less than the cost of the best meeting found.
+ *
+ * The costs must be non-negative, and the vertices are not expanded beyond
+ * half of the steps in each direction, so the found path is no longer than the
+ * steps. A vertex is labeled by each number of hops to reach it, since the
+ * cheapest path to it may be too long to go on with, but a label is dropped if
+ * it's not cheaper than one of fewer hops. Only one path is returned for each
+ * pair even though there are more with the same cost.
+ */
+class DijkstraShortestPathExecutor final : public QueryStorageExecutor {
+public:
+    DijkstraShortestPathExecutor(const PlanNode* node, QueryContext* qctx);
+
+    folly::Future<Status> execute() override;
+
+private:
+    friend class DijkstraShortestPathTest;
+
+    struct Label {
+        // Infinite if not reached by the hops
+        double          cost{std::numeric_limits<double>::infinity()};
+        // The vertex expanded to reach this one by one hop fewer, empty at the start
+        Value           prev;
+        EdgeType        type{0};
+        std::string     name;
+        EdgeRanking     ranking{0};
+        bool            settled{false};
+    };
+
+    struct HeapItem {
+        double      cost;
+        Value       vid;
+        size_t      hops;
+
+        bool operator>(const HeapItem& rhs) const {
+            return cost > rhs.cost;
+        }
+    };
+
+    struct Direction {
+        // The labels of each vertex indexed by the hops
+        std::unordered_map<Value, std::vector<Label>>               labels;
+        std::priority_queue<HeapItem, std::vector<HeapItem>, std::greater<HeapItem>>   heap;
+        // The hops of the vertices settled in the round, which are expanded
+        std::unordered_map<Value, std::vector<size_t>>              expanding;
+        std::vector<EdgeType>                                       edgeTypes;
+        size_t                                                      maxHops{0};
+
+        Label& label(const Value& vid, size_t hops);
+
+        // The cheapest label of the vertex, or null if not reached
+        const Label* cheapest(const Value& vid, size_t* hops) const;
+
+        // Drop the settled or stale items on the top of the heap
+        void prune();
+
+        bool exhausted() {
+            prune();
+            return heap.empty();
+        }
+
+        double top() {
+            prune();
+            return heap.empty() ? std::numeric_limits<double>::infinity() : heap.top().cost;
+        }
+    };
+
+    // Start the search of the current pair
+    void startPair();
+
+    // Expand one round, then go on with the next round until all pairs are searched
+    folly::Future<Status> search();
+
+    // The vertices to expand in the next round and the direction of them,
+    // empty if all the pairs are searched
+    std::vector<Row> nextRound(bool& isForward);
+
+    // Settle the vertices with the minimal cost, returns the ones to expand
+    std::vector<Row> settle(Direction& dir);
+
+    // Relax the neighbors from the response
+    Status relax(Direction& dir, Direction& other, List&& datasets);
+
+    // Relax the edge from `src' to `dst' of the direction
+    void relax(Direction& dir,
+               Direction& other,
+               const Value& src,
+               const Value& dst,
+               double weight,
+               const Edge& edge);
+
+    // Append the path found for the current pair to the result
+    void collectPath();
+
+    Path buildPath() const;
+
+    folly::Future<Status> finishSearch();
+
+    using RpcResponse = storage::StorageRpcResponse<storage::cpp2::GetNeighborsResponse>;
+
+private:
+    const DijkstraShortestPath*                         dijkstra_{nullptr};
+    std::unique_ptr<std::vector<storage::cpp2::EdgeProp>>   forwardProps_;
+    std::unique_ptr<std::vector<storage::cpp2::EdgeProp>>   backwardProps_;
+    // The pairs to search, src index * number of dsts + dst index
+    size_t                                              pairIdx_{0};
+    Direction                                           forward_;
+    Direction                                           backward_;
+    // The cost of the best meeting found
+    double                                              best_{0};
+    Value                                               meet_;
+    // The hops of the labels of both the directions which meet
+    size_t                                              meetForwardHops_{0};
+    size_t                                              meetBackwardHops_{0};
+    DataSet                                             ds_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // EXECUTOR_ALGO_DIJKSTRASHORTESTPATHEXECUTOR_H_
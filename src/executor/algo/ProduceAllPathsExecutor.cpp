@@ -55,6 +55,11 @@ folly::Future<Status> ProduceAllPathsExecutor::execute() {
     return finish(ResultBuilder().value(Value(std::move(ds))).finish());
 }
 
+void ProduceAllPathsExecutor::recycle() {
+    count_ = 0;
+    historyPaths_.clear();
+}
+
 void ProduceAllPathsExecutor::createPaths(const Edge& edge, Interims& interims) {
     Path path;
     path.src = Vertex(edge.src, {});
@@ -18,6 +18,8 @@ public:
 
     folly::Future<Status> execute() override;
 
+    void recycle() override;
+
 private:
     // k: dst, v: paths to dst
     using HistoryPaths = std::unordered_map<Value, std::vector<const Path*>>;
@@ -277,6 +277,10 @@ folly::Future<Status> ProduceSemiShortestPathExecutor::execute() {
     return finish(ResultBuilder().value(Value(std::move(ds))).finish());
 }
 
+void ProduceSemiShortestPathExecutor::recycle() {
+    historyCostPathMap_.clear();
+}
+
 
 }   // namespace graph
 }   // namespace nebula
@@ -18,6 +18,8 @@ public:
 
     folly::Future<Status> execute() override;
 
+    void recycle() override;
+
     struct CostPaths {
         double cost_;
         std::vector<Path> paths_;
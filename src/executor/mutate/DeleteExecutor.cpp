@@ -7,8 +7,10 @@
 #include "DeleteExecutor.h"
 #include "planner/Mutate.h"
 #include "context/QueryContext.h"
+#include "context/VertexRowCache.h"
 #include "util/SchemaUtil.h"
 #include "executor/mutate/DeleteExecutor.h"
+#include "util/GraphStats.h"
 #include "util/ScopedTimer.h"
 
 
@@ -59,11 +61,24 @@ folly::Future<Status> DeleteVerticesExecutor::deleteVertices() {
         return Status::OK();
     }
     auto spaceId = spaceInfo.id;
+    // The cached rows of them are dropped once the deleting is done
+    auto invalidated = vertices;
     time::Duration deleteVertTime;
     return qctx()->getStorageClient()->deleteVertices(spaceId, std::move(vertices))
         .via(runner())
-        .ensure([deleteVertTime]() {
+        .ensure([deleteVertTime, spaceId, invalidated = std::move(invalidated)]() {
             VLOG(1) << "Delete vertices time: " << deleteVertTime.elapsedInUSec() << "us";
+            GraphStats::addStorageRpcLatency(GraphStats::StorageRpc::kDeleteVertices,
+                                             deleteVertTime.elapsedInUSec());
+            for (auto& vid : invalidated) {
+                VertexRowCache::invalidateAll(spaceId, vid);
+            }
+            // Their edges are dropped from the neighbors of the other endpoints too,
+            // which are unknown here
+            auto& neighbors = VertexRowCache::instance(VertexRowCache::Kind::kNeighbor);
+            if (neighbors.enabled()) {
+                neighbors.invalidateSpace(spaceId);
+            }
         })
         .then([this](storage::StorageRpcResponse<storage::cpp2::ExecResponse> resp) {
             SCOPED_TIMER(&execTime_);
@@ -153,11 +168,25 @@ folly::Future<Status> DeleteEdgesExecutor::deleteEdges() {
     }
 
     auto spaceId = spaceInfo.id;
+    // Both the ends are in the keys, since the in edges are deleted too
+    std::vector<Value> invalidated;
+    if (VertexRowCache::instance(VertexRowCache::Kind::kNeighbor).enabled()) {
+        invalidated.reserve(edgeKeys.size());
+        for (auto& edgeKey : edgeKeys) {
+            invalidated.emplace_back(edgeKey.get_src());
+        }
+    }
     time::Duration deleteEdgeTime;
     return qctx()->getStorageClient()->deleteEdges(spaceId, std::move(edgeKeys))
             .via(runner())
-            .ensure([deleteEdgeTime]() {
+            .ensure([deleteEdgeTime, spaceId, invalidated = std::move(invalidated)]() {
                 VLOG(1) << "Delete edge time: " << deleteEdgeTime.elapsedInUSec() << "us";
+                GraphStats::addStorageRpcLatency(GraphStats::StorageRpc::kDeleteEdges,
+                                                 deleteEdgeTime.elapsedInUSec());
+                auto& cache = VertexRowCache::instance(VertexRowCache::Kind::kNeighbor);
+                for (auto& vid : invalidated) {
+                    cache.invalidate(spaceId, vid);
+                }
             })
             .then([this](storage::StorageRpcResponse<storage::cpp2::ExecResponse> resp) {
                 SCOPED_TIMER(&execTime_);
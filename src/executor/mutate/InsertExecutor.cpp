@@ -8,6 +8,8 @@
 
 #include "planner/Mutate.h"
 #include "context/QueryContext.h"
+#include "context/VertexRowCache.h"
+#include "util/GraphStats.h"
 #include "util/ScopedTimer.h"
 
 namespace nebula {
@@ -29,9 +31,14 @@ folly::Future<Status> InsertVerticesExecutor::insertVertices() {
         .via(runner())
         .ensure([addVertTime]() {
             VLOG(1) << "Add vertices time: " << addVertTime.elapsedInUSec() << "us";
+            GraphStats::addStorageRpcLatency(GraphStats::StorageRpc::kAddVertices,
+                                             addVertTime.elapsedInUSec());
         })
-        .then([this](storage::StorageRpcResponse<storage::cpp2::ExecResponse> resp) {
+        .then([this, ivNode](storage::StorageRpcResponse<storage::cpp2::ExecResponse> resp) {
             SCOPED_TIMER(&execTime_);
+            for (auto& vertex : ivNode->getVertices()) {
+                VertexRowCache::invalidateAll(ivNode->getSpace(), vertex.get_id());
+            }
             NG_RETURN_IF_ERROR(handleCompleteness(resp, true));
             return Status::OK();
         });
@@ -53,9 +60,18 @@ folly::Future<Status> InsertEdgesExecutor::insertEdges() {
             .via(runner())
             .ensure([addEdgeTime]() {
                 VLOG(1) << "Add edge time: " << addEdgeTime.elapsedInUSec() << "us";
+                GraphStats::addStorageRpcLatency(GraphStats::StorageRpc::kAddEdges,
+                                                 addEdgeTime.elapsedInUSec());
             })
-            .then([this](storage::StorageRpcResponse<storage::cpp2::ExecResponse> resp) {
+            .then([this, ieNode](storage::StorageRpcResponse<storage::cpp2::ExecResponse> resp) {
                 SCOPED_TIMER(&execTime_);
+                auto& cache = VertexRowCache::instance(VertexRowCache::Kind::kNeighbor);
+                if (cache.enabled()) {
+                    for (auto& edge : ieNode->getEdges()) {
+                        cache.invalidate(ieNode->getSpace(), edge.get_key().get_src());
+                        cache.invalidate(ieNode->getSpace(), edge.get_key().get_dst());
+                    }
+                }
                 NG_RETURN_IF_ERROR(handleCompleteness(resp, true));
                 return Status::OK();
             });
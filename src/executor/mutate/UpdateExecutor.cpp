@@ -8,6 +8,8 @@
 #include "planner/Mutate.h"
 #include "util/SchemaUtil.h"
 #include "context/QueryContext.h"
+#include "context/VertexRowCache.h"
+#include "util/GraphStats.h"
 #include "util/ScopedTimer.h"
 
 
@@ -55,9 +57,12 @@ folly::Future<Status> UpdateVertexExecutor::execute() {
         .via(runner())
         .ensure([updateVertTime]() {
             VLOG(1) << "Update vertice time: " << updateVertTime.elapsedInUSec() << "us";
+            GraphStats::addStorageRpcLatency(GraphStats::StorageRpc::kUpdateVertex,
+                                             updateVertTime.elapsedInUSec());
         })
-        .then([this](StatusOr<storage::cpp2::UpdateResponse> resp) {
+        .then([this, uvNode](StatusOr<storage::cpp2::UpdateResponse> resp) {
             SCOPED_TIMER(&execTime_);
+            VertexRowCache::invalidateAll(uvNode->getSpaceId(), uvNode->getVId());
             if (!resp.ok()) {
                 LOG(ERROR) << resp.status();
                 return resp.status();
@@ -100,9 +105,16 @@ folly::Future<Status> UpdateEdgeExecutor::execute() {
             .via(runner())
             .ensure([updateEdgeTime]() {
                 VLOG(1) << "Update edge time: " << updateEdgeTime.elapsedInUSec() << "us";
+                GraphStats::addStorageRpcLatency(GraphStats::StorageRpc::kUpdateEdge,
+                                                 updateEdgeTime.elapsedInUSec());
             })
-            .then([this](StatusOr<storage::cpp2::UpdateResponse> resp) {
+            .then([this, ueNode](StatusOr<storage::cpp2::UpdateResponse> resp) {
                 SCOPED_TIMER(&execTime_);
+                auto& cache = VertexRowCache::instance(VertexRowCache::Kind::kNeighbor);
+                if (cache.enabled()) {
+                    cache.invalidate(ueNode->getSpaceId(), ueNode->getSrcId());
+                    cache.invalidate(ueNode->getSpaceId(), ueNode->getDstId());
+                }
                 if (!resp.ok()) {
                     LOG(ERROR) << "Update edge failed: " << resp.status();
                     return resp.status();
@@ -6,15 +6,23 @@
 
 #include "executor/query/DataCollectExecutor.h"
 
+#include <folly/hash/SpookyHashV2.h>
+
 #include "planner/Query.h"
+#include "util/SchemaUtil.h"
 #include "util/ScopedTimer.h"
 
 namespace nebula {
 namespace graph {
+
+// The rows of a step are split into the chunks of this size to collect in parallel
+static constexpr size_t kSubgraphChunkSize = 4096;
+
 folly::Future<Status> DataCollectExecutor::execute() {
     return doCollect().ensure([this] () {
         result_ = Value::kEmpty;
         colNames_.clear();
+        subgraph_.reset();
     });
 }
 
@@ -26,8 +34,7 @@ folly::Future<Status> DataCollectExecutor::doCollect() {
     auto vars = dc->vars();
     switch (dc->collectKind()) {
         case DataCollect::CollectKind::kSubgraph: {
-            NG_RETURN_IF_ERROR(collectSubgraph(vars));
-            break;
+            return collectSubgraph(vars);
         }
         case DataCollect::CollectKind::kRowBasedMove: {
             NG_RETURN_IF_ERROR(rowBasedMove(vars));
@@ -52,57 +59,175 @@ folly::Future<Status> DataCollectExecutor::doCollect() {
         default:
             LOG(FATAL) << "Unknown data collect type: " << static_cast<int64_t>(dc->collectKind());
     }
+    return finishCollect();
+}
+
+folly::Future<Status> DataCollectExecutor::finishCollect() {
     ResultBuilder builder;
     builder.value(Value(std::move(result_))).iter(Iterator::Kind::kSequential);
     return finish(builder.finish());
 }
 
-Status DataCollectExecutor::collectSubgraph(const std::vector<std::string>& vars) {
-    DataSet ds;
-    ds.colNames = std::move(colNames_);
-    // the subgraph not need duplicate vertices or edges, so dedup here directly
-    std::unordered_set<std::string> vids;
-    std::unordered_set<std::tuple<std::string, std::string, int64_t, std::string>> edgeKeys;
+folly::Future<Status> DataCollectExecutor::collectSubgraph(
+    const std::vector<std::string>& vars) {
+    subgraph_ = std::make_unique<SubgraphState>();
+    subgraph_->ds.colNames = std::move(colNames_);
     for (auto& var : vars) {
-        auto& hist = ectx_->getHistory(var);
-        for (auto& result : hist) {
-            auto iter = result.iter();
-            if (iter->isGetNeighborsIter()) {
-                List vertices;
-                List edges;
-                auto* gnIter = static_cast<GetNeighborsIter*>(iter.get());
-                auto originVertices = gnIter->getVertices();
-                for (auto& v : originVertices.values) {
-                    if (!v.isVertex()) {
-                        continue;
-                    }
-                    if (vids.emplace(v.getVertex().vid).second) {
-                        vertices.emplace_back(std::move(v));
+        for (auto& result : ectx_->getHistory(var)) {
+            subgraph_->steps.emplace_back(&result);
+        }
+    }
+    return collectSubgraphStep(0);
+}
+
+folly::Future<Status> DataCollectExecutor::collectSubgraphStep(size_t step) {
+    SCOPED_TIMER(&execTime_);
+    if (step == subgraph_->steps.size()) {
+        result_.setDataSet(std::move(subgraph_->ds));
+        subgraph_.reset();
+        return finishCollect();
+    }
+
+    std::shared_ptr<Iterator> iter = subgraph_->steps[step]->iter();
+    if (!iter->isGetNeighborsIter()) {
+        subgraph_.reset();
+        std::stringstream msg;
+        msg << "Iterator should be kind of GetNeighborIter, but was: " << iter->kind();
+        return Status::Error(msg.str());
+    }
+
+    auto chunks = std::make_shared<std::vector<SubgraphChunk>>();
+    for (size_t begin = 0; begin < iter->size(); begin += kSubgraphChunkSize) {
+        SubgraphChunk chunk;
+        chunk.begin = begin;
+        chunk.end = std::min(begin + kSubgraphChunkSize, iter->size());
+        chunks->emplace_back(std::move(chunk));
+    }
+
+    // Find the keys of the vertices and edges of each chunk in parallel, dedup
+    // them over all the steps, then only build the new ones in parallel.
+    std::vector<folly::Future<folly::Unit>> finds;
+    finds.reserve(chunks->size());
+    for (auto& chunk : *chunks) {
+        finds.emplace_back(folly::via(runner(), [&chunk, iter]() {
+            findSubgraphCandidates(iter->copy().get(), &chunk);
+        }));
+    }
+    return folly::collect(finds)
+        .via(runner())
+        .then([this, chunks, iter](std::vector<folly::Unit>&&) {
+            SCOPED_TIMER(&execTime_);
+            auto& state = *subgraph_;
+            std::vector<folly::Future<folly::Unit>> builds;
+            builds.reserve(chunks->size());
+            for (auto& chunk : *chunks) {
+                auto vertices = std::move(chunk.vertices);
+                for (auto& vertex : vertices) {
+                    if (state.vids.emplace(vertex.second).second) {
+                        chunk.vertices.emplace_back(std::move(vertex));
                     }
                 }
-                auto originEdges = gnIter->getEdges();
-                for (auto& e : originEdges.values) {
-                    if (!e.isEdge()) {
-                        continue;
-                    }
-                    auto edgeKey = std::make_tuple(e.getEdge().src,
-                                                   e.getEdge().name,
-                                                   e.getEdge().ranking,
-                                                   e.getEdge().dst);
-                    if (edgeKeys.emplace(std::move(edgeKey)).second) {
-                        edges.emplace_back(std::move(e));
+                auto edges = std::move(chunk.edges);
+                for (auto& edge : edges) {
+                    if (state.edges.emplace(edge.second).second) {
+                        chunk.edges.emplace_back(std::move(edge));
                     }
                 }
-                ds.rows.emplace_back(Row({std::move(vertices), std::move(edges)}));
-            } else {
-                std::stringstream msg;
-                msg << "Iterator should be kind of GetNeighborIter, but was: " << iter->kind();
-                return Status::Error(msg.str());
+                builds.emplace_back(folly::via(runner(), [&chunk, iter]() {
+                    buildSubgraphChunk(iter->copy().get(), &chunk);
+                }));
+            }
+            return folly::collect(builds);
+        })
+        .via(runner())
+        .then([this, chunks, step](std::vector<folly::Unit>&&) {
+            {
+                SCOPED_TIMER(&execTime_);
+                List vertices;
+                List edges;
+                for (auto& chunk : *chunks) {
+                    std::move(chunk.vertexList.values.begin(),
+                              chunk.vertexList.values.end(),
+                              std::back_inserter(vertices.values));
+                    std::move(chunk.edgeList.values.begin(),
+                              chunk.edgeList.values.end(),
+                              std::back_inserter(edges.values));
+                }
+                subgraph_->ds.rows.emplace_back(Row({std::move(vertices), std::move(edges)}));
+            }
+            return collectSubgraphStep(step + 1);
+        });
+}
+
+// static
+DataCollectExecutor::EdgeKey DataCollectExecutor::edgeKey(folly::StringPiece from,
+                                                          folly::StringPiece to,
+                                                          int64_t type,
+                                                          int64_t rank) {
+    EdgeKey key{0, 0, from, to, type, rank};
+    folly::hash::SpookyHashV2::Hash128(from.data(), from.size(), &key.hi, &key.lo);
+    // Hash the size too, or ("ab", "c") would be the same as ("a", "bc")
+    uint64_t fromSize = from.size();
+    folly::hash::SpookyHashV2::Hash128(&fromSize, sizeof(fromSize), &key.hi, &key.lo);
+    folly::hash::SpookyHashV2::Hash128(to.data(), to.size(), &key.hi, &key.lo);
+    int64_t typeAndRank[2] = {type, rank};
+    folly::hash::SpookyHashV2::Hash128(typeAndRank, sizeof(typeAndRank), &key.hi, &key.lo);
+    return key;
+}
+
+void DataCollectExecutor::findSubgraphCandidates(Iterator* iter, SubgraphChunk* chunk) {
+    // Each logical row is an edge of the src vertex, so the vertex repeats in the
+    // adjacent rows and only needs to be checked when it changes.
+    const Value* lastSrc = nullptr;
+    std::unordered_set<folly::StringPiece> vids;
+    std::unordered_set<EdgeKey, EdgeKeyHash> edges;
+    size_t pos = chunk->begin;
+    for (iter->reset(pos); iter->valid() && pos < chunk->end; iter->next(), ++pos) {
+        auto& src = iter->getColumn(kVid);
+        if (!SchemaUtil::isValidVid(src)) {
+            continue;
+        }
+        if (&src != lastSrc) {
+            lastSrc = &src;
+            folly::StringPiece vid(src.getStr());
+            if (vids.emplace(vid).second) {
+                chunk->vertices.emplace_back(pos, vid);
             }
         }
+
+        auto& type = iter->getEdgeProp("*", kType);
+        auto& dst = iter->getEdgeProp("*", kDst);
+        auto& rank = iter->getEdgeProp("*", kRank);
+        if (!type.isInt() || !rank.isInt() || !SchemaUtil::isValidVid(dst)) {
+            continue;
+        }
+        // The reversed edge is the same as the positive one
+        bool reversed = type.getInt() < 0;
+        auto& from = reversed ? dst.getStr() : src.getStr();
+        auto& to = reversed ? src.getStr() : dst.getStr();
+        auto key = edgeKey(from, to, reversed ? -type.getInt() : type.getInt(), rank.getInt());
+        if (edges.emplace(key).second) {
+            chunk->edges.emplace_back(pos, key);
+        }
+    }
+}
+
+void DataCollectExecutor::buildSubgraphChunk(Iterator* iter, SubgraphChunk* chunk) {
+    chunk->vertexList.values.reserve(chunk->vertices.size());
+    for (auto& vertex : chunk->vertices) {
+        iter->reset(vertex.first);
+        chunk->vertexList.values.emplace_back(iter->getVertex());
+    }
+    chunk->edgeList.values.reserve(chunk->edges.size());
+    for (auto& edge : chunk->edges) {
+        iter->reset(edge.first);
+        auto value = iter->getEdge();
+        if (!value.isEdge()) {
+            continue;
+        }
+        const_cast<Edge&>(value.getEdge()).format();
+        chunk->edgeList.values.emplace_back(std::move(value));
     }
-    result_.setDataSet(std::move(ds));
-    return Status::OK();
 }
 
 Status DataCollectExecutor::rowBasedMove(const std::vector<std::string>& vars) {
@@ -194,10 +319,8 @@ Status DataCollectExecutor::collectMultiplePairShortestPath(const std::vector<st
     ds.colNames = std::move(colNames_);
     DCHECK(!ds.colNames.empty());
 
-    // src : {dst : <cost, {path}>}
-    std::unordered_map<Value, std::unordered_map<Value, std::pair<Value, std::vector<Path>>>>
-        shortestPath;
-
+    // The ConjunctPath only yields the shortest paths of each pair, and a pair
+    // never shows up again in the later rounds, so just collect them.
     for (auto& var : vars) {
         auto& hist = ectx_->getHistory(var);
         for (auto& result : hist) {
@@ -208,42 +331,15 @@ Status DataCollectExecutor::collectMultiplePairShortestPath(const std::vector<st
                 return Status::Error(msg.str());
             }
             auto* seqIter = static_cast<SequentialIter*>(iter.get());
+            ds.rows.reserve(ds.rows.size() + seqIter->size());
             for (; seqIter->valid(); seqIter->next()) {
                 auto& pathVal = seqIter->getColumn("_path");
-                auto cost = seqIter->getColumn("cost");
                 if (!pathVal.isPath()) {
                     return Status::Error("Type error `%s', should be PATH",
                                          pathVal.typeName().c_str());
                 }
-                auto& path = pathVal.getPath();
-                auto& src = path.src.vid;
-                auto& dst = path.steps.back().dst.vid;
-                if (shortestPath.find(src) == shortestPath.end() ||
-                    shortestPath[src].find(dst) == shortestPath[src].end()) {
-                    auto& dstHist = shortestPath[src];
-                    std::vector<Path> tempPaths = {std::move(path)};
-                    dstHist.emplace(dst, std::make_pair(cost, std::move(tempPaths)));
-                } else {
-                    auto oldCost = shortestPath[src][dst].first;
-                    if (cost < oldCost) {
-                        std::vector<Path> tempPaths = {std::move(path)};
-                        shortestPath[src][dst].second.swap(tempPaths);
-                    } else if (cost == oldCost) {
-                        shortestPath[src][dst].second.emplace_back(std::move(path));
-                    } else {
-                        continue;
-                    }
-                }
-            }
-        }
-    }
-
-    // collect result
-    for (auto& srcPath : shortestPath) {
-        for (auto& dstPath : srcPath.second) {
-            for (auto& path : dstPath.second.second) {
                 Row row;
-                row.values.emplace_back(std::move(path));
+                row.values.emplace_back(pathVal);
                 ds.rows.emplace_back(std::move(row));
             }
         }
@@ -7,6 +7,8 @@
 #ifndef EXECUTOR_QUERY_DATACOLLECTEXECUTOR_H_
 #define EXECUTOR_QUERY_DATACOLLECTEXECUTOR_H_
 
+#include <folly/Range.h>
+
 #include "executor/Executor.h"
 
 namespace nebula {
@@ -19,9 +21,16 @@ public:
     folly::Future<Status> execute() override;
 
 private:
+    friend class DataCollectTest;
+
     folly::Future<Status> doCollect();
 
-    Status collectSubgraph(const std::vector<std::string>& vars);
+    folly::Future<Status> finishCollect();
+
+    folly::Future<Status> collectSubgraph(const std::vector<std::string>& vars);
+
+    // Collect the vertices and edges new to the step, then go on with the next step
+    folly::Future<Status> collectSubgraphStep(size_t step);
 
     Status rowBasedMove(const std::vector<std::string>& vars);
 
@@ -33,8 +42,59 @@ private:
 
     Status collectMultiplePairShortestPath(const std::vector<std::string>& vars);
 
-    std::vector<std::string>    colNames_;
-    Value                       result_;
+    // The src, dst, type and ranking of the edge in the positive direction, with
+    // their 128-bit hash compared first. The vids refer to the results of the steps.
+    struct EdgeKey {
+        uint64_t                hi;
+        uint64_t                lo;
+        folly::StringPiece      from;
+        folly::StringPiece      to;
+        int64_t                 type;
+        int64_t                 rank;
+
+        bool operator==(const EdgeKey& rhs) const {
+            return hi == rhs.hi && lo == rhs.lo && type == rhs.type && rank == rhs.rank &&
+                   from == rhs.from && to == rhs.to;
+        }
+    };
+
+    struct EdgeKeyHash {
+        size_t operator()(const EdgeKey& key) const {
+            return key.lo;
+        }
+    };
+
+    // A range of the rows of the step, collected in parallel with the others
+    struct SubgraphChunk {
+        size_t                                                  begin;
+        size_t                                                  end;
+        // The positions of the vertices and the edges not seen before in the chunk
+        std::vector<std::pair<size_t, folly::StringPiece>>      vertices;
+        std::vector<std::pair<size_t, EdgeKey>>                 edges;
+        List                                                    vertexList;
+        List                                                    edgeList;
+    };
+
+    struct SubgraphState {
+        std::vector<const Result*>                      steps;
+        // The vids refer to the results of the steps, which outlive the collecting
+        std::unordered_set<folly::StringPiece>          vids;
+        std::unordered_set<EdgeKey, EdgeKeyHash>        edges;
+        DataSet                                         ds;
+    };
+
+    static EdgeKey edgeKey(folly::StringPiece from,
+                           folly::StringPiece to,
+                           int64_t type,
+                           int64_t rank);
+
+    static void findSubgraphCandidates(Iterator* iter, SubgraphChunk* chunk);
+
+    static void buildSubgraphChunk(Iterator* iter, SubgraphChunk* chunk);
+
+    std::vector<std::string>        colNames_;
+    Value                           result_;
+    std::unique_ptr<SubgraphState>  subgraph_;
 };
 }  // namespace graph
 }  // namespace nebula
@@ -18,10 +18,18 @@ folly::Future<Status> DataJoinExecutor::execute() {
 }
 
 Status DataJoinExecutor::close() {
-    exchange_ = false;
+    recycle();
     return Executor::close();
 }
 
+void DataJoinExecutor::recycle() {
+    exchange_ = false;
+    if (hashTable_ != nullptr) {
+        // The rows of the inputs are released after the execution
+        hashTable_->reset(0);
+    }
+}
+
 folly::Future<Status> DataJoinExecutor::doInnerJoin() {
     SCOPED_TIMER(&execTime_);
 
@@ -56,7 +64,11 @@ folly::Future<Status> DataJoinExecutor::doInnerJoin() {
     resultIter->joinIndex(lhsIter.get(), rhsIter.get());
     auto bucketSize =
         lhsIter->size() > rhsIter->size() ? rhsIter->size() : lhsIter->size();
-    hashTable_ = std::make_unique<HashTable>(bucketSize);
+    if (hashTable_ == nullptr) {
+        hashTable_ = std::make_unique<HashTable>(bucketSize);
+    } else {
+        hashTable_->reset(bucketSize);
+    }
 
     if (!(lhsIter->empty() || rhsIter->empty())) {
         if (lhsIter->size() < rhsIter->size()) {
@@ -102,21 +114,11 @@ void DataJoinExecutor::probe(const std::vector<Expression*>& probeKeys,
         auto range = hashTable_->get(list);
         for (auto i = range.first; i != range.second; ++i) {
             auto row = i->second;
-            std::vector<const Row*> values;
-            auto lSegs = row->segments();
-            auto rSegs = probeIter->row()->segments();
             if (exchange_) {
-                values.insert(values.end(), rSegs.begin(), rSegs.end());
-                values.insert(values.end(), lSegs.begin(), lSegs.end());
+                resultIter->addRow(probeIter->row(), row);
             } else {
-                values.insert(values.end(), lSegs.begin(), lSegs.end());
-                values.insert(values.end(), rSegs.begin(), rSegs.end());
+                resultIter->addRow(row, probeIter->row());
             }
-            size_t size = row->size() + probeIter->row()->size();
-            JoinIter::JoinLogicalRow newRow(std::move(values), size,
-                                        &resultIter->getColIdxIndices());
-            VLOG(1) << node()->outputVar() << " : " << newRow;
-            resultIter->addRow(std::move(newRow));
         }
     }
 }
@@ -40,6 +40,17 @@ public:
             table_.clear();
         }
 
+        // Drop the entries for the next build, the buckets are reused
+        void reset(size_t bucketSize) {
+            for (size_t i = 0; i < bucketSize_; ++i) {
+                table_[i].clear();
+            }
+            if (table_.size() < bucketSize) {
+                table_.resize(bucketSize);
+            }
+            bucketSize_ = bucketSize;
+        }
+
     private:
         size_t  bucketSize_{0};
         Table   table_;
@@ -52,6 +63,8 @@ public:
 
     Status close() override;
 
+    void recycle() override;
+
 private:
     folly::Future<Status> doInnerJoin();
 
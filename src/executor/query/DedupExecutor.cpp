@@ -11,6 +11,11 @@
 
 namespace nebula {
 namespace graph {
+void DedupExecutor::recycle() {
+    seeded_ = false;
+    visited_.clear();
+}
+
 folly::Future<Status> DedupExecutor::execute() {
     SCOPED_TIMER(&execTime_);
     auto* dedup = asNode<Dedup>(node());
@@ -28,13 +33,17 @@ folly::Future<Status> DedupExecutor::execute() {
     }
     ResultBuilder builder;
     builder.value(iter->valuePtr());
-    std::unordered_set<const LogicalRow*> unique;
-    while (iter->valid()) {
-        if (unique.find(iter->row()) != unique.end()) {
-            iter->erase();
-        } else {
-            unique.emplace(iter->row());
-            iter->next();
+    if (dedup->frontier()) {
+        NG_RETURN_IF_ERROR(dedupFrontier(iter.get()));
+    } else {
+        std::unordered_set<const LogicalRow*> unique;
+        while (iter->valid()) {
+            if (unique.find(iter->row()) != unique.end()) {
+                iter->erase();
+            } else {
+                unique.emplace(iter->row());
+                iter->next();
+            }
         }
     }
     iter->reset();
@@ -42,5 +51,53 @@ folly::Future<Status> DedupExecutor::execute() {
     return finish(builder.finish());
 }
 
+namespace {
+
+Row toRow(const LogicalRow* logicalRow) {
+    Row row;
+    row.values.reserve(logicalRow->size());
+    for (size_t i = 0; i < logicalRow->size(); ++i) {
+        row.values.emplace_back((*logicalRow)[i]);
+    }
+    return row;
+}
+
+}   // namespace
+
+// static
+Status DedupExecutor::seedFrontier(const ExecutionContext* ectx,
+                                   const std::string& var,
+                                   std::unordered_set<Row>* visited) {
+    if (!ectx->exist(var)) {
+        return Status::OK();
+    }
+    for (auto& result : ectx->getHistory(var)) {
+        auto seen = result.iter();
+        if (UNLIKELY(seen == nullptr || seen->isGetNeighborsIter())) {
+            return Status::Error("Internal Error: invalid frontier of `%s'", var.c_str());
+        }
+        for (; seen->valid(); seen->next()) {
+            visited->emplace(toRow(seen->row()));
+        }
+    }
+    return Status::OK();
+}
+
+Status DedupExecutor::dedupFrontier(Iterator* iter) {
+    if (!seeded_) {
+        seeded_ = true;
+        NG_RETURN_IF_ERROR(seedFrontier(ectx_, node()->outputVar(), &visited_));
+    }
+
+    while (iter->valid()) {
+        if (visited_.emplace(toRow(iter->row())).second) {
+            iter->next();
+        } else {
+            iter->erase();
+        }
+    }
+    return Status::OK();
+}
+
 }   // namespace graph
 }   // namespace nebula
@@ -18,6 +18,21 @@ public:
         : Executor("DedupExecutor", node, qctx) {}
 
     folly::Future<Status> execute() override;
+
+    void recycle() override;
+
+    // Collect the rows output to the var before, i.e. the start of the
+    // traversal before the loop, see Dedup::frontier()
+    static Status seedFrontier(const ExecutionContext *ectx,
+                               const std::string &var,
+                               std::unordered_set<Row> *visited);
+
+private:
+    // Drop the rows output before too, see Dedup::frontier()
+    Status dedupFrontier(Iterator* iter);
+
+    bool                            seeded_{false};
+    std::unordered_set<Row>         visited_;
 };
 
 }   // namespace graph
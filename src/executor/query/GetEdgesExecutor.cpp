@@ -7,6 +7,7 @@
 #include "executor/query/GetEdgesExecutor.h"
 #include "context/QueryContext.h"
 #include "planner/Query.h"
+#include "util/GraphStats.h"
 #include "util/SchemaUtil.h"
 #include "util/ScopedTimer.h"
 
@@ -72,6 +73,8 @@ folly::Future<Status> GetEdgesExecutor::getEdges() {
         .via(runner())
         .ensure([getPropsTime]() {
             VLOG(1) << "Get Props Time: " << getPropsTime.elapsedInUSec() << "us";
+            GraphStats::addStorageRpcLatency(GraphStats::StorageRpc::kGetProps,
+                                             getPropsTime.elapsedInUSec());
         })
         .then([this, ge](StorageRpcResponse<GetPropResponse> &&rpcResp) {
             SCOPED_TIMER(&execTime_);
@@ -8,12 +8,17 @@
 
 #include <sstream>
 
+#include <folly/json.h>
+
 #include "common/clients/storage/GraphStorageClient.h"
 #include "common/datatypes/List.h"
 #include "common/datatypes/Vertex.h"
 #include "context/QueryContext.h"
+#include "context/VertexRowCache.h"
+#include "util/GraphStats.h"
 #include "util/SchemaUtil.h"
 #include "util/ScopedTimer.h"
+#include "util/ToJson.h"
 
 using nebula::storage::StorageRpcResponse;
 using nebula::storage::cpp2::GetNeighborsResponse;
@@ -31,11 +36,29 @@ folly::Future<Status> GetNeighborsExecutor::execute() {
 }
 
 Status GetNeighborsExecutor::close() {
-    // clear the members
-    reqDs_.rows.clear();
+    reset();
     return Executor::close();
 }
 
+void GetNeighborsExecutor::recycle() {
+    // Left by a failed execution, which is not closed
+    reset();
+}
+
+void GetNeighborsExecutor::reset() {
+    reqDs_.rows.clear();
+    cachedDs_.clear();
+    uniqueVids_.clear();
+}
+
+Status GetNeighborsExecutor::finishNeighbors(Value&& neighbors, Result::State state) {
+    return finish(ResultBuilder()
+                      .state(state)
+                      .value(std::move(neighbors))
+                      .iter(Iterator::Kind::kGetNeighbors)
+                      .finish());
+}
+
 Status GetNeighborsExecutor::buildRequestDataSet() {
     SCOPED_TIMER(&execTime_);
     auto inputVar = gn_->inputVar();
@@ -47,7 +70,6 @@ Status GetNeighborsExecutor::buildRequestDataSet() {
     reqDs_.colNames = {kVid};
     reqDs_.rows.reserve(iter->size());
     auto* src = gn_->src();
-    std::unordered_set<Value> uniqueVid;
     const auto& spaceInfo = qctx()->rctx()->session()->space();
     for (; iter->valid(); iter->next()) {
         auto val = Expression::eval(src, ctx(iter.get()));
@@ -55,7 +77,7 @@ Status GetNeighborsExecutor::buildRequestDataSet() {
             continue;
         }
         if (gn_->dedup()) {
-            auto ret = uniqueVid.emplace(val);
+            auto ret = uniqueVids_.emplace(val);
             if (ret.second) {
                 reqDs_.rows.emplace_back(Row({std::move(val)}));
             }
@@ -63,17 +85,56 @@ Status GetNeighborsExecutor::buildRequestDataSet() {
             reqDs_.rows.emplace_back(Row({std::move(val)}));
         }
     }
+    lookupCache();
     return Status::OK();
 }
 
+std::string GetNeighborsExecutor::cacheRequest() const {
+    // The random, order by and limit are applied over the neighbors of all the vertices
+    auto& cache = VertexRowCache::instance(VertexRowCache::Kind::kNeighbor);
+    if (!cache.enabled() || gn_->random() || !gn_->orderBy().empty() ||
+        gn_->limit() != std::numeric_limits<int64_t>::max()) {
+        return "";
+    }
+    folly::dynamic request = folly::dynamic::object();
+    request.insert("edgeTypes", util::toJson(gn_->edgeTypes()));
+    request.insert("edgeDirection", static_cast<int32_t>(gn_->edgeDirection()));
+    request.insert("vertexProps",
+                   gn_->vertexProps() ? util::toJson(*gn_->vertexProps()) : nullptr);
+    request.insert("edgeProps", gn_->edgeProps() ? util::toJson(*gn_->edgeProps()) : nullptr);
+    request.insert("statProps", gn_->statProps() ? util::toJson(*gn_->statProps()) : nullptr);
+    request.insert("exprs", gn_->exprs() ? util::toJson(*gn_->exprs()) : nullptr);
+    request.insert("dedup", gn_->dedup());
+    request.insert("filter", gn_->filter());
+    folly::json::serialization_opts opts;
+    opts.sort_keys = true;
+    return folly::json::serialize(request, opts);
+}
+
+void GetNeighborsExecutor::lookupCache() {
+    cacheRequest_ = cacheRequest();
+    if (cacheRequest_.empty() || reqDs_.rows.empty()) {
+        return;
+    }
+    VertexRowCache::instance(VertexRowCache::Kind::kNeighbor)
+        .lookup(gn_->space(), cacheRequest_, &reqDs_.rows, &cachedDs_);
+}
+
 folly::Future<Status> GetNeighborsExecutor::getNeighbors() {
+    if (reqDs_.rows.empty() && !cachedDs_.empty()) {
+        SCOPED_TIMER(&execTime_);
+        VLOG(1) << "All the neighbors are cached.";
+        List list;
+        for (auto& ds : cachedDs_) {
+            list.values.emplace_back(std::move(ds));
+        }
+        return finishNeighbors(Value(std::move(list)), Result::State::kSuccess);
+    }
     if (reqDs_.rows.empty()) {
+        SCOPED_TIMER(&execTime_);
         LOG(INFO) << "Empty input.";
         DataSet emptyResult;
-        return finish(ResultBuilder()
-                          .value(Value(std::move(emptyResult)))
-                          .iter(Iterator::Kind::kGetNeighbors)
-                          .finish());
+        return finishNeighbors(Value(std::move(emptyResult)), Result::State::kSuccess);
     }
 
     time::Duration getNbrTime;
@@ -96,6 +157,8 @@ folly::Future<Status> GetNeighborsExecutor::getNeighbors() {
         .via(runner())
         .ensure([getNbrTime]() {
             VLOG(1) << "Get neighbors time: " << getNbrTime.elapsedInUSec() << "us";
+            GraphStats::addStorageRpcLatency(GraphStats::StorageRpc::kGetNeighbors,
+                                             getNbrTime.elapsedInUSec());
         })
         .then([this](StorageRpcResponse<GetNeighborsResponse>&& resp) {
             SCOPED_TIMER(&execTime_);
@@ -106,8 +169,6 @@ folly::Future<Status> GetNeighborsExecutor::getNeighbors() {
 Status GetNeighborsExecutor::handleResponse(RpcResponse& resps) {
     auto result = handleCompleteness(resps, false);
     NG_RETURN_IF_ERROR(result);
-    ResultBuilder builder;
-    builder.state(result.value());
 
     auto& responses = resps.responses();
     VLOG(1) << "Resp size: " << responses.size();
@@ -120,10 +181,16 @@ Status GetNeighborsExecutor::handleResponse(RpcResponse& resps) {
         }
 
         VLOG(1) << "Resp row size: " << dataset->rows.size() << "Resp : " << *dataset;
+        if (!cacheRequest_.empty()) {
+            VertexRowCache::instance(VertexRowCache::Kind::kNeighbor)
+                .putAll(gn_->space(), cacheRequest_, *dataset);
+        }
         list.values.emplace_back(std::move(*dataset));
     }
-    builder.value(Value(std::move(list)));
-    return finish(builder.iter(Iterator::Kind::kGetNeighbors).finish());
+    for (auto& ds : cachedDs_) {
+        list.values.emplace_back(std::move(ds));
+    }
+    return finishNeighbors(Value(std::move(list)), result.value());
 }
 
 }   // namespace graph
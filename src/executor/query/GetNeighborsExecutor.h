@@ -7,6 +7,7 @@
 #ifndef EXECUTOR_QUERY_GETNEIGHBORSEXECUTOR_H_
 #define EXECUTOR_QUERY_GETNEIGHBORSEXECUTOR_H_
 
+#include <unordered_set>
 #include <vector>
 
 #include "common/base/StatusOr.h"
@@ -20,19 +21,36 @@
 
 namespace nebula {
 namespace graph {
-class GetNeighborsExecutor final : public QueryStorageExecutor {
+class GetNeighborsExecutor : public QueryStorageExecutor {
 public:
     GetNeighborsExecutor(const PlanNode *node, QueryContext *qctx)
-        : QueryStorageExecutor("GetNeighborsExecutor", node, qctx) {
-        gn_ = asNode<GetNeighbors>(node);
-    }
+        : GetNeighborsExecutor("GetNeighborsExecutor", asNode<GetNeighbors>(node), node, qctx) {}
 
     folly::Future<Status> execute() override;
 
     Status close() override;
 
+    void recycle() override;
+
+protected:
+    // The executors which consume the neighbors at once, e.g. the fused ones
+    GetNeighborsExecutor(const std::string &name,
+                         const GetNeighbors *gn,
+                         const PlanNode *node,
+                         QueryContext *qctx)
+        : QueryStorageExecutor(name, node, qctx), gn_(gn) {}
+
+    // Output the neighbors, a list of the datasets of the storage
+    virtual Status finishNeighbors(Value &&neighbors, Result::State state);
+
+    // Clear the members
+    void reset();
+
+    const GetNeighbors*   gn_;
+
 private:
     friend class GetNeighborsTest_BuildRequestDataSet_Test;
+    friend class GetNeighborsTest_NeighborCache_Test;
     Status buildRequestDataSet();
 
     folly::Future<Status> getNeighbors();
@@ -40,9 +58,19 @@ private:
     using RpcResponse = storage::StorageRpcResponse<storage::cpp2::GetNeighborsResponse>;
     Status handleResponse(RpcResponse& resps);
 
+    // The key of the request in the neighbor cache, empty if it's not cacheable
+    std::string cacheRequest() const;
+
+    // Take the cached vids out of the request
+    void lookupCache();
+
 private:
-    DataSet               reqDs_;
-    const GetNeighbors*   gn_;
+    DataSet                     reqDs_;
+    // Cleared but kept across the executions in a loop, so are the buckets
+    std::unordered_set<Value>   uniqueVids_;
+    std::string                 cacheRequest_;
+    // The rows got from the neighbor cache, grouped by the column names
+    std::vector<DataSet>        cachedDs_;
 };
 
 }   // namespace graph
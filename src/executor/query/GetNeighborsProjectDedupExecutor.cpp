@@ -0,0 +1,126 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "executor/query/GetNeighborsProjectDedupExecutor.h"
+
+#include "context/QueryExpressionContext.h"
+#include "executor/query/DedupExecutor.h"
+#include "parser/Clauses.h"
+#include "planner/Query.h"
+#include "util/ScopedTimer.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+// The rows are kept in the output dataset, which is reserved in advance
+struct RowPtrHash {
+    size_t operator()(const Row* row) const {
+        return std::hash<Row>()(*row);
+    }
+};
+
+struct RowPtrEqual {
+    bool operator()(const Row* lhs, const Row* rhs) const {
+        return *lhs == *rhs;
+    }
+};
+
+}   // namespace
+
+Status GetNeighborsProjectDedupExecutor::close() {
+    // Attributed to the fused nodes, the projection and the dedup share a
+    // single pass, whose time is attributed to the Project
+    auto totalDuration = static_cast<int64_t>(totalDuration_.elapsedInUSec());
+    auto projectDedupTime = static_cast<int64_t>(projectDedupTime_);
+    addProfilingStats(fused_->getNeighbors(),
+                      numNeighbors_,
+                      static_cast<int64_t>(execTime_) - projectDedupTime,
+                      neighborsDuration_);
+    addProfilingStats(fused_->project(), numProjected_, projectDedupTime, projectDedupTime);
+    addProfilingStats(fused_->dedup(),
+                      numRows_,
+                      0,
+                      std::max<int64_t>(totalDuration - neighborsDuration_ - projectDedupTime, 0));
+    numNeighbors_ = 0;
+    numProjected_ = 0;
+    neighborsDuration_ = 0;
+    projectDedupTime_ = 0;
+    reset();
+    return Status::OK();
+}
+
+void GetNeighborsProjectDedupExecutor::recycle() {
+    GetNeighborsExecutor::recycle();
+    numNeighbors_ = 0;
+    numProjected_ = 0;
+    neighborsDuration_ = 0;
+    projectDedupTime_ = 0;
+    seeded_ = false;
+    visited_.clear();
+}
+
+Status GetNeighborsProjectDedupExecutor::finishNeighbors(Value&& neighbors,
+                                                         Result::State state) {
+    neighborsDuration_ = totalDuration_.elapsedInUSec();
+    SCOPED_TIMER(&projectDedupTime_);
+    if (fused_->dedup()->frontier() && !seeded_) {
+        seeded_ = true;
+        NG_RETURN_IF_ERROR(DedupExecutor::seedFrontier(ectx_, node()->outputVar(), &visited_));
+    }
+
+    std::unique_ptr<Iterator> iter;
+    if (fused_->keepNeighbors()) {
+        auto result = ResultBuilder()
+                          .state(state)
+                          .value(std::move(neighbors))
+                          .iter(Iterator::Kind::kGetNeighbors)
+                          .finish();
+        iter = result.iter();
+        ectx_->setResult(gn_->outputVar(), std::move(result));
+    } else {
+        iter = std::make_unique<GetNeighborsIter>(std::make_shared<Value>(std::move(neighbors)));
+    }
+    numNeighbors_ = iter->size();
+    auto ds = projectDedup(iter.get());
+    VLOG(1) << node()->outputVar() << ":" << ds;
+    return finish(ResultBuilder().value(Value(std::move(ds))).finish());
+}
+
+DataSet GetNeighborsProjectDedupExecutor::projectDedup(Iterator* iter) {
+    auto columns = fused_->project()->columns()->columns();
+    QueryExpressionContext ctx(ectx_);
+    DataSet ds;
+    ds.colNames = fused_->dedup()->colNames();
+    // No reallocation, the unique set refers to the rows
+    ds.rows.reserve(iter->size());
+    std::unordered_set<const Row*, RowPtrHash, RowPtrEqual> unique;
+    auto frontier = fused_->dedup()->frontier();
+    numProjected_ = 0;
+    for (; iter->valid(); iter->next()) {
+        Row row;
+        row.values.reserve(columns.size());
+        for (auto& col : columns) {
+            row.values.emplace_back(col->expr()->eval(ctx(iter)));
+        }
+        ++numProjected_;
+        if (frontier) {
+            if (visited_.emplace(row).second) {
+                ds.rows.emplace_back(std::move(row));
+            }
+            continue;
+        }
+        ds.rows.emplace_back(std::move(row));
+        if (!unique.emplace(&ds.rows.back()).second) {
+            ds.rows.pop_back();
+        }
+    }
+    return ds;
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,53 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef EXECUTOR_QUERY_GETNEIGHBORSPROJECTDEDUPEXECUTOR_H_
+#define EXECUTOR_QUERY_GETNEIGHBORSPROJECTDEDUPEXECUTOR_H_
+
+#include "executor/query/GetNeighborsExecutor.h"
+
+namespace nebula {
+namespace graph {
+
+class GetNeighborsProjectDedupExecutor final : public GetNeighborsExecutor {
+public:
+    GetNeighborsProjectDedupExecutor(const PlanNode *node, QueryContext *qctx)
+        : GetNeighborsExecutor("GetNeighborsProjectDedupExecutor",
+                               asNode<GetNeighborsProjectDedup>(node)->getNeighbors(),
+                               node,
+                               qctx) {
+        fused_ = asNode<GetNeighborsProjectDedup>(node);
+    }
+
+    Status close() override;
+
+    void recycle() override;
+
+private:
+    friend class GetNeighborsProjectDedupTest_ProjectDedup_Test;
+    friend class GetNeighborsProjectDedupTest_Frontier_Test;
+    friend class GetNeighborsProjectDedupTest_KeepNeighbors_Test;
+
+    Status finishNeighbors(Value &&neighbors, Result::State state) override;
+
+    // Project each neighbor and drop the duplicate rows in a single pass
+    DataSet projectDedup(Iterator *iter);
+
+private:
+    const GetNeighborsProjectDedup*     fused_;
+    // The stats of the fused stages
+    int64_t                             numNeighbors_{0};
+    int64_t                             numProjected_{0};
+    int64_t                             neighborsDuration_{0};
+    uint64_t                            projectDedupTime_{0};
+    bool                                seeded_{false};
+    std::unordered_set<Row>             visited_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // EXECUTOR_QUERY_GETNEIGHBORSPROJECTDEDUPEXECUTOR_H_
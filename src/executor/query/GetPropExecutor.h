@@ -18,8 +18,10 @@ protected:
     GetPropExecutor(const std::string &name, const PlanNode *node, QueryContext *qctx)
         : QueryStorageExecutor(name, node, qctx) {}
 
+    // Merge the responses and the rows got from the cache into one DataSet
     Status handleResp(storage::StorageRpcResponse<storage::cpp2::GetPropResponse> &&rpcResp,
-                      const std::vector<std::string> &colNames) {
+                      const std::vector<std::string> &colNames,
+                      std::vector<nebula::DataSet> &&cached = {}) {
         auto result = handleCompleteness(rpcResp, false);
         NG_RETURN_IF_ERROR(result);
         auto state = std::move(result).value();
@@ -36,6 +38,21 @@ protected:
                 state = Result::State::kPartialSuccess;
             }
         }
+        for (auto &ds : cached) {
+            if (v.colNames.empty()) {
+                v.colNames = ds.colNames;
+            }
+            if (UNLIKELY(!v.append(std::move(ds)))) {
+                LOG(WARNING) << "Heterogeneous cached props dataset";
+                state = Result::State::kPartialSuccess;
+            }
+        }
+        return finishProps(std::move(v), state, colNames);
+    }
+
+    Status finishProps(nebula::DataSet &&v,
+                       Result::State state,
+                       const std::vector<std::string> &colNames) {
         if (!colNames.empty()) {
             DCHECK_EQ(colNames.size(), v.colSize());
             v.colNames = colNames;
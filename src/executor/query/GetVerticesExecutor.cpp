@@ -5,10 +5,16 @@
  */
 
 #include "executor/query/GetVerticesExecutor.h"
+
+#include <folly/json.h>
+
 #include "planner/Query.h"
 #include "context/QueryContext.h"
+#include "context/VertexRowCache.h"
+#include "util/GraphStats.h"
 #include "util/SchemaUtil.h"
 #include "util/ScopedTimer.h"
+#include "util/ToJson.h"
 
 using nebula::storage::GraphStorageClient;
 using nebula::storage::StorageRpcResponse;
@@ -50,6 +56,23 @@ folly::Future<Status> GetVerticesExecutor::getVertices() {
         return finish(ResultBuilder().value(Value(DataSet(gv->colNames()))).finish());
     }
 
+    // Only the missed vertices are got from the storage
+    auto& cache = VertexRowCache::instance(VertexRowCache::Kind::kVertexProp);
+    auto request = cacheRequest(gv);
+    std::vector<DataSet> cached;
+    if (!request.empty()) {
+        cache.lookup(gv->space(), request, &vertices.rows, &cached);
+        if (vertices.rows.empty()) {
+            VLOG(1) << "All the vertices are cached.";
+            DataSet v;
+            v.colNames = cached.front().colNames;
+            for (auto& ds : cached) {
+                v.append(std::move(ds));
+            }
+            return finishProps(std::move(v), Result::State::kSuccess, gv->colNamesRef());
+        }
+    }
+
     time::Duration getPropsTime;
     return DCHECK_NOTNULL(storageClient)
         ->getProps(gv->space(),
@@ -64,12 +87,41 @@ folly::Future<Status> GetVerticesExecutor::getVertices() {
         .via(runner())
         .ensure([getPropsTime]() {
             VLOG(1) << "Get props time: " << getPropsTime.elapsedInUSec() << "us";
+            GraphStats::addStorageRpcLatency(GraphStats::StorageRpc::kGetProps,
+                                             getPropsTime.elapsedInUSec());
         })
-        .then([this, gv](StorageRpcResponse<GetPropResponse> &&rpcResp) {
+        .then([this, gv, request = std::move(request), cached = std::move(cached)](
+                  StorageRpcResponse<GetPropResponse> &&rpcResp) mutable {
             SCOPED_TIMER(&execTime_);
-            return handleResp(std::move(rpcResp), gv->colNamesRef());
+            if (!request.empty()) {
+                auto& cache = VertexRowCache::instance(VertexRowCache::Kind::kVertexProp);
+                for (auto& resp : rpcResp.responses()) {
+                    if (resp.__isset.props) {
+                        cache.putAll(gv->space(), request, *resp.get_props());
+                    }
+                }
+            }
+            return handleResp(std::move(rpcResp), gv->colNamesRef(), std::move(cached));
         });
 }
 
+// static
+std::string GetVerticesExecutor::cacheRequest(const GetVertices* gv) {
+    // The order by and limit are applied over all the vertices
+    auto& cache = VertexRowCache::instance(VertexRowCache::Kind::kVertexProp);
+    if (!cache.enabled() || !gv->orderBy().empty() ||
+        gv->limit() != std::numeric_limits<int64_t>::max()) {
+        return "";
+    }
+    folly::dynamic request = folly::dynamic::object();
+    request.insert("props", util::toJson(gv->props()));
+    request.insert("exprs", util::toJson(gv->exprs()));
+    request.insert("dedup", gv->dedup());
+    request.insert("filter", gv->filter());
+    folly::json::serialization_opts opts;
+    opts.sort_keys = true;
+    return folly::json::serialize(request, opts);
+}
+
 }   // namespace graph
 }   // namespace nebula
@@ -12,6 +12,8 @@
 namespace nebula {
 namespace graph {
 
+class GetVertices;
+
 class GetVerticesExecutor final : public GetPropExecutor {
 public:
     GetVerticesExecutor(const PlanNode *node, QueryContext *qctx)
@@ -21,6 +23,9 @@ public:
 
 private:
     folly::Future<Status> getVertices();
+
+    // The key of the request in the vertex cache, empty if it's not cacheable
+    static std::string cacheRequest(const GetVertices* gv);
 };
 
 }   // namespace graph
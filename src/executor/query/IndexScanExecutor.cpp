@@ -7,7 +7,9 @@
 #include "executor/query/IndexScanExecutor.h"
 
 #include "planner/PlanNode.h"
+#include "context/IndexStats.h"
 #include "context/QueryContext.h"
+#include "util/GraphStats.h"
 
 using nebula::storage::StorageRpcResponse;
 using nebula::storage::cpp2::LookupIndexResp;
@@ -17,48 +19,242 @@ namespace nebula {
 namespace graph {
 
 folly::Future<Status> IndexScanExecutor::execute() {
+    if (gn_->intersect()) {
+        return indexIntersect();
+    }
     return indexScan();
 }
 
 folly::Future<Status> IndexScanExecutor::indexScan() {
     GraphStorageClient* storageClient = qctx_->getStorageClient();
     auto *lookup = asNode<IndexScan>(node());
+    time::Duration lookupTime;
     return storageClient->lookupIndex(lookup->space(),
                                       *lookup->queryContext(),
                                       lookup->isEdge(),
                                       lookup->schemaId(),
                                       *lookup->returnColumns())
         .via(runner())
+        .ensure([lookupTime]() {
+            VLOG(1) << "Lookup index time: " << lookupTime.elapsedInUSec() << "us";
+            GraphStats::addStorageRpcLatency(GraphStats::StorageRpc::kLookupIndex,
+                                             lookupTime.elapsedInUSec());
+        })
         .then([this](StorageRpcResponse<LookupIndexResp> &&rpcResp) {
             return handleResp(std::move(rpcResp));
         });
 }
 
+folly::Future<Status> IndexScanExecutor::indexIntersect() {
+    GraphStorageClient* storageClient = qctx_->getStorageClient();
+    std::vector<folly::Future<StorageRpcResponse<LookupIndexResp>>> futures;
+    for (const auto &ctx : *gn_->queryContext()) {
+        futures.emplace_back(storageClient->lookupIndex(
+            gn_->space(), {ctx}, gn_->isEdge(), gn_->schemaId(), *gn_->returnColumns()));
+    }
+    time::Duration lookupTime;
+    return folly::collect(futures)
+        .via(runner())
+        .ensure([lookupTime]() {
+            VLOG(1) << "Lookup index time: " << lookupTime.elapsedInUSec() << "us";
+            GraphStats::addStorageRpcLatency(GraphStats::StorageRpc::kLookupIndex,
+                                             lookupTime.elapsedInUSec());
+        })
+        .then([this](std::vector<StorageRpcResponse<LookupIndexResp>> &&rpcResps) {
+            auto state = Result::State::kSuccess;
+            std::vector<DataSet> results;
+            results.reserve(rpcResps.size());
+            for (size_t i = 0; i < rpcResps.size(); ++i) {
+                auto ctxState = Result::State::kSuccess;
+                auto result = collectResp(std::move(rpcResps[i]), &ctxState);
+                NG_RETURN_IF_ERROR(result);
+                if (ctxState == Result::State::kSuccess) {
+                    IndexStats::instance().add(gn_->space(),
+                                               (*gn_->queryContext())[i],
+                                               result.value().rows.size());
+                } else {
+                    state = ctxState;
+                }
+                results.emplace_back(std::move(result).value());
+            }
+            auto ds = intersect(std::move(results));
+            sortAndLimit(&ds);
+            return finish(ResultBuilder()
+                              .value(std::move(ds))
+                              .iter(Iterator::Kind::kSequential)
+                              .state(state)
+                              .finish());
+        });
+}
+
 template <typename Resp>
 Status IndexScanExecutor::handleResp(storage::StorageRpcResponse<Resp> &&rpcResp) {
+    auto state = Result::State::kSuccess;
+    auto result = collectResp(std::move(rpcResp), &state);
+    NG_RETURN_IF_ERROR(result);
+    auto v = std::move(result).value();
+    const auto &contexts = *gn_->queryContext();
+    if (contexts.size() == 1 && state == Result::State::kSuccess) {
+        IndexStats::instance().add(gn_->space(), contexts.front(), v.rows.size());
+    }
+    if (contexts.size() > 1 && gn_->dedup()) {
+        // The same one may be hit by several query contexts
+        dedup(&v);
+    }
+    sortAndLimit(&v);
+    return finish(ResultBuilder()
+                      .value(std::move(v))
+                      .iter(Iterator::Kind::kSequential)
+                      .state(state)
+                      .finish());
+}
+
+template <typename Resp>
+StatusOr<DataSet> IndexScanExecutor::collectResp(storage::StorageRpcResponse<Resp> &&rpcResp,
+                                                 Result::State *state) const {
     auto completeness = handleCompleteness(rpcResp, false);
     if (!completeness.ok()) {
         return std::move(completeness).status();
     }
-    auto state = std::move(completeness).value();
+    *state = std::move(completeness).value();
     nebula::DataSet v;
     for (auto &resp : rpcResp.responses()) {
         if (resp.__isset.data) {
             nebula::DataSet* data = resp.get_data();
-            // TODO : convert the column name to alias.
             if (v.colNames.empty()) {
                 v.colNames = data->colNames;
             }
-            v.rows.insert(v.rows.end(), data->rows.begin(), data->rows.end());
+            v.rows.insert(v.rows.end(),
+                          std::make_move_iterator(data->rows.begin()),
+                          std::make_move_iterator(data->rows.end()));
         } else {
-            state = Result::State::kPartialSuccess;
+            *state = Result::State::kPartialSuccess;
         }
     }
-    return finish(ResultBuilder()
-                      .value(std::move(v))
-                      .iter(Iterator::Kind::kSequential)
-                      .state(state)
-                      .finish());
+    // Named by the columns of LOOKUP
+    auto colNames = gn_->colNames();
+    if (!colNames.empty() && (v.colNames.empty() || v.colNames.size() == colNames.size())) {
+        v.colNames = colNames;
+    }
+    return v;
+}
+
+DataSet IndexScanExecutor::intersect(std::vector<DataSet> &&results) const {
+    auto size = keySize();
+    auto less = [size](const Row &lhs, const Row &rhs) {
+        for (size_t i = 0; i < size; ++i) {
+            if (lhs.values[i] < rhs.values[i]) {
+                return true;
+            }
+            if (rhs.values[i] < lhs.values[i]) {
+                return false;
+            }
+        }
+        return false;
+    };
+    DataSet ds;
+    for (auto &result : results) {
+        if (ds.colNames.empty()) {
+            ds.colNames = result.colNames;
+        }
+        if (result.rows.empty()) {
+            return ds;
+        }
+        // The prefix scans of a partition are mostly sorted by the key already
+        if (!std::is_sorted(result.rows.begin(), result.rows.end(), less)) {
+            std::sort(result.rows.begin(), result.rows.end(), less);
+        }
+    }
+    // Driven by the smallest one
+    auto smallest = std::min_element(
+        results.begin(), results.end(), [](const DataSet &lhs, const DataSet &rhs) {
+            return lhs.rows.size() < rhs.rows.size();
+        });
+    std::swap(*smallest, results.front());
+
+    std::vector<size_t> pos(results.size(), 0);
+    for (auto &row : results.front().rows) {
+        if (!ds.rows.empty() && !less(ds.rows.back(), row)) {
+            continue;
+        }
+        bool hit = true;
+        for (size_t i = 1; i < results.size() && hit; ++i) {
+            auto &rows = results[i].rows;
+            auto found = std::lower_bound(rows.begin() + pos[i], rows.end(), row, less);
+            pos[i] = found - rows.begin();
+            hit = found != rows.end() && !less(row, *found);
+        }
+        if (hit) {
+            ds.rows.emplace_back(std::move(row));
+        }
+    }
+    return ds;
+}
+
+void IndexScanExecutor::dedup(DataSet *ds) const {
+    auto size = keySize();
+    std::unordered_set<Row> unique;
+    auto end = std::remove_if(ds->rows.begin(), ds->rows.end(), [size, &unique](const Row &row) {
+        Row key;
+        key.values.assign(row.values.begin(), row.values.begin() + size);
+        return !unique.emplace(std::move(key)).second;
+    });
+    ds->rows.erase(end, ds->rows.end());
+}
+
+void IndexScanExecutor::sortAndLimit(DataSet *ds) const {
+    auto &rows = ds->rows;
+    auto limit = std::min<size_t>(std::max<int64_t>(gn_->limit(), 0), rows.size());
+    const auto &factors = gn_->sortFactors();
+    if (factors.empty() || rows.empty()) {
+        rows.erase(rows.begin() + limit, rows.end());
+        return;
+    }
+    auto less = [&factors](const Row &lhs, const Row &rhs) {
+        for (const auto &factor : factors) {
+            const auto &l = lhs.values[factor.first];
+            const auto &r = rhs.values[factor.first];
+            if (l == r) {
+                continue;
+            }
+            return factor.second == OrderFactor::OrderType::ASCEND ? l < r : l > r;
+        }
+        return false;
+    };
+
+    // The sorted runs, i.e. the partitions if they are ordered by the index
+    std::vector<std::pair<size_t, size_t>> runs;
+    size_t begin = 0;
+    for (size_t i = 1; i <= rows.size(); ++i) {
+        if (i == rows.size() || less(rows[i], rows[i - 1])) {
+            runs.emplace_back(begin, i);
+            begin = i;
+        }
+    }
+    if (runs.size() == 1) {
+        rows.erase(rows.begin() + limit, rows.end());
+        return;
+    }
+
+    // Merge the heads of the runs till the limit is reached
+    auto greater = [&rows, &less](const std::pair<size_t, size_t> &lhs,
+                                  const std::pair<size_t, size_t> &rhs) {
+        return less(rows[rhs.first], rows[lhs.first]);
+    };
+    std::make_heap(runs.begin(), runs.end(), greater);
+    std::vector<Row> merged;
+    merged.reserve(limit);
+    while (merged.size() < limit) {
+        std::pop_heap(runs.begin(), runs.end(), greater);
+        auto &run = runs.back();
+        merged.emplace_back(std::move(rows[run.first++]));
+        if (run.first == run.second) {
+            runs.pop_back();
+        } else {
+            std::push_heap(runs.begin(), runs.end(), greater);
+        }
+    }
+    rows = std::move(merged);
 }
 
 }   // namespace graph
@@ -23,13 +23,40 @@ public:
     }
 
 private:
+    friend class IndexScanTest_Intersect_Test;
+    friend class IndexScanTest_Dedup_Test;
+    friend class IndexScanTest_Limit_Test;
+    friend class IndexScanTest_SortedMerge_Test;
+
     folly::Future<Status> execute() override;
 
     folly::Future<Status> indexScan();
 
+    // Look up each query context by itself and intersect the results
+    folly::Future<Status> indexIntersect();
+
     template <typename Resp>
     Status handleResp(storage::StorageRpcResponse<Resp> &&rpcResp);
 
+    // The rows of all the responses
+    template <typename Resp>
+    StatusOr<DataSet> collectResp(storage::StorageRpcResponse<Resp> &&rpcResp,
+                                  Result::State *state) const;
+
+    // The vertex or the edge of the row, i.e. the leading vid, or src, ranking and dst
+    size_t keySize() const {
+        return gn_->isEdge() ? 3 : 1;
+    }
+
+    // The rows whose keys are in all the results
+    DataSet intersect(std::vector<DataSet> &&results) const;
+
+    void dedup(DataSet *ds) const;
+
+    // Keep at most limit() rows, which are merged from the sorted runs by the
+    // sortFactors() if they are set
+    void sortAndLimit(DataSet *ds) const;
+
 private:
     const IndexScan *   gn_;
 };
@@ -0,0 +1,141 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "executor/query/ScanVerticesExecutor.h"
+
+#include "context/QueryContext.h"
+#include "service/GraphFlags.h"
+#include "util/GraphStats.h"
+#include "util/ScopedTimer.h"
+
+using nebula::storage::GraphStorageClient;
+using nebula::storage::cpp2::ScanVertexRequest;
+using nebula::storage::cpp2::ScanVertexResponse;
+
+namespace nebula {
+namespace graph {
+
+folly::Future<Status> ScanVerticesExecutor::execute() {
+    SCOPED_TIMER(&execTime_);
+    auto *scan = asNode<ScanVertices>(node());
+    auto partsNum = qctx()->getMetaClient()->partsNum(scan->space());
+    if (!partsNum.ok()) {
+        return error(std::move(partsNum).status());
+    }
+    // Popped from the back, so the partitions are scanned in order
+    for (PartitionID part = partsNum.value(); part > 0; --part) {
+        pending_.emplace_back(part);
+    }
+
+    auto concurrency = std::max(1, std::min(FLAGS_scan_parts_concurrency, partsNum.value()));
+    std::vector<folly::Future<Status>> futures;
+    futures.reserve(concurrency);
+    for (auto i = 0; i < concurrency; ++i) {
+        futures.emplace_back(scanParts());
+    }
+    return folly::collect(futures).via(runner()).then([this](std::vector<Status> &&results) {
+        SCOPED_TIMER(&execTime_);
+        for (auto &status : results) {
+            NG_RETURN_IF_ERROR(status);
+        }
+        auto limit = asNode<ScanVertices>(node())->limit();
+        if (result_.rows.size() > static_cast<size_t>(limit)) {
+            result_.rows.resize(limit);
+        }
+        return finish(ResultBuilder()
+                          .value(Value(std::move(result_)))
+                          .iter(Iterator::Kind::kSequential)
+                          .finish());
+    });
+}
+
+void ScanVerticesExecutor::recycle() {
+    // Left by a failed scan
+    pending_.clear();
+    result_ = DataSet();
+}
+
+folly::Future<Status> ScanVerticesExecutor::scanParts() {
+    PartitionID part;
+    {
+        std::lock_guard<std::mutex> g(lock_);
+        if (pending_.empty()) {
+            return Status::OK();
+        }
+        part = pending_.back();
+        pending_.pop_back();
+    }
+    return scanPart(part, "");
+}
+
+folly::Future<Status> ScanVerticesExecutor::scanPart(PartitionID part, std::string cursor) {
+    auto size = batchSize();
+    if (size == 0) {
+        return Status::OK();
+    }
+    auto *scan = asNode<ScanVertices>(node());
+    ScanVertexRequest req;
+    req.set_space_id(scan->space());
+    req.set_part_id(part);
+    if (!cursor.empty()) {
+        req.set_cursor(std::move(cursor));
+    }
+    req.set_return_columns(scan->props());
+    req.set_limit(size);
+    if (!scan->filter().empty()) {
+        req.set_filter(scan->filter());
+    }
+
+    GraphStorageClient *storageClient = qctx()->getStorageClient();
+    time::Duration scanTime;
+    return storageClient->scanVertex(req)
+        .via(runner())
+        .ensure([scanTime]() {
+            GraphStats::addStorageRpcLatency(GraphStats::StorageRpc::kScanVertex,
+                                             scanTime.elapsedInUSec());
+        })
+        .then([this, part](StatusOr<ScanVertexResponse> &&result) -> folly::Future<Status> {
+            if (!result.ok()) {
+                return std::move(result).status();
+            }
+            auto resp = std::move(result).value();
+            auto &failedParts = resp.get_result().get_failed_parts();
+            if (!failedParts.empty()) {
+                return handleErrorCode(failedParts.front().get_code(), part);
+            }
+            append(std::move(resp.vertex_data));
+            if (resp.get_has_next() && resp.get_next_cursor() != nullptr) {
+                return scanPart(part, *resp.get_next_cursor());
+            }
+            return scanParts();
+        });
+}
+
+int64_t ScanVerticesExecutor::batchSize() {
+    auto limit = asNode<ScanVertices>(node())->limit();
+    std::lock_guard<std::mutex> g(lock_);
+    auto rows = static_cast<int64_t>(result_.rows.size());
+    if (rows >= limit) {
+        return 0;
+    }
+    return std::min(FLAGS_scan_batch_size, limit - rows);
+}
+
+void ScanVerticesExecutor::append(DataSet &&batch) {
+    std::lock_guard<std::mutex> g(lock_);
+    if (result_.colNames.empty()) {
+        // Named by the tag in storage, but by the plan in the later nodes
+        auto &colNames = node()->colNames();
+        result_.colNames = colNames.size() == batch.colNames.size() ? colNames
+                                                                    : std::move(batch.colNames);
+    }
+    result_.rows.insert(result_.rows.end(),
+                        std::make_move_iterator(batch.rows.begin()),
+                        std::make_move_iterator(batch.rows.end()));
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,50 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef EXECUTOR_QUERY_SCANVERTICESEXECUTOR_H_
+#define EXECUTOR_QUERY_SCANVERTICESEXECUTOR_H_
+
+#include "common/interface/gen-cpp2/storage_types.h"
+#include "common/clients/storage/GraphStorageClient.h"
+#include "executor/QueryStorageExecutor.h"
+#include "planner/Query.h"
+
+namespace nebula {
+namespace graph {
+
+// Scan the partitions in parallel, at most FLAGS_scan_parts_concurrency of
+// them at a time. Each partition is scanned batch by batch through the cursor,
+// and it stops as soon as there are enough vertices for the limit.
+class ScanVerticesExecutor final : public QueryStorageExecutor {
+public:
+    ScanVerticesExecutor(const PlanNode *node, QueryContext *qctx)
+        : QueryStorageExecutor("ScanVerticesExecutor", node, qctx) {}
+
+private:
+    folly::Future<Status> execute() override;
+
+    void recycle() override;
+
+    // Scan the pending partitions one by one until all of them are done
+    folly::Future<Status> scanParts();
+
+    folly::Future<Status> scanPart(PartitionID part, std::string cursor);
+
+    // Returns the max vertices of the next batch, 0 if there are enough
+    int64_t batchSize();
+
+    void append(DataSet &&batch);
+
+private:
+    std::mutex                      lock_;
+    std::vector<PartitionID>        pending_;
+    DataSet                         result_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // EXECUTOR_QUERY_SCANVERTICESEXECUTOR_H_
@@ -0,0 +1,249 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "executor/query/TraverseExecutor.h"
+
+#include "context/QueryContext.h"
+#include "util/GraphStats.h"
+#include "util/SchemaUtil.h"
+#include "util/ScopedTimer.h"
+
+using nebula::storage::GraphStorageClient;
+
+namespace nebula {
+namespace graph {
+
+folly::Future<Status> TraverseExecutor::execute() {
+    {
+        SCOPED_TIMER(&execTime_);
+        buildFrontier();
+    }
+    return traverse();
+}
+
+Status TraverseExecutor::close() {
+    recycle();
+    return Executor::close();
+}
+
+void TraverseExecutor::recycle() {
+    frontier_.clear();
+    srcs_.clear();
+    srcIndex_.clear();
+    steps_.clear();
+}
+
+void TraverseExecutor::buildFrontier() {
+    auto iter = ectx_->getResult(traverse_->inputVar()).iter();
+    QueryExpressionContext ctx(ectx_);
+    const auto& spaceInfo = qctx()->rctx()->session()->space();
+    std::unordered_set<Value> uniqueVid;
+    frontier_.reserve(iter->size());
+    for (; iter->valid(); iter->next()) {
+        auto vid = Expression::eval(traverse_->src(), ctx(iter.get()));
+        if (!SchemaUtil::isValidVid(vid, spaceInfo.spaceDesc.vid_type)) {
+            continue;
+        }
+        if (uniqueVid.emplace(vid).second) {
+            frontier_.emplace_back(Row({std::move(vid)}));
+        }
+    }
+}
+
+bool TraverseExecutor::done() const {
+    auto maxSteps = std::max<int64_t>(traverse_->maxSteps(), 1);
+    return frontier_.empty() || static_cast<int64_t>(steps_.size()) >= maxSteps;
+}
+
+folly::Future<Status> TraverseExecutor::traverse() {
+    if (done()) {
+        SCOPED_TIMER(&execTime_);
+        return finish(ResultBuilder()
+                          .value(Value(collect()))
+                          .iter(Iterator::Kind::kSequential)
+                          .finish());
+    }
+
+    time::Duration getNbrTime;
+    GraphStorageClient* storageClient = qctx_->getStorageClient();
+    return storageClient
+        ->getNeighbors(traverse_->space(),
+                       {kVid},
+                       std::move(frontier_),
+                       {},
+                       traverse_->edgeDirection(),
+                       nullptr,
+                       // The props of the src vertices only
+                       steps_.empty() ? traverse_->vertexProps() : nullptr,
+                       traverse_->edgeProps(),
+                       nullptr,
+                       false,
+                       false,
+                       {},
+                       std::numeric_limits<int64_t>::max(),
+                       "")
+        .via(runner())
+        .ensure([getNbrTime]() {
+            GraphStats::addStorageRpcLatency(GraphStats::StorageRpc::kGetNeighbors,
+                                             getNbrTime.elapsedInUSec());
+        })
+        .then([this](RpcResponse&& resps) -> folly::Future<Status> {
+            {
+                SCOPED_TIMER(&execTime_);
+                auto result = handleCompleteness(resps, false);
+                if (!result.ok()) {
+                    return error(std::move(result).status());
+                }
+                List datasets;
+                for (auto& resp : resps.responses()) {
+                    auto dataset = resp.get_vertices();
+                    if (dataset != nullptr) {
+                        datasets.values.emplace_back(std::move(*dataset));
+                    }
+                }
+                auto status = expand(std::move(datasets));
+                if (!status.ok()) {
+                    return error(std::move(status));
+                }
+            }
+            return traverse();
+        });
+}
+
+Status TraverseExecutor::expand(List&& datasets) {
+    GetNeighborsIter iter(std::make_shared<Value>(std::move(datasets)));
+    auto level = steps_.size();
+    // No step in the range, e.g. *0, only the src vertices are returned
+    bool srcsOnly = static_cast<int64_t>(level) >= traverse_->maxSteps();
+    // The ends of the paths found in the last step
+    std::unordered_map<Value, std::vector<size_t>> ends;
+    if (level > 0) {
+        auto& last = steps_.back();
+        for (size_t i = 0; i < last.size(); ++i) {
+            ends[Value(last[i].edge.dst)].emplace_back(i);
+        }
+    }
+
+    std::vector<Step> steps;
+    QueryExpressionContext ctx(ectx_);
+    auto* filter = traverse_->edgeFilter();
+    for (; iter.valid(); iter.next()) {
+        if (level == 0) {
+            auto& vid = iter.getColumn(kVid);
+            if (srcIndex_.emplace(vid, srcs_.size()).second) {
+                srcs_.emplace_back(iter.getVertex());
+            }
+        }
+        if (srcsOnly) {
+            continue;
+        }
+        auto edgeVal = iter.getEdge();
+        if (!edgeVal.isEdge()) {
+            continue;
+        }
+        if (filter != nullptr) {
+            auto val = filter->eval(ctx(&iter));
+            if (!val.isBool() && !val.isNull()) {
+                return Status::Error("Wrong type result of the edge filter `%s'",
+                                     filter->toString().c_str());
+            }
+            if (val.isNull() || !val.getBool()) {
+                continue;
+            }
+        }
+        auto& edge = edgeVal.getEdge();
+        if (level == 0) {
+            auto found = srcIndex_.find(Value(edge.src));
+            if (found != srcIndex_.end()) {
+                steps.emplace_back(Step{found->second, edge});
+            }
+            continue;
+        }
+        auto found = ends.find(Value(edge.src));
+        if (found == ends.end()) {
+            continue;
+        }
+        for (auto prev : found->second) {
+            if (!inPath(edge, level, prev)) {
+                steps.emplace_back(Step{prev, edge});
+            }
+        }
+    }
+
+    frontier_.clear();
+    if (srcsOnly) {
+        return Status::OK();
+    }
+
+    // Only the distinct ends are expanded in the next step
+    std::unordered_set<Value> uniqueVid;
+    for (auto& step : steps) {
+        Value dst(step.edge.dst);
+        if (uniqueVid.emplace(dst).second) {
+            frontier_.emplace_back(Row({std::move(dst)}));
+        }
+    }
+    VLOG(1) << "Step " << level + 1 << ": " << steps.size() << " paths, "
+            << frontier_.size() << " vertices to expand";
+    steps_.emplace_back(std::move(steps));
+    return Status::OK();
+}
+
+bool TraverseExecutor::inPath(const Edge& edge, size_t level, size_t prev) const {
+    auto same = [&edge](const Edge& other) {
+        if (edge.ranking != other.ranking || std::abs(edge.type) != std::abs(other.type)) {
+            return false;
+        }
+        // The same edge is got reversely from the other end
+        if (edge.type == other.type) {
+            return edge.src == other.src && edge.dst == other.dst;
+        }
+        return edge.src == other.dst && edge.dst == other.src;
+    };
+    for (auto i = level; i > 0; --i) {
+        auto& step = steps_[i - 1][prev];
+        if (same(step.edge)) {
+            return true;
+        }
+        prev = step.prev;
+    }
+    return false;
+}
+
+DataSet TraverseExecutor::collect() const {
+    DataSet ds;
+    ds.colNames = traverse_->colNames();
+    if (traverse_->minSteps() == 0) {
+        for (auto& src : srcs_) {
+            if (src.isVertex()) {
+                ds.rows.emplace_back(Row({src, List(), Value(src.getVertex().vid)}));
+            }
+        }
+    }
+    auto begin = static_cast<size_t>(std::max<int64_t>(traverse_->minSteps(), 1));
+    for (auto level = begin; level <= steps_.size(); ++level) {
+        for (auto& last : steps_[level - 1]) {
+            std::vector<Value> edges(level);
+            auto* step = &last;
+            for (auto i = level; i > 0; --i) {
+                edges[i - 1] = Value(step->edge);
+                if (i > 1) {
+                    step = &steps_[i - 2][step->prev];
+                }
+            }
+            Row row;
+            row.values.reserve(3);
+            row.values.emplace_back(srcs_[step->prev]);
+            row.values.emplace_back(List(std::move(edges)));
+            row.values.emplace_back(Value(last.edge.dst));
+            ds.rows.emplace_back(std::move(row));
+        }
+    }
+    return ds;
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,83 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef EXECUTOR_QUERY_TRAVERSEEXECUTOR_H_
+#define EXECUTOR_QUERY_TRAVERSEEXECUTOR_H_
+
+#include "common/clients/storage/GraphStorageClient.h"
+#include "executor/QueryStorageExecutor.h"
+#include "planner/Query.h"
+
+namespace nebula {
+namespace graph {
+
+/**
+ * Expand the paths from the src vertices step by step, each step gets the
+ * neighbors of the distinct ends of the paths found in the last step only.
+ *
+ * The paths are kept as a tree: a step of a path refers to the step before
+ * it, so the paths sharing the prefix share the edges until they are output
+ * at last.
+ */
+class TraverseExecutor final : public QueryStorageExecutor {
+public:
+    TraverseExecutor(const PlanNode* node, QueryContext* qctx)
+        : QueryStorageExecutor("TraverseExecutor", node, qctx) {
+        traverse_ = asNode<Traverse>(node);
+    }
+
+    folly::Future<Status> execute() override;
+
+    Status close() override;
+
+    void recycle() override;
+
+private:
+    friend class TraverseTest;
+
+    struct Step {
+        // Index of the step before in the last step, or of the src vertex
+        // in srcs_ for the first step
+        size_t      prev;
+        Edge        edge;
+    };
+
+    // The distinct src vids of the input
+    void buildFrontier();
+
+    // Whether there is no more step to expand. The src vertices are got by
+    // the first expanding even if the max steps is 0.
+    bool done() const;
+
+    // Expand one step, then go on with the next one until the max steps or
+    // no more paths
+    folly::Future<Status> traverse();
+
+    // Build the next step by the neighbors of the frontier
+    Status expand(List&& datasets);
+
+    // Whether the edge is already in the path ending at the step
+    bool inPath(const Edge& edge, size_t step, size_t prev) const;
+
+    // The paths of the steps in the range
+    DataSet collect() const;
+
+    using RpcResponse = storage::StorageRpcResponse<storage::cpp2::GetNeighborsResponse>;
+
+private:
+    const Traverse*                             traverse_{nullptr};
+    std::vector<Row>                            frontier_;
+    // The src vertices with the props, and the vid to their index
+    std::vector<Value>                          srcs_;
+    std::unordered_map<Value, size_t>           srcIndex_;
+    // steps_[i] are the last steps of the paths of i + 1 steps
+    std::vector<std::vector<Step>>              steps_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // EXECUTOR_QUERY_TRAVERSEEXECUTOR_H_
@@ -1181,6 +1181,34 @@ TEST_F(ConjunctPathTest, multiplePairTwoSteps) {
     EXPECT_EQ(result.state(), Result::State::kSuccess);
 }
 
+TEST_F(ConjunctPathTest, multiplePairFoundOnce) {
+    auto* conjunct = ConjunctPath::make(qctx_.get(),
+                                        StartNode::make(qctx_.get()),
+                                        StartNode::make(qctx_.get()),
+                                        ConjunctPath::PathKind::kFloyd,
+                                        5);
+    conjunct->setLeftVar("forwardPath2");
+    conjunct->setRightVar("backwardPath2");
+    conjunct->setColNames({"_path", "cost"});
+
+    auto conjunctExe = std::make_unique<ConjunctPathExecutor>(conjunct, qctx_.get());
+    {
+        auto status = conjunctExe->execute().get();
+        EXPECT_TRUE(status.ok());
+        auto& result = qctx_->ectx()->getResult(conjunct->outputVar());
+        EXPECT_EQ(result.value().getDataSet().rows.size(), 4);
+    }
+    {
+        // The shortest paths of the pairs have been found in the last round
+        auto status = conjunctExe->execute().get();
+        EXPECT_TRUE(status.ok());
+        auto& result = qctx_->ectx()->getResult(conjunct->outputVar());
+        DataSet expected;
+        expected.colNames = {"_path", "cost"};
+        EXPECT_EQ(result.value().getDataSet(), expected);
+    }
+}
+
 TEST_F(ConjunctPathTest, multiplePairThreeSteps) {
     auto* conjunct = ConjunctPath::make(qctx_.get(),
                                         StartNode::make(qctx_.get()),
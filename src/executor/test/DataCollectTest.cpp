@@ -178,6 +178,74 @@ TEST_F(DataCollectTest, CollectSubgraph) {
     EXPECT_EQ(result.state(), Result::State::kSuccess);
 }
 
+TEST_F(DataCollectTest, CollectSubgraphSteps) {
+    auto makeStep = [] (std::vector<Row> rows) {
+        DataSet ds;
+        ds.colNames = {kVid,
+                       "_stats",
+                       "_edge:+like:_type:_dst:_rank",
+                       "_edge:-like:_type:_dst:_rank",
+                       "_expr"};
+        ds.rows = std::move(rows);
+        List datasets;
+        datasets.values.emplace_back(std::move(ds));
+        return ResultBuilder()
+            .value(Value(std::move(datasets)))
+            .iter(Iterator::Kind::kGetNeighbors)
+            .finish();
+    };
+    qctx_->symTable()->newVariable("subgraph_steps");
+    // 1->2, 1->3
+    qctx_->ectx()->setResult(
+        "subgraph_steps",
+        makeStep({Row({"1", Value(), List({List({1, "2", 0}), List({1, "3", 0})}), List(),
+                       Value()})}));
+    // 1 again, the reversed 1->2, and 2->3
+    qctx_->ectx()->setResult(
+        "subgraph_steps",
+        makeStep({Row({"1", Value(), List({List({1, "2", 0})}), List(), Value()}),
+                  Row({"2", Value(), List({List({1, "3", 0})}), List({List({-1, "1", 0})}),
+                       Value()})}));
+
+    auto* dc = DataCollect::make(qctx_.get(), nullptr,
+            DataCollect::CollectKind::kSubgraph, {"subgraph_steps"});
+    dc->setColNames(std::vector<std::string>{"_vertices", "_edges"});
+
+    auto dcExe = std::make_unique<DataCollectExecutor>(dc, qctx_.get());
+    auto future = dcExe->execute();
+    auto status = std::move(future).get();
+    EXPECT_TRUE(status.ok());
+    auto& result = qctx_->ectx()->getResult(dc->outputVar());
+
+    DataSet expected;
+    expected.colNames = {"_vertices", "_edges"};
+    expected.rows.emplace_back(Row({List({Vertex("1", {})}),
+                                    List({Edge("1", "2", 1, "like", 0, {}),
+                                          Edge("1", "3", 1, "like", 0, {})})}));
+    expected.rows.emplace_back(Row({List({Vertex("2", {})}),
+                                    List({Edge("2", "3", 1, "like", 0, {})})}));
+    EXPECT_EQ(result.value().getDataSet(), expected);
+    EXPECT_EQ(result.state(), Result::State::kSuccess);
+}
+
+TEST_F(DataCollectTest, EdgeKey) {
+    using EdgeKey = DataCollectExecutor::EdgeKey;
+    auto key = DataCollectExecutor::edgeKey("a", "b", 1, 0);
+    EXPECT_EQ(key, DataCollectExecutor::edgeKey("a", "b", 1, 0));
+    EXPECT_FALSE(key == DataCollectExecutor::edgeKey("ab", "", 1, 0));
+    EXPECT_FALSE(key == DataCollectExecutor::edgeKey("a", "b", 1, 1));
+
+    // The edges are still told apart when the hashes collide
+    std::unordered_set<EdgeKey, DataCollectExecutor::EdgeKeyHash> edges;
+    for (auto* dst : {"b", "c"}) {
+        auto other = DataCollectExecutor::edgeKey("a", dst, 1, 0);
+        other.hi = key.hi;
+        other.lo = key.lo;
+        edges.emplace(other);
+    }
+    EXPECT_EQ(2, edges.size());
+}
+
 TEST_F(DataCollectTest, RowBasedMove) {
     auto* dc = DataCollect::make(qctx_.get(), nullptr,
             DataCollect::CollectKind::kRowBasedMove, {"input_sequential"});
@@ -150,6 +150,50 @@ TEST_F(DataJoinTest, Join) {
     testJoin("var2", "var1", expected, __LINE__);
 }
 
+TEST_F(DataJoinTest, Recycle) {
+    VariablePropertyExpression key(new std::string("var2"), new std::string("dst"));
+    std::vector<Expression*> hashKeys = {&key};
+    VariablePropertyExpression probe(new std::string("var1"), new std::string("_vid"));
+    std::vector<Expression*> probeKeys = {&probe};
+    auto* dataJoin = DataJoin::make(qctx_.get(), nullptr, {"var2", 0}, {"var1", 0},
+                                    std::move(hashKeys), std::move(probeKeys));
+    dataJoin->setColNames(std::vector<std::string>{
+        "src", "dst", kVid, "tag_prop", "edge_prop", kDst});
+    auto dataJoinExe = std::make_unique<DataJoinExecutor>(dataJoin, qctx_.get());
+
+    auto status = dataJoinExe->execute().get();
+    ASSERT_TRUE(status.ok()) << status;
+    EXPECT_EQ(10, qctx_->ectx()->getResult(dataJoin->outputVar()).size());
+    dataJoinExe->recycle();
+
+    // Run again by the same executor with less rows to hash, none of the
+    // rows hashed before is left in the reused hash table
+    DataSet ds;
+    ds.colNames = {"src", "dst"};
+    ds.rows.emplace_back(Row({"11", "0"}));
+    qctx_->ectx()->setResult("var2", ResultBuilder().value(Value(std::move(ds))).finish());
+    status = dataJoinExe->execute().get();
+    ASSERT_TRUE(status.ok()) << status;
+
+    DataSet expected;
+    expected.colNames = {
+        "src", "dst", kVid, "tag_prop", "edge_prop", kDst};
+    expected.rows.emplace_back(Row({"11", "0", "0", 0, 1, "5"}));
+    expected.rows.emplace_back(Row({"11", "0", "0", 1, 2, "6"}));
+    DataSet resultDs;
+    resultDs.colNames = expected.colNames;
+    auto iter = qctx_->ectx()->getResult(dataJoin->outputVar()).iter();
+    for (; iter->valid(); iter->next()) {
+        const auto& cols = *iter->row();
+        Row row;
+        for (size_t i = 0; i < cols.size(); ++i) {
+            row.values.emplace_back(cols[i]);
+        }
+        resultDs.rows.emplace_back(std::move(row));
+    }
+    EXPECT_EQ(expected, resultDs);
+}
+
 TEST_F(DataJoinTest, JoinTwice) {
     std::string join;
     {
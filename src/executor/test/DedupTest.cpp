@@ -83,5 +83,49 @@ TEST_F(DedupTest, WrongTypeIterator) {
                        "YIELD DISTINCT $-.v_dst as name",
                        expected);
 }
+
+TEST_F(DedupTest, Frontier) {
+    auto makeVids = [](std::vector<std::string> vids) {
+        DataSet ds({kVid});
+        for (auto& vid : vids) {
+            ds.emplace_back(Row({std::move(vid)}));
+        }
+        return ds;
+    };
+    auto* ectx = qctx_->ectx();
+    qctx_->symTable()->newVariable("frontier");
+    // The start of the traversal
+    ectx->setResult("frontier", ResultBuilder().value(Value(makeVids({"a"}))).finish());
+
+    auto* dedupNode = Dedup::make(qctx_.get(), nullptr);
+    dedupNode->setFrontier(true);
+    dedupNode->setInputVar("dst_vids");
+    dedupNode->setOutputVar("frontier");
+    dedupNode->setColNames({kVid});
+    auto dedupExec = std::make_unique<DedupExecutor>(dedupNode, qctx_.get());
+
+    ectx->setResult("dst_vids",
+                    ResultBuilder().value(Value(makeVids({"a", "b", "b", "c"}))).finish());
+    ASSERT_TRUE(dedupExec->execute().get().ok());
+    EXPECT_EQ(makeVids({"b", "c"}), ectx->getResult("frontier").value().getDataSet());
+
+    // Never output the visited vertices again
+    ectx->setResult("dst_vids",
+                    ResultBuilder().value(Value(makeVids({"a", "c", "d"}))).finish());
+    ASSERT_TRUE(dedupExec->execute().get().ok());
+    EXPECT_EQ(makeVids({"d"}), ectx->getResult("frontier").value().getDataSet());
+}
+
+    // Run again from another start, e.g. by the prepared statement
+    ectx->clear();
+    dedupExec->recycle();
+    ectx->setResult("frontier", ResultBuilder().value(Value(makeVids({"a"}))).finish());
+    ectx->setResult("dst_vids",
+                    ResultBuilder().value(Value(makeVids({"a", "c", "d"}))).finish());
+    ASSERT_TRUE(dedupExec->execute().get().ok());
+    EXPECT_EQ(makeVids({"c", "d"}), ectx->getResult("frontier").value().getDataSet());
+    EXPECT_EQ(2, ectx->numVersions("frontier"));
+}
+
 }  // namespace graph
 }  // namespace nebula
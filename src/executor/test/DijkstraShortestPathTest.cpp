@@ -0,0 +1,177 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "context/QueryContext.h"
+#include "executor/algo/DijkstraShortestPathExecutor.h"
+#include "planner/Algo.h"
+
+namespace nebula {
+namespace graph {
+
+class DijkstraShortestPathTest : public testing::Test {
+protected:
+    struct WeightedEdge {
+        std::string src;
+        std::string dst;
+        Value weight;
+    };
+
+    void SetUp() override {
+        qctx_ = std::make_unique<QueryContext>();
+        // 1 -> 2 -> 4 costs 2, 1 -> 3 -> 4 costs 6, 1 -> 4 costs 10, 5 is isolated
+        edges_ = {
+            {"1", "2", 1},
+            {"2", "4", 1},
+            {"1", "3", 5},
+            {"3", "4", 1},
+            {"1", "4", 10},
+        };
+    }
+
+    std::unique_ptr<DijkstraShortestPathExecutor> makeExecutor(std::vector<Value> srcs,
+                                                               std::vector<Value> dsts,
+                                                               size_t steps = 5) {
+        auto* node = DijkstraShortestPath::make(
+            qctx_.get(), nullptr, 1, std::move(srcs), std::move(dsts), {1}, "likeness", steps);
+        node->setColNames({"_path", "cost"});
+        auto exe = std::make_unique<DijkstraShortestPathExecutor>(node, qctx_.get());
+        exe->ds_.colNames = node->colNames();
+        exe->startPair();
+        return exe;
+    }
+
+    // Run the search against the edges_ instead of the storage
+    Status search(DijkstraShortestPathExecutor* exe) {
+        while (true) {
+            bool isForward = true;
+            auto rows = exe->nextRound(isForward);
+            if (rows.empty()) {
+                return Status::OK();
+            }
+            DataSet ds;
+            ds.colNames = {kVid,
+                           "_stats",
+                           isForward ? "_edge:+like:_type:_dst:_rank:likeness"
+                                     : "_edge:-like:_type:_dst:_rank:likeness",
+                           "_expr"};
+            for (auto& row : rows) {
+                auto& vid = row.values.front().getStr();
+                List neighbors;
+                for (auto& edge : edges_) {
+                    auto& from = isForward ? edge.src : edge.dst;
+                    auto& to = isForward ? edge.dst : edge.src;
+                    if (from != vid) {
+                        continue;
+                    }
+                    neighbors.values.emplace_back(
+                        List({isForward ? 1 : -1, to, 0, edge.weight}));
+                }
+                Row nbrRow;
+                nbrRow.values = {vid, Value(), std::move(neighbors), Value()};
+                ds.rows.emplace_back(std::move(nbrRow));
+            }
+            List datasets;
+            datasets.values.emplace_back(std::move(ds));
+            auto status = isForward
+                              ? exe->relax(exe->forward_, exe->backward_, std::move(datasets))
+                              : exe->relax(exe->backward_, exe->forward_, std::move(datasets));
+            NG_RETURN_IF_ERROR(status);
+        }
+    }
+
+    const DataSet& result(DijkstraShortestPathExecutor* exe) {
+        return exe->ds_;
+    }
+
+    static Path makePath(const std::vector<std::string>& vids) {
+        Path path;
+        path.src = Vertex(vids.front(), {});
+        for (size_t i = 1; i < vids.size(); ++i) {
+            path.steps.emplace_back(Step(Vertex(vids[i], {}), 1, "like", 0, {}));
+        }
+        return path;
+    }
+
+protected:
+    std::unique_ptr<QueryContext>   qctx_;
+    std::vector<WeightedEdge>       edges_;
+};
+
+TEST_F(DijkstraShortestPathTest, SinglePair) {
+    auto exe = makeExecutor({"1"}, {"4"});
+    ASSERT_TRUE(search(exe.get()).ok());
+
+    DataSet expected;
+    expected.colNames = {"_path", "cost"};
+    expected.rows.emplace_back(Row({makePath({"1", "2", "4"}), 2.0}));
+    EXPECT_EQ(result(exe.get()), expected);
+}
+
+TEST_F(DijkstraShortestPathTest, MultiPairs) {
+    auto exe = makeExecutor({"1", "3"}, {"4", "5", "3"});
+    ASSERT_TRUE(search(exe.get()).ok());
+
+    DataSet expected;
+    expected.colNames = {"_path", "cost"};
+    expected.rows.emplace_back(Row({makePath({"1", "2", "4"}), 2.0}));
+    expected.rows.emplace_back(Row({makePath({"1", "3"}), 5.0}));
+    expected.rows.emplace_back(Row({makePath({"3", "4"}), 1.0}));
+    expected.rows.emplace_back(Row({makePath({"3"}), 0.0}));
+    EXPECT_EQ(result(exe.get()), expected);
+}
+
+TEST_F(DijkstraShortestPathTest, Steps) {
+    // The cheapest path is too long, so take the direct edge
+    auto exe = makeExecutor({"1"}, {"4"}, 1);
+    ASSERT_TRUE(search(exe.get()).ok());
+
+    DataSet expected;
+    expected.colNames = {"_path", "cost"};
+    expected.rows.emplace_back(Row({makePath({"1", "4"}), 10.0}));
+    EXPECT_EQ(result(exe.get()), expected);
+}
+
+TEST_F(DijkstraShortestPathTest, CheapestTooLong) {
+    // The cheapest path to 3 is 1 -> 2 -> 3, which is too long to go on with
+    // by 3 steps, so 1 -> 3 -> 5 -> 6 is taken
+    edges_ = {
+        {"1", "2", 1},
+        {"2", "3", 1},
+        {"1", "3", 10},
+        {"3", "5", 1},
+        {"5", "6", 1},
+    };
+    auto exe = makeExecutor({"1"}, {"6"}, 3);
+    ASSERT_TRUE(search(exe.get()).ok());
+
+    DataSet expected;
+    expected.colNames = {"_path", "cost"};
+    expected.rows.emplace_back(Row({makePath({"1", "3", "5", "6"}), 12.0}));
+    EXPECT_EQ(result(exe.get()), expected);
+
+    // Or nothing is found by 2 steps
+    exe = makeExecutor({"1"}, {"6"}, 2);
+    ASSERT_TRUE(search(exe.get()).ok());
+    EXPECT_TRUE(result(exe.get()).rows.empty());
+}
+
+TEST_F(DijkstraShortestPathTest, BadWeight) {
+    {
+        edges_.push_back({"1", "5", -1});
+        auto exe = makeExecutor({"1"}, {"4"});
+        EXPECT_FALSE(search(exe.get()).ok());
+    }
+    {
+        edges_.back().weight = Value::kNullValue;
+        auto exe = makeExecutor({"1"}, {"4"});
+        EXPECT_FALSE(search(exe.get()).ok());
+    }
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,541 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+// Micro benchmarks of the query and algo executors and of the iterators, fed with
+// synthetic data sets parameterized by the number of rows, the number of columns,
+// the cardinality of the keys and the depth of paths.
+//
+// Run with `--json' to get a stable machine readable output which could be diffed
+// across commits, e.g.
+//
+//   ./executor_bench --json > before.json
+//   ./executor_bench --json > after.json
+//
+// The benchmark names are part of the output format, please don't rename them.
+
+#include <folly/Benchmark.h>
+
+#include "common/expression/ConstantExpression.h"
+#include "common/expression/PropertyExpression.h"
+#include "common/expression/RelationalExpression.h"
+#include "context/QueryContext.h"
+#include "executor/Executor.h"
+#include "parser/Clauses.h"
+#include "planner/Algo.h"
+#include "planner/Logic.h"
+#include "planner/Query.h"
+#include "scheduler/Scheduler.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+constexpr char kInputVar[] = "input";
+constexpr char kLeftVar[] = "left";
+constexpr char kRightVar[] = "right";
+
+std::string colName(size_t i) {
+    return folly::stringPrintf("c%lu", i);
+}
+
+// Column 0 is a string key of the given cardinality, the others are integers.
+// Don't call it inside BENCHMARK_SUSPEND, the suspender can't be nested.
+const DataSet& sequentialDataSet(size_t rows, size_t cols, size_t cardinality) {
+    folly::BenchmarkSuspender suspender;
+    static std::map<std::tuple<size_t, size_t, size_t>, DataSet> cache;
+    auto key = std::make_tuple(rows, cols, cardinality);
+    auto found = cache.find(key);
+    if (found != cache.end()) {
+        return found->second;
+    }
+    DataSet ds;
+    for (size_t i = 0; i < cols; ++i) {
+        ds.colNames.emplace_back(colName(i));
+    }
+    // A fixed seed keeps the results comparable across runs
+    std::mt19937 gen(rows * 31 + cols * 7 + cardinality);
+    std::uniform_int_distribution<int64_t> dist(0, static_cast<int64_t>(rows));
+    ds.rows.reserve(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        Row row;
+        row.values.reserve(cols);
+        row.values.emplace_back(folly::to<std::string>(dist(gen) % cardinality));
+        for (size_t j = 1; j < cols; ++j) {
+            row.values.emplace_back(dist(gen));
+        }
+        ds.rows.emplace_back(std::move(row));
+    }
+    return cache.emplace(key, std::move(ds)).first->second;
+}
+
+// The neighbors of `depth' layers of `width' vertices, each vertex has `degree' out
+// edges pointing to the vertices of the next layer.
+const std::vector<DataSet>& neighborsDataSets(size_t width, size_t degree, size_t depth) {
+    folly::BenchmarkSuspender suspender;
+    static std::map<std::tuple<size_t, size_t, size_t>, std::vector<DataSet>> cache;
+    auto key = std::make_tuple(width, degree, depth);
+    auto found = cache.find(key);
+    if (found != cache.end()) {
+        return found->second;
+    }
+    std::vector<DataSet> steps;
+    for (size_t step = 0; step < depth; ++step) {
+        DataSet ds({kVid, "_stats", "_edge:+edge1:_type:_dst:_rank", "_expr"});
+        for (size_t i = 0; i < width; ++i) {
+            Row row;
+            row.values.emplace_back(folly::stringPrintf("%lu_%lu", step, i));
+            row.values.emplace_back(Value());
+            List edges;
+            for (size_t j = 0; j < degree; ++j) {
+                auto dst = (i * degree + j) % width;
+                edges.values.emplace_back(
+                    List({1, folly::stringPrintf("%lu_%lu", step + 1, dst), 0}));
+            }
+            row.values.emplace_back(std::move(edges));
+            row.values.emplace_back(Value());
+            ds.rows.emplace_back(std::move(row));
+        }
+        steps.emplace_back(std::move(ds));
+    }
+    return cache.emplace(key, std::move(steps)).first->second;
+}
+
+Result neighborsResult(const DataSet& ds) {
+    List datasets;
+    datasets.values.emplace_back(ds);
+    return ResultBuilder()
+        .value(Value(std::move(datasets)))
+        .iter(Iterator::Kind::kGetNeighbors)
+        .finish();
+}
+
+Result sequentialResult(const DataSet& ds) {
+    return ResultBuilder().value(Value(ds)).iter(Iterator::Kind::kSequential).finish();
+}
+
+Expression* inputProp(QueryContext* qctx, size_t col) {
+    return qctx->objPool()->add(new InputPropertyExpression(new std::string(colName(col))));
+}
+
+// Run the executor of the single input node built by `makeNode' over the input.
+template <typename MakeNode>
+void runSingleInput(unsigned iters, const DataSet& input, MakeNode&& makeNode) {
+    for (unsigned i = 0; i < iters; ++i) {
+        std::unique_ptr<QueryContext> qctx;
+        Executor* exec = nullptr;
+        BENCHMARK_SUSPEND {
+            qctx = std::make_unique<QueryContext>();
+            qctx->symTable()->newVariable(kInputVar);
+            SingleInputNode* node = makeNode(qctx.get());
+            node->setInputVar(kInputVar);
+            exec = Executor::create(node, qctx.get());
+            qctx->ectx()->setResult(kInputVar, sequentialResult(input));
+        }
+        auto status = exec->execute().get();
+        folly::doNotOptimizeAway(status);
+        BENCHMARK_SUSPEND {
+            qctx.reset();
+        }
+    }
+}
+
+// Run the executor of the binary input node built by `makeNode' over the inputs.
+template <typename MakeNode>
+void runBiInput(unsigned iters, const DataSet& left, const DataSet& right, MakeNode&& makeNode) {
+    for (unsigned i = 0; i < iters; ++i) {
+        std::unique_ptr<QueryContext> qctx;
+        Executor* exec = nullptr;
+        BENCHMARK_SUSPEND {
+            qctx = std::make_unique<QueryContext>();
+            qctx->symTable()->newVariable(kLeftVar);
+            qctx->symTable()->newVariable(kRightVar);
+            PlanNode* node = makeNode(qctx.get());
+            exec = Executor::create(node, qctx.get());
+            qctx->ectx()->setResult(kLeftVar, sequentialResult(left));
+            qctx->ectx()->setResult(kRightVar, sequentialResult(right));
+        }
+        auto status = exec->execute().get();
+        folly::doNotOptimizeAway(status);
+        BENCHMARK_SUSPEND {
+            qctx.reset();
+        }
+    }
+}
+
+// Run the path executor step by step over the layered neighbors, the executors
+// keep states between the steps just like inside a loop.
+template <typename MakeNode>
+void runPathSteps(unsigned iters, const std::vector<DataSet>& steps, MakeNode&& makeNode) {
+    for (unsigned i = 0; i < iters; ++i) {
+        std::unique_ptr<QueryContext> qctx;
+        Executor* exec = nullptr;
+        BENCHMARK_SUSPEND {
+            qctx = std::make_unique<QueryContext>();
+            qctx->symTable()->newVariable(kInputVar);
+            SingleInputNode* node = makeNode(qctx.get());
+            node->setInputVar(kInputVar);
+            exec = Executor::create(node, qctx.get());
+        }
+        for (auto& step : steps) {
+            BENCHMARK_SUSPEND {
+                qctx->ectx()->setResult(kInputVar, neighborsResult(step));
+            }
+            auto status = exec->execute().get();
+            folly::doNotOptimizeAway(status);
+        }
+        BENCHMARK_SUSPEND {
+            qctx.reset();
+        }
+    }
+}
+
+}   // namespace
+
+void project(unsigned iters, size_t rows, size_t cols) {
+    runSingleInput(iters, sequentialDataSet(rows, cols, rows), [cols](QueryContext* qctx) {
+        auto* yields = qctx->objPool()->add(new YieldColumns());
+        std::vector<std::string> names;
+        for (size_t i = 0; i < cols; ++i) {
+            yields->addColumn(new YieldColumn(
+                new InputPropertyExpression(new std::string(colName(i))),
+                new std::string(colName(i))));
+            names.emplace_back(colName(i));
+        }
+        auto* node = Project::make(qctx, nullptr, yields);
+        node->setColNames(std::move(names));
+        return node;
+    });
+}
+
+void filter(unsigned iters, size_t rows, size_t cols) {
+    runSingleInput(iters, sequentialDataSet(rows, cols, rows), [rows](QueryContext* qctx) {
+        auto* cond = qctx->objPool()->add(
+            new RelationalExpression(Expression::Kind::kRelGT,
+                                     new InputPropertyExpression(new std::string(colName(1))),
+                                     new ConstantExpression(static_cast<int64_t>(rows / 2))));
+        return Filter::make(qctx, nullptr, cond);
+    });
+}
+
+void dedup(unsigned iters, size_t rows, size_t cardinality) {
+    runSingleInput(iters, sequentialDataSet(rows, 1, cardinality), [](QueryContext* qctx) {
+        return Dedup::make(qctx, nullptr);
+    });
+}
+
+void limit(unsigned iters, size_t rows, size_t count) {
+    runSingleInput(iters, sequentialDataSet(rows, 4, rows), [count](QueryContext* qctx) {
+        return Limit::make(qctx, nullptr, 0, count);
+    });
+}
+
+void sort(unsigned iters, size_t rows, size_t cols) {
+    runSingleInput(iters, sequentialDataSet(rows, cols, rows), [](QueryContext* qctx) {
+        std::vector<std::pair<size_t, OrderFactor::OrderType>> factors;
+        factors.emplace_back(1, OrderFactor::OrderType::ASCEND);
+        factors.emplace_back(0, OrderFactor::OrderType::DESCEND);
+        return Sort::make(qctx, nullptr, std::move(factors));
+    });
+}
+
+void topN(unsigned iters, size_t rows, size_t count) {
+    runSingleInput(iters, sequentialDataSet(rows, 4, rows), [count](QueryContext* qctx) {
+        std::vector<std::pair<size_t, OrderFactor::OrderType>> factors;
+        factors.emplace_back(1, OrderFactor::OrderType::ASCEND);
+        return TopN::make(qctx, nullptr, std::move(factors), 0, count);
+    });
+}
+
+void aggregate(unsigned iters, size_t rows, size_t cardinality) {
+    runSingleInput(iters, sequentialDataSet(rows, 2, cardinality), [](QueryContext* qctx) {
+        std::vector<Expression*> groupKeys = {inputProp(qctx, 0)};
+        std::vector<Aggregate::GroupItem> groupItems;
+        groupItems.emplace_back(inputProp(qctx, 0), AggFun::Function::kNone, false);
+        groupItems.emplace_back(inputProp(qctx, 1), AggFun::Function::kSum, false);
+        auto* node =
+            Aggregate::make(qctx, nullptr, std::move(groupKeys), std::move(groupItems));
+        node->setColNames({colName(0), "sum"});
+        return node;
+    });
+}
+
+void dataJoin(unsigned iters, size_t rows, size_t cardinality) {
+    auto& left = sequentialDataSet(rows, 2, cardinality);
+    auto& right = sequentialDataSet(rows, 3, cardinality);
+    runBiInput(iters, left, right, [](QueryContext* qctx) {
+        auto* hashKey = qctx->objPool()->add(new VariablePropertyExpression(
+            new std::string(kLeftVar), new std::string(colName(0))));
+        auto* probeKey = qctx->objPool()->add(new VariablePropertyExpression(
+            new std::string(kRightVar), new std::string(colName(0))));
+        auto* node =
+            DataJoin::make(qctx, nullptr, {kLeftVar, 0}, {kRightVar, 0}, {hashKey}, {probeKey});
+        node->setColNames({"l0", "l1", "r0", "r1", "r2"});
+        return node;
+    });
+}
+
+template <typename SetNode>
+void setOp(unsigned iters, size_t rows, size_t cardinality) {
+    auto& left = sequentialDataSet(rows, 1, cardinality);
+    auto& right = sequentialDataSet(rows / 2, 1, cardinality);
+    runBiInput(iters, left, right, [](QueryContext* qctx) {
+        auto* node = SetNode::make(qctx, StartNode::make(qctx), StartNode::make(qctx));
+        node->setLeftVar(kLeftVar);
+        node->setRightVar(kRightVar);
+        return node;
+    });
+}
+
+void unionAll(unsigned iters, size_t rows, size_t cardinality) {
+    setOp<Union>(iters, rows, cardinality);
+}
+
+void intersect(unsigned iters, size_t rows, size_t cardinality) {
+    setOp<Intersect>(iters, rows, cardinality);
+}
+
+void minus(unsigned iters, size_t rows, size_t cardinality) {
+    setOp<Minus>(iters, rows, cardinality);
+}
+
+void dataCollect(unsigned iters, size_t rows, size_t cols) {
+    runSingleInput(iters, sequentialDataSet(rows, cols, rows), [](QueryContext* qctx) {
+        auto* node = DataCollect::make(
+            qctx, nullptr, DataCollect::CollectKind::kRowBasedMove, {kInputVar});
+        node->setColNames({"collected"});
+        return node;
+    });
+}
+
+void bfsShortest(unsigned iters, size_t width, size_t degree, size_t depth) {
+    runPathSteps(iters, neighborsDataSets(width, degree, depth), [](QueryContext* qctx) {
+        auto* node = BFSShortestPath::make(qctx, nullptr);
+        node->setColNames({kVid, "edge"});
+        return node;
+    });
+}
+
+void produceSemiShortestPath(unsigned iters, size_t width, size_t degree, size_t depth) {
+    runPathSteps(iters, neighborsDataSets(width, degree, depth), [](QueryContext* qctx) {
+        auto* node = ProduceSemiShortestPath::make(qctx, nullptr);
+        node->setColNames({kDst, kSrc, "cost", "paths"});
+        return node;
+    });
+}
+
+void produceAllPaths(unsigned iters, size_t width, size_t degree, size_t depth) {
+    runPathSteps(iters, neighborsDataSets(width, degree, depth), [](QueryContext* qctx) {
+        auto* node = ProduceAllPaths::make(qctx, nullptr);
+        node->setColNames({kDst, "_paths"});
+        return node;
+    });
+}
+
+// BiBFS conjunction of two frontiers of `rows' vertices, half of them meet.
+void conjunctBiBFS(unsigned iters, size_t rows) {
+    static std::map<size_t, std::pair<DataSet, DataSet>> cache;
+    auto& inputs = cache[rows];
+    if (inputs.first.rows.empty()) {
+        folly::BenchmarkSuspender suspender;
+        inputs.first.colNames = {kVid, "edge"};
+        inputs.second.colNames = {kVid, "edge"};
+        for (size_t i = 0; i < rows; ++i) {
+            auto vid = folly::to<std::string>(i);
+            inputs.first.rows.emplace_back(Row({vid, Edge("s", vid, 1, "edge1", 0, {})}));
+            auto rvid = folly::to<std::string>(i + rows / 2);
+            inputs.second.rows.emplace_back(Row({rvid, Edge("t", rvid, -1, "edge1", 0, {})}));
+        }
+    }
+    runBiInput(iters, inputs.first, inputs.second, [](QueryContext* qctx) {
+        auto* node = ConjunctPath::make(qctx,
+                                        StartNode::make(qctx),
+                                        StartNode::make(qctx),
+                                        ConjunctPath::PathKind::kBiBFS,
+                                        5);
+        node->setLeftVar(kLeftVar);
+        node->setRightVar(kRightVar);
+        node->setColNames({"_path"});
+        return node;
+    });
+}
+
+void sequentialIterCopy(unsigned iters, size_t rows) {
+    auto& ds = sequentialDataSet(rows, 4, rows);
+    std::shared_ptr<Value> value;
+    BENCHMARK_SUSPEND {
+        value = std::make_shared<Value>(ds);
+    }
+    SequentialIter iter(value);
+    for (unsigned i = 0; i < iters; ++i) {
+        auto copy = iter.copy();
+        folly::doNotOptimizeAway(copy);
+    }
+}
+
+void sequentialIterErase(unsigned iters, size_t rows) {
+    auto& ds = sequentialDataSet(rows, 4, rows);
+    std::shared_ptr<Value> value;
+    BENCHMARK_SUSPEND {
+        value = std::make_shared<Value>(ds);
+    }
+    for (unsigned i = 0; i < iters; ++i) {
+        std::unique_ptr<Iterator> iter;
+        BENCHMARK_SUSPEND {
+            iter = std::make_unique<SequentialIter>(value);
+        }
+        // Erase every other row
+        while (iter->valid()) {
+            iter->erase();
+            if (iter->valid()) {
+                iter->next();
+            }
+        }
+        folly::doNotOptimizeAway(iter);
+    }
+}
+
+void getNeighborsIterCopy(unsigned iters, size_t width, size_t degree) {
+    auto& ds = neighborsDataSets(width, degree, 1).front();
+    std::shared_ptr<Value> value;
+    BENCHMARK_SUSPEND {
+        List datasets;
+        datasets.values.emplace_back(ds);
+        value = std::make_shared<Value>(std::move(datasets));
+    }
+    GetNeighborsIter iter(value);
+    for (unsigned i = 0; i < iters; ++i) {
+        auto copy = iter.copy();
+        folly::doNotOptimizeAway(copy);
+    }
+}
+
+// The overhead of scheduling per plan node, including creating the executors,
+// over the plan built by `makePlan' whose nodes do almost nothing.
+template <typename MakePlan>
+size_t runSchedule(unsigned iters, size_t nodes, MakePlan&& makePlan) {
+    for (unsigned i = 0; i < iters; ++i) {
+        std::unique_ptr<QueryContext> qctx;
+        std::unique_ptr<Scheduler> scheduler;
+        BENCHMARK_SUSPEND {
+            qctx = std::make_unique<QueryContext>();
+            qctx->plan()->setRoot(makePlan(qctx.get()));
+            scheduler = std::make_unique<Scheduler>(qctx.get());
+        }
+        auto status = scheduler->schedule().get();
+        folly::doNotOptimizeAway(status);
+        BENCHMARK_SUSPEND {
+            scheduler.reset();
+            qctx.reset();
+        }
+    }
+    return iters * nodes;
+}
+
+size_t scheduleChain(unsigned iters, size_t nodes) {
+    return runSchedule(iters, nodes, [nodes](QueryContext* qctx) {
+        PlanNode* node = StartNode::make(qctx);
+        for (size_t i = 1; i < nodes; ++i) {
+            node = PassThroughNode::make(qctx, node);
+        }
+        return node;
+    });
+}
+
+// The branches of a pass through are united one by one
+size_t scheduleFanOut(unsigned iters, size_t branches) {
+    return runSchedule(iters, 2 * branches + 1, [branches](QueryContext* qctx) {
+        auto* mout = PassThroughNode::make(qctx, StartNode::make(qctx));
+        PlanNode* node = PassThroughNode::make(qctx, mout);
+        for (size_t i = 1; i < branches; ++i) {
+            node = Union::make(qctx, node, PassThroughNode::make(qctx, mout));
+        }
+        return node;
+    });
+}
+
+// The same plan is run again by the executors of the first run, as the
+// prepared statements do
+size_t scheduleAgain(unsigned iters, size_t nodes) {
+    std::unique_ptr<QueryContext> qctx;
+    BENCHMARK_SUSPEND {
+        qctx = std::make_unique<QueryContext>();
+        PlanNode* node = StartNode::make(qctx.get());
+        for (size_t i = 1; i < nodes; ++i) {
+            node = PassThroughNode::make(qctx.get(), node);
+        }
+        qctx->plan()->setRoot(node);
+        Scheduler(qctx.get()).schedule().get();
+    }
+    for (unsigned i = 0; i < iters; ++i) {
+        BENCHMARK_SUSPEND {
+            qctx->resetExecution();
+        }
+        auto status = Scheduler(qctx.get()).schedule().get();
+        folly::doNotOptimizeAway(status);
+    }
+    return iters * nodes;
+}
+
+BENCHMARK_NAMED_PARAM(project, 1K_rows_4_cols, 1000, 4)
+BENCHMARK_NAMED_PARAM(project, 100K_rows_4_cols, 100000, 4)
+BENCHMARK_NAMED_PARAM(project, 100K_rows_16_cols, 100000, 16)
+BENCHMARK_DRAW_LINE();
+BENCHMARK_NAMED_PARAM(filter, 1K_rows_4_cols, 1000, 4)
+BENCHMARK_NAMED_PARAM(filter, 100K_rows_4_cols, 100000, 4)
+BENCHMARK_DRAW_LINE();
+BENCHMARK_NAMED_PARAM(dedup, 100K_rows_10_keys, 100000, 10)
+BENCHMARK_NAMED_PARAM(dedup, 100K_rows_100K_keys, 100000, 100000)
+BENCHMARK_DRAW_LINE();
+BENCHMARK_NAMED_PARAM(limit, 100K_rows_first_10, 100000, 10)
+BENCHMARK_NAMED_PARAM(limit, 100K_rows_first_50K, 100000, 50000)
+BENCHMARK_DRAW_LINE();
+BENCHMARK_NAMED_PARAM(sort, 1K_rows_4_cols, 1000, 4)
+BENCHMARK_NAMED_PARAM(sort, 100K_rows_4_cols, 100000, 4)
+BENCHMARK_DRAW_LINE();
+BENCHMARK_NAMED_PARAM(topN, 100K_rows_top_10, 100000, 10)
+BENCHMARK_NAMED_PARAM(topN, 100K_rows_top_10K, 100000, 10000)
+BENCHMARK_DRAW_LINE();
+BENCHMARK_NAMED_PARAM(aggregate, 100K_rows_10_keys, 100000, 10)
+BENCHMARK_NAMED_PARAM(aggregate, 100K_rows_100K_keys, 100000, 100000)
+BENCHMARK_DRAW_LINE();
+BENCHMARK_NAMED_PARAM(dataJoin, 10K_rows_10K_keys, 10000, 10000)
+BENCHMARK_NAMED_PARAM(dataJoin, 10K_rows_1K_keys, 10000, 1000)
+BENCHMARK_DRAW_LINE();
+BENCHMARK_NAMED_PARAM(unionAll, 100K_rows_100K_keys, 100000, 100000)
+BENCHMARK_NAMED_PARAM(intersect, 100K_rows_100K_keys, 100000, 100000)
+BENCHMARK_NAMED_PARAM(minus, 100K_rows_100K_keys, 100000, 100000)
+BENCHMARK_DRAW_LINE();
+BENCHMARK_NAMED_PARAM(dataCollect, 100K_rows_4_cols, 100000, 4)
+BENCHMARK_DRAW_LINE();
+BENCHMARK_NAMED_PARAM(bfsShortest, 1K_width_10_degree_3_depth, 1000, 10, 3)
+BENCHMARK_NAMED_PARAM(bfsShortest, 1K_width_10_degree_6_depth, 1000, 10, 6)
+BENCHMARK_NAMED_PARAM(produceSemiShortestPath, 100_width_5_degree_3_depth, 100, 5, 3)
+BENCHMARK_NAMED_PARAM(produceSemiShortestPath, 100_width_5_degree_5_depth, 100, 5, 5)
+BENCHMARK_NAMED_PARAM(produceAllPaths, 100_width_3_degree_3_depth, 100, 3, 3)
+BENCHMARK_NAMED_PARAM(produceAllPaths, 100_width_3_degree_5_depth, 100, 3, 5)
+BENCHMARK_NAMED_PARAM(conjunctBiBFS, 10K_rows, 10000)
+BENCHMARK_DRAW_LINE();
+BENCHMARK_NAMED_PARAM(sequentialIterCopy, 100K_rows, 100000)
+BENCHMARK_NAMED_PARAM(sequentialIterErase, 10K_rows, 10000)
+BENCHMARK_NAMED_PARAM(getNeighborsIterCopy, 1K_width_10_degree, 1000, 10)
+BENCHMARK_DRAW_LINE();
+// Per plan node
+BENCHMARK_NAMED_PARAM_MULTI(scheduleChain, 1_node, 1)
+BENCHMARK_NAMED_PARAM_MULTI(scheduleChain, 16_nodes, 16)
+BENCHMARK_NAMED_PARAM_MULTI(scheduleChain, 256_nodes, 256)
+BENCHMARK_NAMED_PARAM_MULTI(scheduleFanOut, 16_branches, 16)
+BENCHMARK_NAMED_PARAM_MULTI(scheduleAgain, 16_nodes, 16)
+BENCHMARK_NAMED_PARAM_MULTI(scheduleAgain, 256_nodes, 256)
+
+}   // namespace graph
+}   // namespace nebula
+
+int main(int argc, char** argv) {
+    folly::init(&argc, &argv, true);
+    folly::runBenchmarks();
+    return 0;
+}
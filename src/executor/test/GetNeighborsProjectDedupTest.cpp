@@ -0,0 +1,123 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "context/QueryContext.h"
+#include "executor/query/GetNeighborsProjectDedupExecutor.h"
+#include "planner/Query.h"
+
+namespace nebula {
+namespace graph {
+
+class GetNeighborsProjectDedupTest : public testing::Test {
+protected:
+    void SetUp() override {
+        qctx_ = std::make_unique<QueryContext>();
+    }
+
+    std::unique_ptr<GetNeighborsProjectDedupExecutor> makeExecutor(bool frontier = false,
+                                                                   bool keepNeighbors = false) {
+        auto* pool = qctx_->objPool();
+        auto* gn = GetNeighbors::make(qctx_.get(), nullptr, 1);
+        auto* columns = pool->add(new YieldColumns());
+        columns->addColumn(new YieldColumn(
+            new EdgePropertyExpression(new std::string("*"), new std::string(kDst)),
+            new std::string(kVid)));
+        auto* project = Project::make(qctx_.get(), gn, columns);
+        project->setInputVar(gn->outputVar());
+        project->setColNames({kVid});
+        auto* dedup = Dedup::make(qctx_.get(), project);
+        dedup->setInputVar(project->outputVar());
+        dedup->setColNames({kVid});
+        dedup->setFrontier(frontier);
+
+        auto* fused = GetNeighborsProjectDedup::make(qctx_.get(), nullptr, gn, project, dedup);
+        fused->setOutputVar(dedup->outputVar());
+        fused->setColNames({kVid});
+        fused->setKeepNeighbors(keepNeighbors);
+        EXPECT_EQ(dedup->id(), fused->id());
+        return std::make_unique<GetNeighborsProjectDedupExecutor>(fused, qctx_.get());
+    }
+
+    // a -> b, a -> c, d -> b, d -> a
+    static Value neighbors() {
+        DataSet ds;
+        ds.colNames = {kVid, "_stats", "_edge:+like:_type:_dst:_rank", "_expr"};
+        ds.rows.emplace_back(Row({"a", Value(), List({List({1, "b", 0}), List({1, "c", 0})}),
+                                  Value()}));
+        ds.rows.emplace_back(Row({"d", Value(), List({List({1, "b", 0}), List({1, "a", 0})}),
+                                  Value()}));
+        List datasets;
+        datasets.values.emplace_back(std::move(ds));
+        return Value(std::move(datasets));
+    }
+
+    static std::vector<std::string> dsts(const Value& value) {
+        std::vector<std::string> result;
+        EXPECT_TRUE(value.isDataSet());
+        for (auto& row : value.getDataSet().rows) {
+            result.emplace_back(row.values.front().getStr());
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+protected:
+    std::unique_ptr<QueryContext> qctx_;
+};
+
+TEST_F(GetNeighborsProjectDedupTest, ProjectDedup) {
+    auto exe = makeExecutor();
+    ASSERT_TRUE(exe->finishNeighbors(neighbors(), Result::State::kSuccess).ok());
+    auto& result = qctx_->ectx()->getResult(exe->node()->outputVar());
+    EXPECT_EQ(std::vector<std::string>({kVid}), result.value().getDataSet().colNames);
+    EXPECT_EQ(std::vector<std::string>({"a", "b", "c"}), dsts(result.value()));
+    EXPECT_EQ(4, exe->numNeighbors_);
+    EXPECT_EQ(4, exe->numProjected_);
+
+    // Only deduplicated in each execution
+    ASSERT_TRUE(exe->finishNeighbors(neighbors(), Result::State::kSuccess).ok());
+    auto& again = qctx_->ectx()->getResult(exe->node()->outputVar());
+    EXPECT_EQ(std::vector<std::string>({"a", "b", "c"}), dsts(again.value()));
+}
+
+TEST_F(GetNeighborsProjectDedupTest, Frontier) {
+    auto exe = makeExecutor(true);
+    // The start of the traversal
+    auto outputVar = exe->node()->outputVar();
+    DataSet start({kVid});
+    start.rows.emplace_back(Row({"a"}));
+    qctx_->ectx()->setResult(outputVar, ResultBuilder().value(Value(std::move(start))).finish());
+
+    ASSERT_TRUE(exe->finishNeighbors(neighbors(), Result::State::kSuccess).ok());
+    EXPECT_EQ(std::vector<std::string>({"b", "c"}),
+              dsts(qctx_->ectx()->getResult(outputVar).value()));
+
+    // All of them are output before
+    ASSERT_TRUE(exe->finishNeighbors(neighbors(), Result::State::kSuccess).ok());
+    EXPECT_TRUE(dsts(qctx_->ectx()->getResult(outputVar).value()).empty());
+}
+
+TEST_F(GetNeighborsProjectDedupTest, KeepNeighbors) {
+    {
+        auto exe = makeExecutor();
+        ASSERT_TRUE(exe->finishNeighbors(neighbors(), Result::State::kSuccess).ok());
+        EXPECT_FALSE(qctx_->ectx()->exist(exe->gn_->outputVar()));
+    }
+    {
+        auto exe = makeExecutor(false, true);
+        ASSERT_TRUE(exe->finishNeighbors(neighbors(), Result::State::kPartialSuccess).ok());
+        auto& result = qctx_->ectx()->getResult(exe->gn_->outputVar());
+        EXPECT_EQ(Result::State::kPartialSuccess, result.state());
+        EXPECT_EQ(4, result.size());
+        EXPECT_EQ(std::vector<std::string>({"a", "b", "c"}),
+                  dsts(qctx_->ectx()->getResult(exe->node()->outputVar()).value()));
+    }
+}
+
+}   // namespace graph
+}   // namespace nebula
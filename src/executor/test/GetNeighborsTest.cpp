@@ -7,8 +7,10 @@
 #include <gtest/gtest.h>
 
 #include "context/QueryContext.h"
+#include "context/VertexRowCache.h"
 #include "planner/Query.h"
 #include "executor/query/GetNeighborsExecutor.h"
+#include "service/GraphFlags.h"
 
 namespace nebula {
 namespace graph {
@@ -82,5 +84,62 @@ TEST_F(GetNeighborsTest, BuildRequestDataSet) {
     auto& reqDs = gnExe->reqDs_;
     EXPECT_EQ(reqDs, expected);
 }
+
+TEST_F(GetNeighborsTest, NeighborCache) {
+    FLAGS_enable_neighbor_cache = true;
+    auto& cache = VertexRowCache::instance(VertexRowCache::Kind::kNeighbor);
+    cache.clear();
+    auto* pool = qctx_->objPool();
+    auto* vids = pool->add(new InputPropertyExpression(new std::string("id")));
+    auto edgeProps = std::make_unique<std::vector<storage::cpp2::EdgeProp>>();
+    storage::cpp2::EdgeProp edgeProp;
+    edgeProp.type = 1;
+    edgeProp.props = {kDst};
+    edgeProps->emplace_back(std::move(edgeProp));
+    auto* gn = GetNeighbors::make(qctx_.get(),
+                                  nullptr,
+                                  1,
+                                  vids,
+                                  {1},
+                                  storage::cpp2::EdgeDirection::OUT_EDGE,
+                                  nullptr,
+                                  std::move(edgeProps),
+                                  nullptr,
+                                  nullptr);
+    gn->setInputVar("input_gn");
+
+    // The neighbors of 0 ~ 4 are got from the storage
+    DataSet resp;
+    resp.colNames = {kVid, "_stats", "_edge:+like:_dst", "_expr"};
+    for (auto i = 0; i < 5; ++i) {
+        resp.rows.emplace_back(
+            Row({folly::to<std::string>(i), Value(), List({List({"10"})}), Value()}));
+    }
+    {
+        auto gnExe = std::make_unique<GetNeighborsExecutor>(gn, qctx_.get());
+        ASSERT_TRUE(gnExe->buildRequestDataSet().ok());
+        EXPECT_EQ(10, gnExe->reqDs_.rows.size());
+        EXPECT_TRUE(gnExe->cachedDs_.empty());
+        cache.putAll(1, gnExe->cacheRequest_, resp);
+    }
+    // Then 0 is changed
+    cache.invalidate(1, "0");
+    {
+        auto gnExe = std::make_unique<GetNeighborsExecutor>(gn, qctx_.get());
+        ASSERT_TRUE(gnExe->buildRequestDataSet().ok());
+        DataSet expected;
+        expected.colNames = {kVid};
+        for (auto i : {0, 5, 6, 7, 8, 9}) {
+            expected.rows.emplace_back(Row({folly::to<std::string>(i)}));
+        }
+        EXPECT_EQ(expected, gnExe->reqDs_);
+
+        ASSERT_EQ(1, gnExe->cachedDs_.size());
+        resp.rows.erase(resp.rows.begin());
+        EXPECT_EQ(resp, gnExe->cachedDs_.front());
+    }
+    cache.clear();
+    FLAGS_enable_neighbor_cache = false;
+}
 }  // namespace graph
 }  // namespace nebula
@@ -0,0 +1,161 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "context/QueryContext.h"
+#include "executor/query/IndexScanExecutor.h"
+#include "planner/Query.h"
+
+namespace nebula {
+namespace graph {
+
+class IndexScanTest : public testing::Test {
+protected:
+    void SetUp() override {
+        qctx_ = std::make_unique<QueryContext>();
+    }
+
+    std::unique_ptr<IndexScanExecutor> makeExecutor(bool isEdge) {
+        auto contexts = std::make_unique<std::vector<storage::cpp2::IndexQueryContext>>(2);
+        auto returnCols = std::make_unique<std::vector<std::string>>();
+        auto* scan = IndexScan::make(
+            qctx_.get(), nullptr, 1, std::move(contexts), std::move(returnCols), isEdge, 1);
+        return std::make_unique<IndexScanExecutor>(scan, qctx_.get());
+    }
+
+    static DataSet vertices(std::vector<std::string> vids) {
+        DataSet ds({"VertexID", "player.age"});
+        for (auto& vid : vids) {
+            ds.rows.emplace_back(Row({vid, static_cast<int64_t>(vid.size())}));
+        }
+        return ds;
+    }
+
+    static std::vector<std::string> vids(const DataSet& ds) {
+        std::vector<std::string> result;
+        for (auto& row : ds.rows) {
+            result.emplace_back(row.values.front().getStr());
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+protected:
+    std::unique_ptr<QueryContext> qctx_;
+};
+
+TEST_F(IndexScanTest, Intersect) {
+    auto exe = makeExecutor(false);
+    {
+        std::vector<DataSet> results;
+        results.emplace_back(vertices({"d", "a", "c", "b", "e"}));
+        results.emplace_back(vertices({"c", "e", "x"}));
+        results.emplace_back(vertices({"e", "b", "c", "c"}));
+        auto ds = exe->intersect(std::move(results));
+        EXPECT_EQ(std::vector<std::string>({"VertexID", "player.age"}), ds.colNames);
+        EXPECT_EQ(std::vector<std::string>({"c", "e"}), vids(ds));
+        EXPECT_EQ(Value(1L), ds.rows.front().values.back());
+    }
+    {
+        std::vector<DataSet> results;
+        results.emplace_back(vertices({"a", "b"}));
+        results.emplace_back(vertices({}));
+        auto ds = exe->intersect(std::move(results));
+        EXPECT_EQ(std::vector<std::string>({"VertexID", "player.age"}), ds.colNames);
+        EXPECT_TRUE(ds.rows.empty());
+    }
+    {
+        // Edges are identified by the src, ranking and dst
+        auto edge = makeExecutor(true);
+        std::vector<DataSet> results;
+        DataSet lhs({"_src", "_ranking", "_dst"});
+        lhs.rows.emplace_back(Row({"a", 0, "b"}));
+        lhs.rows.emplace_back(Row({"a", 1, "b"}));
+        lhs.rows.emplace_back(Row({"a", 0, "c"}));
+        DataSet rhs = lhs;
+        rhs.rows.erase(rhs.rows.begin());
+        results.emplace_back(std::move(lhs));
+        results.emplace_back(std::move(rhs));
+        auto ds = edge->intersect(std::move(results));
+        ASSERT_EQ(2, ds.rows.size());
+        EXPECT_EQ(Row({"a", 0, "c"}), ds.rows[0]);
+        EXPECT_EQ(Row({"a", 1, "b"}), ds.rows[1]);
+    }
+}
+
+TEST_F(IndexScanTest, Dedup) {
+    auto exe = makeExecutor(false);
+    auto ds = vertices({"a", "b", "a", "c", "b"});
+    exe->dedup(&ds);
+    EXPECT_EQ(3, ds.rows.size());
+    EXPECT_EQ(std::vector<std::string>({"a", "b", "c"}), vids(ds));
+    // The order of the first ones is kept
+    EXPECT_EQ(Value("c"), ds.rows.back().values.front());
+}
+
+TEST_F(IndexScanTest, Limit) {
+    auto exe = makeExecutor(false);
+    auto* scan = const_cast<IndexScan*>(exe->gn_);
+    {
+        auto ds = vertices({"a", "bbb", "cc"});
+        exe->sortAndLimit(&ds);
+        EXPECT_EQ(3, ds.rows.size());
+    }
+    scan->setLimit(2);
+    {
+        auto ds = vertices({"a", "bbb", "cc"});
+        exe->sortAndLimit(&ds);
+        EXPECT_EQ(2, ds.rows.size());
+    }
+    {
+        // The first ones by the order
+        scan->setSortFactors({{1, OrderFactor::OrderType::DESCEND}});
+        auto ds = vertices({"a", "bbb", "dddd", "cc"});
+        exe->sortAndLimit(&ds);
+        ASSERT_EQ(2, ds.rows.size());
+        EXPECT_EQ(Value("dddd"), ds.rows[0].values.front());
+        EXPECT_EQ(Value("bbb"), ds.rows[1].values.front());
+    }
+}
+
+TEST_F(IndexScanTest, SortedMerge) {
+    auto exe = makeExecutor(false);
+    auto* scan = const_cast<IndexScan*>(exe->gn_);
+    scan->setSortFactors({{1, OrderFactor::OrderType::ASCEND},
+                          {0, OrderFactor::OrderType::ASCEND}});
+    // Three partitions sorted by the age
+    auto partitions = vertices({"b", "dddd", "eeeee", "a", "cc", "ccc", "x", "zzzz"});
+    {
+        auto ds = partitions;
+        exe->sortAndLimit(&ds);
+        std::vector<std::string> merged;
+        for (auto& row : ds.rows) {
+            merged.emplace_back(row.values.front().getStr());
+        }
+        EXPECT_EQ(std::vector<std::string>({"a", "b", "x", "cc", "ccc", "dddd", "zzzz", "eeeee"}),
+                  merged);
+    }
+    {
+        // Stopped at the limit
+        scan->setLimit(3);
+        auto ds = partitions;
+        exe->sortAndLimit(&ds);
+        ASSERT_EQ(3, ds.rows.size());
+        EXPECT_EQ(Value("a"), ds.rows[0].values.front());
+        EXPECT_EQ(Value("b"), ds.rows[1].values.front());
+        EXPECT_EQ(Value("x"), ds.rows[2].values.front());
+    }
+    {
+        // Already sorted
+        auto ds = vertices({"a", "b", "cc"});
+        exe->sortAndLimit(&ds);
+        ASSERT_EQ(3, ds.rows.size());
+    }
+}
+
+}   // namespace graph
+}   // namespace nebula
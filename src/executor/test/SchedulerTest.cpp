@@ -0,0 +1,179 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include <folly/executors/CPUThreadPoolExecutor.h>
+
+#include "common/expression/VariableExpression.h"
+#include "context/QueryContext.h"
+#include "executor/ExecutionError.h"
+#include "planner/Logic.h"
+#include "planner/Query.h"
+#include "scheduler/Scheduler.h"
+#include "service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+// The start nodes finish on the threads of the runner, so the executors after
+// them are dispatched concurrently
+class SchedulerTest : public testing::Test {
+protected:
+    void SetUp() override {
+        profiling_ = FLAGS_enable_lightweight_profiling;
+        FLAGS_enable_lightweight_profiling = true;
+        runner_ = std::make_unique<folly::CPUThreadPoolExecutor>(4);
+    }
+
+    void TearDown() override {
+        runner_->join();
+        FLAGS_enable_lightweight_profiling = profiling_;
+    }
+
+    std::unique_ptr<QueryContext> makeQueryContext() {
+        auto qctx = std::make_unique<QueryContext>();
+        auto rctx = std::make_unique<RequestContext<cpp2::ExecutionResponse>>();
+        rctx->setRunner(runner_.get());
+        qctx->setRCtx(std::move(rctx));
+        return qctx;
+    }
+
+    static Status schedule(QueryContext* qctx, PlanNode* root) {
+        qctx->plan()->setRoot(root);
+        Scheduler scheduler(qctx);
+        try {
+            return scheduler.schedule().get();
+        } catch (const ExecutionError& e) {
+            return e.status();
+        }
+    }
+
+    // The times each plan node is executed
+    static std::unordered_map<int64_t, int64_t> executions(QueryContext* qctx) {
+        std::unordered_map<int64_t, int64_t> result;
+        for (auto& stats : qctx->moveOperatorStats()) {
+            result.emplace(stats.planNodeId, stats.executions);
+        }
+        return result;
+    }
+
+    bool                                            profiling_;
+    std::unique_ptr<folly::CPUThreadPoolExecutor>   runner_;
+};
+
+TEST_F(SchedulerTest, Diamond) {
+    for (auto i = 0; i < 100; ++i) {
+        auto qctx = makeQueryContext();
+        auto* q = qctx.get();
+        //            start1          start2
+        //              |               |
+        //            shared           pass
+        //           /     \            |
+        //        left    right -- union1
+        //           \               /
+        //            ----- union2 --
+        auto* shared = PassThroughNode::make(q, StartNode::make(q));
+        auto* left = PassThroughNode::make(q, shared);
+        auto* right = PassThroughNode::make(q, shared);
+        auto* pass = PassThroughNode::make(q, StartNode::make(q));
+        // Fails if the union is run before both its inputs are done
+        auto* union1 = Union::make(q, right, pass);
+        auto* union2 = Union::make(q, left, union1);
+
+        auto status = schedule(q, union2);
+        ASSERT_TRUE(status.ok()) << status;
+        auto result = executions(q);
+        // Each node runs once, even the one shared by the branches
+        EXPECT_EQ(8, result.size());
+        for (auto& kv : result) {
+            EXPECT_EQ(1, kv.second) << "plan node " << kv.first;
+        }
+        EXPECT_TRUE(q->ectx()->getValue(union2->outputVar()).isDataSet());
+    }
+}
+
+TEST_F(SchedulerTest, Failure) {
+    for (auto i = 0; i < 100; ++i) {
+        auto qctx = makeQueryContext();
+        auto* q = qctx.get();
+        auto* start = StartNode::make(q);
+        auto* lhs = PassThroughNode::make(q, start);
+        lhs->setColNames({"a"});
+        auto* rhs = PassThroughNode::make(q, start);
+        rhs->setColNames({"b"});
+        // Fails for the different columns
+        auto* failed = Union::make(q, lhs, rhs);
+        // Another branch still running when it fails
+        auto* other = PassThroughNode::make(q, PassThroughNode::make(q, StartNode::make(q)));
+        auto* root = Union::make(q, failed, other);
+
+        auto status = schedule(q, root);
+        ASSERT_FALSE(status.ok());
+        EXPECT_NE(status.toString().find("different columns"), std::string::npos) << status;
+        auto result = executions(q);
+        EXPECT_EQ(result.end(), result.find(failed->id()));
+        EXPECT_EQ(result.end(), result.find(root->id()));
+
+        // Reported after all the running ones are done, nothing runs after it
+        runner_->join();
+        runner_ = std::make_unique<folly::CPUThreadPoolExecutor>(4);
+        EXPECT_TRUE(q->moveOperatorStats().empty());
+    }
+}
+
+TEST_F(SchedulerTest, Loop) {
+    auto qctx = makeQueryContext();
+    auto* q = qctx.get();
+    std::string counter = "counter";
+    q->ectx()->setValue(counter, 0);
+    // ++counter{0} <= 3
+    auto* condition = q->objPool()->add(new RelationalExpression(
+        Expression::Kind::kRelLE,
+        new UnaryExpression(
+            Expression::Kind::kUnaryIncr,
+            new VersionedVariableExpression(new std::string(counter), new ConstantExpression(0))),
+        new ConstantExpression(3)));
+    auto* bodyStart = StartNode::make(q);
+    auto* body = PassThroughNode::make(q, bodyStart);
+    auto* start = StartNode::make(q);
+    auto* loop = Loop::make(q, start, body, condition);
+
+    auto status = schedule(q, loop);
+    ASSERT_TRUE(status.ok()) << status;
+    auto result = executions(q);
+    EXPECT_EQ(1, result[start->id()]);
+    // The body graph is run again for each round
+    EXPECT_EQ(4, result[loop->id()]);
+    EXPECT_EQ(3, result[bodyStart->id()]);
+    EXPECT_EQ(3, result[body->id()]);
+}
+
+TEST_F(SchedulerTest, Select) {
+    for (auto cond : {true, false}) {
+        auto qctx = makeQueryContext();
+        auto* q = qctx.get();
+        auto* thenStart = StartNode::make(q);
+        auto* thenBody = PassThroughNode::make(q, thenStart);
+        auto* elseStart = StartNode::make(q);
+        auto* elseBody = PassThroughNode::make(q, elseStart);
+        auto* condition = q->objPool()->add(new ConstantExpression(cond));
+        auto* select = Select::make(q, StartNode::make(q), thenBody, elseBody, condition);
+
+        auto status = schedule(q, select);
+        ASSERT_TRUE(status.ok()) << status;
+        auto result = executions(q);
+        EXPECT_EQ(1, result[select->id()]);
+        // Only the branch selected is run
+        EXPECT_EQ(cond ? 1 : 0, result[thenBody->id()]);
+        EXPECT_EQ(cond ? 1 : 0, result[thenStart->id()]);
+        EXPECT_EQ(cond ? 0 : 1, result[elseBody->id()]);
+        EXPECT_EQ(cond ? 0 : 1, result[elseStart->id()]);
+    }
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,206 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "context/QueryContext.h"
+#include "executor/query/TraverseExecutor.h"
+#include "planner/Query.h"
+
+namespace nebula {
+namespace graph {
+
+class TraverseTest : public testing::Test {
+protected:
+    struct LikeEdge {
+        std::string src;
+        std::string dst;
+        int64_t likeness;
+    };
+
+    void SetUp() override {
+        qctx_ = std::make_unique<QueryContext>();
+        // 1 -> 2 -> 3 -> 1 is a cycle, 2 -> 4
+        edges_ = {
+            {"1", "2", 90},
+            {"2", "3", 80},
+            {"3", "1", 70},
+            {"2", "4", 60},
+        };
+    }
+
+    std::unique_ptr<TraverseExecutor> makeExecutor(
+            int64_t minSteps,
+            int64_t maxSteps,
+            storage::cpp2::EdgeDirection direction = storage::cpp2::EdgeDirection::OUT_EDGE,
+            Expression* edgeFilter = nullptr) {
+        auto* node = Traverse::make(qctx_.get(),
+                                    nullptr,
+                                    1,
+                                    nullptr,
+                                    direction,
+                                    nullptr,
+                                    nullptr,
+                                    minSteps,
+                                    maxSteps,
+                                    edgeFilter);
+        node->setColNames({"v", "e", "dst"});
+        auto exe = std::make_unique<TraverseExecutor>(node, qctx_.get());
+        exe->frontier_.emplace_back(Row({"1"}));
+        return exe;
+    }
+
+    // Run the traverse against the edges_ instead of the storage
+    Status traverse(TraverseExecutor* exe) {
+        auto direction = exe->traverse_->edgeDirection();
+        std::vector<std::string> colNames = {kVid, "_stats"};
+        if (direction != storage::cpp2::EdgeDirection::IN_EDGE) {
+            colNames.emplace_back("_edge:+like:_type:_dst:_rank:likeness");
+        }
+        if (direction != storage::cpp2::EdgeDirection::OUT_EDGE) {
+            colNames.emplace_back("_edge:-like:_type:_dst:_rank:likeness");
+        }
+        colNames.emplace_back("_expr");
+        while (!exe->done()) {
+            DataSet ds;
+            ds.colNames = colNames;
+            for (auto& row : exe->frontier_) {
+                auto& vid = row.values.front().getStr();
+                Row nbrRow;
+                nbrRow.values = {vid, Value()};
+                for (auto type : {1, -1}) {
+                    if ((type > 0 && direction == storage::cpp2::EdgeDirection::IN_EDGE) ||
+                        (type < 0 && direction == storage::cpp2::EdgeDirection::OUT_EDGE)) {
+                        continue;
+                    }
+                    List neighbors;
+                    for (auto& edge : edges_) {
+                        auto& from = type > 0 ? edge.src : edge.dst;
+                        auto& to = type > 0 ? edge.dst : edge.src;
+                        if (from == vid) {
+                            neighbors.values.emplace_back(List({type, to, 0, edge.likeness}));
+                        }
+                    }
+                    nbrRow.values.emplace_back(std::move(neighbors));
+                }
+                nbrRow.values.emplace_back(Value());
+                ds.rows.emplace_back(std::move(nbrRow));
+            }
+            List datasets;
+            datasets.values.emplace_back(std::move(ds));
+            NG_RETURN_IF_ERROR(exe->expand(std::move(datasets)));
+        }
+        return Status::OK();
+    }
+
+    // The paths in the result, e.g. "1->2->3"
+    static std::vector<std::string> paths(const DataSet& ds) {
+        std::vector<std::string> result;
+        for (auto& row : ds.rows) {
+            std::string path = row.values[0].getVertex().vid;
+            for (auto& edge : row.values[1].getList().values) {
+                path += "->" + edge.getEdge().dst;
+            }
+            EXPECT_EQ(Value(path.substr(path.rfind('>') + 1)), row.values[2]);
+            result.emplace_back(std::move(path));
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+protected:
+    std::unique_ptr<QueryContext>   qctx_;
+    std::vector<LikeEdge>           edges_;
+};
+
+TEST_F(TraverseTest, Steps) {
+    {
+        auto exe = makeExecutor(1, 3);
+        ASSERT_TRUE(traverse(exe.get()).ok());
+        auto ds = exe->collect();
+        EXPECT_EQ(ds.colNames, std::vector<std::string>({"v", "e", "dst"}));
+        std::vector<std::string> expected = {"1->2", "1->2->3", "1->2->3->1", "1->2->4"};
+        EXPECT_EQ(expected, paths(ds));
+    }
+    {
+        auto exe = makeExecutor(2, 2);
+        ASSERT_TRUE(traverse(exe.get()).ok());
+        std::vector<std::string> expected = {"1->2->3", "1->2->4"};
+        EXPECT_EQ(expected, paths(exe->collect()));
+    }
+    {
+        // The cycle ends as all its edges are used
+        auto exe = makeExecutor(4, 10);
+        ASSERT_TRUE(traverse(exe.get()).ok());
+        EXPECT_EQ(4, exe->steps_.size());
+        EXPECT_TRUE(exe->steps_.back().empty());
+        EXPECT_TRUE(paths(exe->collect()).empty());
+    }
+    {
+        auto exe = makeExecutor(0, 1);
+        ASSERT_TRUE(traverse(exe.get()).ok());
+        std::vector<std::string> expected = {"1", "1->2"};
+        EXPECT_EQ(expected, paths(exe->collect()));
+    }
+}
+
+TEST_F(TraverseTest, ZeroStep) {
+    auto exe = makeExecutor(0, 0);
+    ASSERT_TRUE(traverse(exe.get()).ok());
+    EXPECT_TRUE(exe->steps_.empty());
+    auto ds = exe->collect();
+    ASSERT_EQ(1, ds.rows.size());
+    EXPECT_EQ(std::vector<std::string>({"1"}), paths(ds));
+    EXPECT_TRUE(ds.rows.front().values[1].getList().values.empty());
+}
+
+TEST_F(TraverseTest, Both) {
+    // The edge got reversely from the other end is the same one
+    auto exe = makeExecutor(1, 2, storage::cpp2::EdgeDirection::BOTH);
+    ASSERT_TRUE(traverse(exe.get()).ok());
+    std::vector<std::string> expected = {
+        "1->2", "1->2->3", "1->2->4", "1->3", "1->3->2"};
+    EXPECT_EQ(expected, paths(exe->collect()));
+}
+
+TEST_F(TraverseTest, EdgeFilter) {
+    // like.likeness > 65 on every step
+    auto* filter = new RelationalExpression(
+        Expression::Kind::kRelGT,
+        new AttributeExpression(new EdgeExpression(), new LabelExpression("likeness")),
+        new ConstantExpression(65));
+    qctx_->objPool()->add(filter);
+    auto exe = makeExecutor(1, 3, storage::cpp2::EdgeDirection::OUT_EDGE, filter);
+    ASSERT_TRUE(traverse(exe.get()).ok());
+    std::vector<std::string> expected = {"1->2", "1->2->3", "1->2->3->1"};
+    EXPECT_EQ(expected, paths(exe->collect()));
+}
+
+TEST_F(TraverseTest, Frontier) {
+    // Both 1 -> 2 -> 4 and 1 -> 3 -> 4 end at 4, which is expanded once
+    edges_ = {
+        {"1", "2", 90},
+        {"1", "3", 80},
+        {"2", "4", 70},
+        {"3", "4", 60},
+        {"4", "5", 50},
+    };
+    {
+        auto exe = makeExecutor(1, 2);
+        ASSERT_TRUE(traverse(exe.get()).ok());
+        ASSERT_EQ(1, exe->frontier_.size());
+        EXPECT_EQ(Value("4"), exe->frontier_.front().values.front());
+    }
+    {
+        auto exe = makeExecutor(3, 3);
+        ASSERT_TRUE(traverse(exe.get()).ok());
+        std::vector<std::string> expected = {"1->2->4->5", "1->3->4->5"};
+        EXPECT_EQ(expected, paths(exe->collect()));
+    }
+}
+
+}   // namespace graph
+}   // namespace nebula
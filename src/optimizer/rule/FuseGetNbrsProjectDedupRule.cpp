@@ -0,0 +1,85 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "optimizer/rule/FuseGetNbrsProjectDedupRule.h"
+
+#include "optimizer/OptGroup.h"
+#include "planner/PlanNode.h"
+#include "planner/Query.h"
+
+using nebula::graph::Dedup;
+using nebula::graph::GetNeighbors;
+using nebula::graph::GetNeighborsProjectDedup;
+using nebula::graph::PlanNode;
+using nebula::graph::Project;
+using nebula::graph::QueryContext;
+
+namespace nebula {
+namespace opt {
+
+std::unique_ptr<OptRule> FuseGetNbrsProjectDedupRule::kInstance =
+    std::unique_ptr<FuseGetNbrsProjectDedupRule>(new FuseGetNbrsProjectDedupRule());
+
+FuseGetNbrsProjectDedupRule::FuseGetNbrsProjectDedupRule() {
+    RuleSet::QueryRules().addRule(this);
+}
+
+const Pattern &FuseGetNbrsProjectDedupRule::pattern() const {
+    static Pattern pattern =
+        Pattern::create(graph::PlanNode::Kind::kDedup,
+                        {Pattern::create(graph::PlanNode::Kind::kProject,
+                                         {Pattern::create(graph::PlanNode::Kind::kGetNeighbors)})});
+    return pattern;
+}
+
+StatusOr<OptRule::TransformResult> FuseGetNbrsProjectDedupRule::transform(
+    QueryContext *qctx,
+    const MatchedResult &matched) const {
+    auto dedupGroupNode = matched.node;
+    auto projGroupNode = matched.dependencies.front().node;
+    auto gnGroupNode = matched.dependencies.front().dependencies.front().node;
+
+    const auto dedup = static_cast<const Dedup *>(dedupGroupNode->node());
+    const auto proj = static_cast<const Project *>(projGroupNode->node());
+    const auto gn = static_cast<const GetNeighbors *>(gnGroupNode->node());
+
+    if (proj->inputVar() != gn->outputVar() || dedup->inputVar() != proj->outputVar()) {
+        return TransformResult::noTransform();
+    }
+
+    // The projected rows are only read by the Dedup
+    auto symTable = qctx->symTable();
+    const auto &projReaders = symTable->getVar(proj->outputVar())->readBy;
+    if (projReaders.size() != 1 || projReaders.count(const_cast<Dedup *>(dedup)) == 0) {
+        return TransformResult::noTransform();
+    }
+    // The neighbors may be read by the others too, e.g. the final Project of GO
+    const auto &gnReaders = symTable->getVar(gn->outputVar())->readBy;
+    bool keepNeighbors = std::any_of(gnReaders.begin(), gnReaders.end(), [proj](auto reader) {
+        return reader != proj;
+    });
+
+    auto fused = GetNeighborsProjectDedup::make(qctx, nullptr, gn, proj, dedup);
+    fused->setInputVar(gn->inputVar());
+    fused->takeOutputVar(dedup);
+    fused->setKeepNeighbors(keepNeighbors);
+    auto fusedGroupNode = OptGroupNode::create(qctx, fused, dedupGroupNode->group());
+    for (auto dep : gnGroupNode->dependencies()) {
+        fusedGroupNode->dependsOn(dep);
+    }
+
+    TransformResult result;
+    result.eraseAll = true;
+    result.newGroupNodes.emplace_back(fusedGroupNode);
+    return result;
+}
+
+std::string FuseGetNbrsProjectDedupRule::toString() const {
+    return "FuseGetNbrsProjectDedupRule";
+}
+
+}   // namespace opt
+}   // namespace nebula
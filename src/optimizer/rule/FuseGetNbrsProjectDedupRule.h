@@ -0,0 +1,36 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef OPTIMIZER_RULE_FUSEGETNBRSPROJECTDEDUPRULE_H_
+#define OPTIMIZER_RULE_FUSEGETNBRSPROJECTDEDUPRULE_H_
+
+#include <memory>
+
+#include "optimizer/OptRule.h"
+
+namespace nebula {
+namespace opt {
+
+// Fuse the Dedup of the Project of the neighbors into a GetNeighborsProjectDedup
+class FuseGetNbrsProjectDedupRule final : public OptRule {
+public:
+    const Pattern &pattern() const override;
+
+    StatusOr<OptRule::TransformResult> transform(graph::QueryContext *qctx,
+                                                 const MatchedResult &matched) const override;
+
+    std::string toString() const override;
+
+private:
+    FuseGetNbrsProjectDedupRule();
+
+    static std::unique_ptr<OptRule> kInstance;
+};
+
+}   // namespace opt
+}   // namespace nebula
+
+#endif   // OPTIMIZER_RULE_FUSEGETNBRSPROJECTDEDUPRULE_H_
@@ -6,15 +6,23 @@
 
 #include "optimizer/rule/IndexScanRule.h"
 #include "common/expression/LabelAttributeExpression.h"
+#include "context/IndexStats.h"
 #include "optimizer/OptGroup.h"
 #include "planner/PlanNode.h"
 #include "planner/Query.h"
+#include "util/ExpressionUtils.h"
 
+using nebula::graph::ExpressionUtils;
 using nebula::graph::IndexScan;
 
 namespace nebula {
 namespace opt {
 
+// The estimates of the index never looked up with the same column hints
+static constexpr double kDefaultIndexRows = 1000000.0;
+static constexpr double kPrefixSelectivity = 0.001;
+static constexpr double kRangeSelectivity = 0.3;
+
 std::unique_ptr<OptRule> IndexScanRule::kInstance =
     std::unique_ptr<IndexScanRule>(new IndexScanRule());
 
@@ -39,9 +47,17 @@ StatusOr<OptRule::TransformResult> IndexScanRule::transform(graph::QueryContext*
     NG_RETURN_IF_ERROR(analyzeExpression(filter.get(), &items, &kind, isEdge(groupNode)));
 
     IndexQueryCtx iqctx = std::make_unique<std::vector<IndexQueryContext>>();
-    NG_RETURN_IF_ERROR(createIndexQueryCtx(iqctx, kind, items, qctx, groupNode));
+    NG_RETURN_IF_ERROR(createIndexQueryCtx(iqctx, kind, items, filter.get(), qctx, groupNode));
 
     auto newIN = static_cast<const IndexScan*>(groupNode->node())->clone(qctx);
+    if (iqctx->size() > 1) {
+        // The items of AND are served by the intersection of several indexes,
+        // the ones of OR by the union.
+        newIN->setIntersect(kind.isLogicalAnd());
+        newIN->setDedup(!kind.isLogicalAnd());
+    } else if (iqctx->size() == 1) {
+        newIN->setSortedBy(sortedBy(qctx, groupNode, iqctx->front()));
+    }
     newIN->setIndexQueryContext(std::move(iqctx));
     auto newGroupNode = OptGroupNode::create(qctx, newIN, groupNode->group());
     if (groupNode->dependencies().size() != 1) {
@@ -61,35 +77,150 @@ std::string IndexScanRule::toString() const {
 Status IndexScanRule::createIndexQueryCtx(IndexQueryCtx &iqctx,
                                           ScanKind kind,
                                           const FilterItems& items,
+                                          const Expression* filter,
                                           graph::QueryContext *qctx,
                                           const OptGroupNode *groupNode) const {
     return kind.isLogicalAnd()
-           ? createIQCWithLogicAnd(iqctx, items, qctx, groupNode)
-           : createIQCWithLogicOR(iqctx, items, qctx, groupNode);
+           ? createIQCWithLogicAnd(iqctx, items, filter, qctx, groupNode)
+           : createIQCWithLogicOR(iqctx, items, filter, qctx, groupNode);
 }
 
 Status IndexScanRule::createIQCWithLogicAnd(IndexQueryCtx &iqctx,
                                             const FilterItems& items,
+                                            const Expression* filter,
                                             graph::QueryContext *qctx,
                                             const OptGroupNode *groupNode) const {
+    auto space = spaceId(groupNode);
+    // A single index covering all the items
+    IndexQueryCtx single;
+    auto singleRows = std::numeric_limits<double>::max();
     auto index = findOptimalIndex(qctx, groupNode, items);
-    if (index == nullptr) {
+    if (index != nullptr) {
+        single = std::make_unique<std::vector<IndexQueryContext>>();
+        NG_RETURN_IF_ERROR(appendIQCtx(index, items, single, filter));
+        singleRows = estimateRows(space, single->front());
+    }
+
+    // The intersection of the indexes of each column
+    IndexQueryCtx intersect = std::make_unique<std::vector<IndexQueryContext>>();
+    auto intersectRows = std::numeric_limits<double>::max();
+    if (createIQCWithIntersect(intersect, items, filter, qctx, groupNode).ok() &&
+        intersect->size() > 1) {
+        intersectRows = 0.0;
+        for (const auto& ctx : *intersect) {
+            intersectRows += estimateRows(space, ctx);
+        }
+    }
+
+    if (single == nullptr && intersectRows == std::numeric_limits<double>::max()) {
         return Status::IndexNotFound("No valid index found");
     }
+    auto& best = intersectRows < singleRows ? intersect : single;
+    for (auto& ctx : *best) {
+        iqctx->emplace_back(std::move(ctx));
+    }
+    return Status::OK();
+}
 
-    return appendIQCtx(index, items, iqctx);
+Status IndexScanRule::createIQCWithIntersect(IndexQueryCtx &iqctx,
+                                             const FilterItems& items,
+                                             const Expression* filter,
+                                             graph::QueryContext *qctx,
+                                             const OptGroupNode *groupNode) const {
+    // The operands are collected in the same order as the filter items, and the
+    // residual predicate of each context is the operands of its column.
+    if (filter == nullptr || filter->kind() != Expression::Kind::kLogicalAnd) {
+        return Status::Error("Not a conjunction");
+    }
+    auto operands = ExpressionUtils::pullAnds(filter);
+    if (operands.size() != items.items.size()) {
+        return Status::Error("Unknown operands");
+    }
+    std::vector<std::string> cols;
+    for (const auto& item : items.items) {
+        if (std::find(cols.begin(), cols.end(), item.col_) == cols.end()) {
+            cols.emplace_back(item.col_);
+        }
+    }
+    auto conjunct = [](std::unique_ptr<Expression> lhs, std::unique_ptr<Expression> rhs) {
+        if (lhs == nullptr) {
+            return rhs;
+        }
+        return std::unique_ptr<Expression>(std::make_unique<LogicalExpression>(
+            Expression::Kind::kLogicalAnd, lhs.release(), rhs.release()));
+    };
+    // The columns with the != items only could not be scanned by the hints,
+    // their items are left to the filter of the first context instead.
+    FilterItems neItems;
+    std::unique_ptr<Expression> neFilter;
+    std::vector<std::pair<FilterItems, std::unique_ptr<Expression>>> scans;
+    for (const auto& col : cols) {
+        FilterItems colItems;
+        std::unique_ptr<Expression> colFilter;
+        bool hinted = false;
+        for (size_t i = 0; i < items.items.size(); ++i) {
+            const auto& item = items.items[i];
+            if (item.col_ != col) {
+                continue;
+            }
+            colItems.addItem(item.col_, item.relOP_, item.value_);
+            colFilter = conjunct(std::move(colFilter), operands[i]->clone());
+            hinted = hinted || item.relOP_ != Expression::Kind::kRelNE;
+        }
+        if (!hinted) {
+            neItems.items.insert(neItems.items.end(), colItems.items.begin(), colItems.items.end());
+            neFilter = conjunct(std::move(neFilter), std::move(colFilter));
+            continue;
+        }
+        scans.emplace_back(std::move(colItems), std::move(colFilter));
+    }
+    if (scans.empty()) {
+        return Status::IndexNotFound("No valid index found for the != items only");
+    }
+    for (size_t i = 0; i < scans.size(); ++i) {
+        auto& colItems = scans[i].first;
+        auto index = findOptimalIndex(qctx, groupNode, colItems);
+        if (index == nullptr) {
+            return Status::IndexNotFound("No valid index found for `%s'",
+                                         colItems.items.front().col_.c_str());
+        }
+        auto& colFilter = scans[i].second;
+        if (i == 0 && neFilter != nullptr) {
+            colItems.items.insert(colItems.items.end(), neItems.items.begin(), neItems.items.end());
+            colFilter = conjunct(std::move(colFilter), std::move(neFilter));
+        }
+        NG_RETURN_IF_ERROR(appendIQCtx(index, colItems, iqctx, colFilter.get()));
+    }
+    return Status::OK();
 }
 
 Status IndexScanRule::createIQCWithLogicOR(IndexQueryCtx &iqctx,
                                            const FilterItems& items,
+                                           const Expression* filter,
                                            graph::QueryContext *qctx,
                                            const OptGroupNode *groupNode) const {
-    for (auto const& item : items.items) {
+    // Each operand of OR is served by its own index query context, so the residual
+    // predicate of one context is the operand itself. The operands are collected in
+    // the same order as analyzeExpression produces the filter items.
+    std::vector<const Expression*> operands;
+    if (filter != nullptr) {
+        operands = filter->kind() == Expression::Kind::kLogicalOr
+                   ? ExpressionUtils::pullOrs(filter)
+                   : std::vector<const Expression*>{filter};
+    }
+    if (operands.size() != items.items.size()) {
+        operands.clear();
+    }
+    for (size_t i = 0; i < items.items.size(); ++i) {
+        const auto& item = items.items[i];
         auto index = findOptimalIndex(qctx, groupNode, FilterItems({item}));
         if (index == nullptr) {
             return Status::IndexNotFound("No valid index found");
         }
-        auto ret = appendIQCtx(index, FilterItems({item}), iqctx);
+        auto ret = appendIQCtx(index,
+                               FilterItems({item}),
+                               iqctx,
+                               operands.empty() ? nullptr : operands[i]);
         NG_RETURN_IF_ERROR(ret);
     }
     return Status::OK();
@@ -97,33 +228,35 @@ Status IndexScanRule::createIQCWithLogicOR(IndexQueryCtx &iqctx,
 
 Status IndexScanRule::appendIQCtx(const IndexItem& index,
                                   const FilterItems& items,
-                                  IndexQueryCtx &iqctx) const {
+                                  IndexQueryCtx &iqctx,
+                                  const Expression* filter) const {
     auto fields = index->get_fields();
     IndexQueryContext ctx;
     decltype(ctx.column_hints) hints;
+    // The count of filter items which are covered by column hints
+    size_t hintedItems = 0;
     for (const auto& field : fields) {
         bool found = false;
         FilterItems filterItems;
         for (const auto& item : items.items) {
-            if (item.col_ != field.get_name()) {
+            // NE expr could not be a column hint, it's left to the filter of storage
+            if (item.col_ != field.get_name() ||
+                item.relOP_ == RelationalExpression::Kind::kRelNE) {
                 continue;
             }
             filterItems.addItem(item.col_, item.relOP_, item.value_);
             found = true;
         }
         if (!found) break;
-        // TODO (sky) : rewrite filter expr. NE expr should be add filter expr .
-        auto it = std::find_if(filterItems.items.begin(), filterItems.items.end(),
-                               [](const auto &ite) {
-                                   return ite.relOP_ == RelationalExpression::Kind::kRelNE;
-                               });
-        if (it != filterItems.items.end()) {
-            break;
-        }
         NG_RETURN_IF_ERROR(appendColHint(hints, filterItems, field));
+        hintedItems += filterItems.items.size();
     }
     ctx.set_index_id(index->get_index_id());
-    // TODO (sky) : rewrite expr and set filter
+    if (filter != nullptr && hintedItems < items.items.size()) {
+        // The items covered by the hints are evaluated again in storage,
+        // which is harmless and keeps the filter same as the user's one.
+        ctx.set_filter(Expression::encode(*filter));
+    }
     ctx.set_column_hints(std::move(hints));
     iqctx->emplace_back(std::move(ctx));
     return Status::OK();
@@ -370,16 +503,83 @@ IndexItem IndexScanRule::findOptimalIndex(graph::QueryContext *qctx,
         return nullptr;
     }
     // Step 2 : find optimal indexes for equal condition.
-    auto indexesEq = findIndexForEqualScan(validIndexes, items);
-    if (indexesEq.size() == 1) {
-        return indexesEq[0];
+    auto preferred = findIndexForEqualScan(validIndexes, items);
+    if (preferred.size() > 1) {
+        // Step 3 : find optimal indexes for range condition.
+        preferred = findIndexForRangeScan(preferred, items);
+    }
+    // Step 4 : find the index reading the least rows, the ones preferred by
+    //          the rule of priority win the ties.
+    auto space = spaceId(groupNode);
+    auto optimal = preferred[0];
+    auto minRows = estimateRows(space, optimal, items);
+    for (const auto* indexes : {&preferred, &validIndexes}) {
+        for (const auto& index : *indexes) {
+            auto rows = estimateRows(space, index, items);
+            if (rows < minRows) {
+                optimal = index;
+                minRows = rows;
+            }
+        }
+    }
+    return optimal;
+}
+
+// static
+double IndexScanRule::estimateRows(GraphSpaceID space, const IndexQueryContext& ctx) {
+    auto stats = graph::IndexStats::instance().estimate(space, ctx);
+    if (stats.hasValue()) {
+        return stats.value();
     }
-    // Step 3 : find optimal indexes for range condition.
-    auto indexesRange = findIndexForRangeScan(indexesEq, items);
+    auto rows = kDefaultIndexRows;
+    for (const auto& hint : ctx.get_column_hints()) {
+        rows *= hint.get_scan_type() == storage::cpp2::ScanType::PREFIX
+                ? kPrefixSelectivity
+                : kRangeSelectivity;
+    }
+    return rows;
+}
 
-    // At this stage, all the optimizations are done.
-    // Because the storage layer only needs one. So return first one of indexesRange.
-    return indexesRange[0];
+double IndexScanRule::estimateRows(GraphSpaceID space,
+                                   const IndexItem& index,
+                                   const FilterItems& items) const {
+    IndexQueryCtx iqctx = std::make_unique<std::vector<IndexQueryContext>>();
+    if (!appendIQCtx(index, items, iqctx).ok()) {
+        return std::numeric_limits<double>::max();
+    }
+    return estimateRows(space, iqctx->front());
+}
+
+std::vector<size_t> IndexScanRule::sortedBy(graph::QueryContext *qctx,
+                                            const OptGroupNode *groupNode,
+                                            const IndexQueryContext& ctx) const {
+    auto indexes = allIndexesBySchema(qctx, groupNode);
+    auto index = std::find_if(indexes.begin(), indexes.end(), [&ctx](const auto& item) {
+        return item->get_index_id() == ctx.get_index_id();
+    });
+    if (index == indexes.end()) {
+        return {};
+    }
+    // The entries of the same prefix are sorted by the following fields
+    const auto& hints = ctx.get_column_hints();
+    size_t prefix = 0;
+    while (prefix < hints.size() &&
+           hints[prefix].get_scan_type() == storage::cpp2::ScanType::PREFIX) {
+        ++prefix;
+    }
+    // The returned columns follow the vertex or the edge
+    const auto* returnCols = static_cast<const IndexScan*>(groupNode->node())->returnColumns();
+    size_t keySize = isEdge(groupNode) ? 3 : 1;
+    std::vector<size_t> sortedBy;
+    const auto& fields = (*index)->get_fields();
+    for (size_t i = prefix; i < fields.size(); ++i) {
+        auto found = std::find(returnCols->begin(), returnCols->end(), fields[i].get_name());
+        if (found == returnCols->end()) {
+            break;
+        }
+        sortedBy.emplace_back(keySize + (found - returnCols->begin()));
+    }
+    return sortedBy;
 }
 
 std::vector<IndexItem>
@@ -29,6 +29,7 @@ using IndexQueryCtx = std::unique_ptr<std::vector<IndexQueryContext>>;
 class IndexScanRule final : public OptRule {
     FRIEND_TEST(IndexScanRuleTest, BoundValueTest);
     FRIEND_TEST(IndexScanRuleTest, IQCtxTest);
+    FRIEND_TEST(IndexScanRuleTest, EstimateRowsTest);
 
 public:
     const Pattern& pattern() const override;
@@ -104,22 +105,38 @@ private:
     Status createIndexQueryCtx(IndexQueryCtx &iqctx,
                                ScanKind kind,
                                const FilterItems& items,
+                               const Expression* filter,
                                graph::QueryContext *qctx,
                                const OptGroupNode *groupNode) const;
 
     Status createIQCWithLogicAnd(IndexQueryCtx &iqctx,
                                  const FilterItems& items,
+                                 const Expression* filter,
                                  graph::QueryContext *qctx,
                                  const OptGroupNode *groupNode) const;
 
     Status createIQCWithLogicOR(IndexQueryCtx &iqctx,
                                 const FilterItems& items,
+                                const Expression* filter,
                                 graph::QueryContext *qctx,
                                 const OptGroupNode *groupNode) const;
 
+    // Serve the items of each column by an index led by the column, the
+    // results of the contexts are intersected by the executor. The columns
+    // with != items only are filtered by the first context.
+    Status createIQCWithIntersect(IndexQueryCtx &iqctx,
+                                  const FilterItems& items,
+                                  const Expression* filter,
+                                  graph::QueryContext *qctx,
+                                  const OptGroupNode *groupNode) const;
+
+    // The `filter' is the residual predicate set to the index query context
+    // when some items could not be served by the column hints of the index,
+    // so storage drops the mismatched entries before returning them.
     Status appendIQCtx(const IndexItem& index,
                        const FilterItems& items,
-                       IndexQueryCtx &iqctx) const;
+                       IndexQueryCtx &iqctx,
+                       const Expression* filter = nullptr) const;
 
     Status appendColHint(std::vector<IndexColumnHint>& hitns,
                          const FilterItems& items,
@@ -151,6 +168,19 @@ private:
                                const OptGroupNode *groupNode,
                                const FilterItems& items) const;
 
+    // The rows read by the index query context, estimated by the statistics of
+    // the former lookups, see graph::IndexStats, or by the column hints.
+    static double estimateRows(GraphSpaceID space, const IndexQueryContext& ctx);
+
+    double estimateRows(GraphSpaceID space,
+                        const IndexItem& index,
+                        const FilterItems& items) const;
+
+    // The returned columns by which the rows of each partition are sorted
+    std::vector<size_t> sortedBy(graph::QueryContext *qctx,
+                                 const OptGroupNode *groupNode,
+                                 const IndexQueryContext& ctx) const;
+
     std::vector<IndexItem>
     allIndexesBySchema(graph::QueryContext *qctx, const OptGroupNode *groupNode) const;
 
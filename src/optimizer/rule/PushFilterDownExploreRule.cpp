@@ -0,0 +1,82 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "optimizer/rule/PushFilterDownExploreRule.h"
+
+#include "common/expression/Expression.h"
+#include "common/expression/LogicalExpression.h"
+#include "optimizer/OptGroup.h"
+#include "planner/PlanNode.h"
+#include "planner/Query.h"
+
+using nebula::graph::Explore;
+using nebula::graph::Filter;
+using nebula::graph::QueryContext;
+
+namespace nebula {
+namespace opt {
+
+StatusOr<OptRule::TransformResult> PushFilterDownExploreRule::transform(
+    QueryContext *qctx,
+    const MatchedResult &matched) const {
+    auto filterGroupNode = matched.node;
+    auto exploreGroupNode = matched.dependencies.front().node;
+    auto filter = static_cast<const Filter *>(filterGroupNode->node());
+    auto explore = static_cast<const Explore *>(exploreGroupNode->node());
+
+    auto condition = filter->condition()->clone();
+    auto visitor = makeVisitor();
+    condition->accept(&visitor);
+    if (!visitor.ok()) {
+        return TransformResult::noTransform();
+    }
+
+    auto pool = qctx->objPool();
+    auto remainedExpr = std::move(visitor).remainedExpr();
+    OptGroupNode *newFilterGroupNode = nullptr;
+    if (remainedExpr != nullptr) {
+        auto newFilter = Filter::make(qctx, nullptr, pool->add(remainedExpr.release()));
+        newFilter->setOutputVar(filter->outputVar());
+        newFilter->setInputVar(filter->inputVar());
+        newFilterGroupNode = OptGroupNode::create(qctx, newFilter, filterGroupNode->group());
+    }
+
+    auto newExploreFilter = condition->encode();
+    if (!explore->filter().empty()) {
+        auto filterExpr = Expression::decode(explore->filter());
+        LogicalExpression logicExpr(
+            Expression::Kind::kLogicalAnd, condition.release(), filterExpr.release());
+        newExploreFilter = logicExpr.encode();
+    }
+
+    auto newExplore = clone(qctx, explore);
+    newExplore->setFilter(newExploreFilter);
+
+    OptGroupNode *newExploreGroupNode = nullptr;
+    if (newFilterGroupNode != nullptr) {
+        // Filter(A&&B)<-Explore(C) => Filter(A)<-Explore(B&&C)
+        auto newGroup = OptGroup::create(qctx);
+        newExploreGroupNode = newGroup->makeGroupNode(qctx, newExplore);
+        newFilterGroupNode->dependsOn(newGroup);
+    } else {
+        // Filter(A)<-Explore(C) => Explore(A&&C)
+        newExploreGroupNode = OptGroupNode::create(qctx, newExplore, filterGroupNode->group());
+        newExplore->takeOutputVar(filter);
+    }
+
+    for (auto dep : exploreGroupNode->dependencies()) {
+        newExploreGroupNode->dependsOn(dep);
+    }
+
+    TransformResult result;
+    result.eraseCurr = true;
+    result.newGroupNodes.emplace_back(newFilterGroupNode ? newFilterGroupNode
+                                                         : newExploreGroupNode);
+    return result;
+}
+
+}   // namespace opt
+}   // namespace nebula
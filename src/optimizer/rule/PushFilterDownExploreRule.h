@@ -0,0 +1,43 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef OPTIMIZER_RULE_PUSHFILTERDOWNEXPLORERULE_H_
+#define OPTIMIZER_RULE_PUSHFILTERDOWNEXPLORERULE_H_
+
+#include <memory>
+
+#include "optimizer/OptRule.h"
+#include "visitor/ExtractFilterExprVisitor.h"
+
+namespace nebula {
+namespace graph {
+class Explore;
+}   // namespace graph
+
+namespace opt {
+
+// Push the part of the filter evaluated by the storage into the explore node under it:
+//   Filter(A&&B)<-Explore(C) => Filter(A)<-Explore(B&&C)
+//   Filter(A)<-Explore(C) => Explore(A&&C)
+// The rules on each kind of explore node tell which part could be pushed.
+class PushFilterDownExploreRule : public OptRule {
+public:
+    StatusOr<TransformResult> transform(graph::QueryContext *qctx,
+                                        const MatchedResult &matched) const override;
+
+protected:
+    PushFilterDownExploreRule() = default;
+
+    virtual graph::ExtractFilterExprVisitor makeVisitor() const = 0;
+
+    virtual graph::Explore *clone(graph::QueryContext *qctx,
+                                  const graph::Explore *explore) const = 0;
+};
+
+}   // namespace opt
+}   // namespace nebula
+
+#endif   // OPTIMIZER_RULE_PUSHFILTERDOWNEXPLORERULE_H_
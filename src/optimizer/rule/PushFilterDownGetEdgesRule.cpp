@@ -0,0 +1,45 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "optimizer/rule/PushFilterDownGetEdgesRule.h"
+
+#include "planner/PlanNode.h"
+#include "planner/Query.h"
+
+using nebula::graph::Explore;
+using nebula::graph::GetEdges;
+using nebula::graph::QueryContext;
+
+namespace nebula {
+namespace opt {
+
+std::unique_ptr<OptRule> PushFilterDownGetEdgesRule::kInstance =
+    std::unique_ptr<PushFilterDownGetEdgesRule>(new PushFilterDownGetEdgesRule());
+
+PushFilterDownGetEdgesRule::PushFilterDownGetEdgesRule() {
+    RuleSet::QueryRules().addRule(this);
+}
+
+const Pattern &PushFilterDownGetEdgesRule::pattern() const {
+    static Pattern pattern = Pattern::create(
+        graph::PlanNode::Kind::kFilter, {Pattern::create(graph::PlanNode::Kind::kGetEdges)});
+    return pattern;
+}
+
+graph::ExtractFilterExprVisitor PushFilterDownGetEdgesRule::makeVisitor() const {
+    return graph::ExtractFilterExprVisitor::makePushGetEdges();
+}
+
+Explore *PushFilterDownGetEdgesRule::clone(QueryContext *qctx, const Explore *explore) const {
+    return static_cast<const GetEdges *>(explore)->clone(qctx);
+}
+
+std::string PushFilterDownGetEdgesRule::toString() const {
+    return "PushFilterDownGetEdgesRule";
+}
+
+}   // namespace opt
+}   // namespace nebula
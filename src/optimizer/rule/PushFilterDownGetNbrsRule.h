@@ -9,27 +9,25 @@
 
 #include <memory>
 
-#include "optimizer/OptRule.h"
+#include "optimizer/rule/PushFilterDownExploreRule.h"
 
 namespace nebula {
-namespace graph {
-class GetNeighbors;
-}   // namespace graph
-
 namespace opt {
 
-class PushFilterDownGetNbrsRule final : public OptRule {
+class PushFilterDownGetNbrsRule final : public PushFilterDownExploreRule {
 public:
     const Pattern &pattern() const override;
 
-    StatusOr<TransformResult> transform(graph::QueryContext *qctx,
-                                        const MatchedResult &matched) const override;
-
     std::string toString() const override;
 
 private:
     PushFilterDownGetNbrsRule();
 
+    graph::ExtractFilterExprVisitor makeVisitor() const override;
+
+    graph::Explore *clone(graph::QueryContext *qctx,
+                          const graph::Explore *explore) const override;
+
     static std::unique_ptr<OptRule> kInstance;
 };
 
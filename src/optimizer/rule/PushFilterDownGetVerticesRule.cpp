@@ -0,0 +1,45 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "optimizer/rule/PushFilterDownGetVerticesRule.h"
+
+#include "planner/PlanNode.h"
+#include "planner/Query.h"
+
+using nebula::graph::Explore;
+using nebula::graph::GetVertices;
+using nebula::graph::QueryContext;
+
+namespace nebula {
+namespace opt {
+
+std::unique_ptr<OptRule> PushFilterDownGetVerticesRule::kInstance =
+    std::unique_ptr<PushFilterDownGetVerticesRule>(new PushFilterDownGetVerticesRule());
+
+PushFilterDownGetVerticesRule::PushFilterDownGetVerticesRule() {
+    RuleSet::QueryRules().addRule(this);
+}
+
+const Pattern &PushFilterDownGetVerticesRule::pattern() const {
+    static Pattern pattern = Pattern::create(
+        graph::PlanNode::Kind::kFilter, {Pattern::create(graph::PlanNode::Kind::kGetVertices)});
+    return pattern;
+}
+
+graph::ExtractFilterExprVisitor PushFilterDownGetVerticesRule::makeVisitor() const {
+    return graph::ExtractFilterExprVisitor::makePushGetVertices();
+}
+
+Explore *PushFilterDownGetVerticesRule::clone(QueryContext *qctx, const Explore *explore) const {
+    return static_cast<const GetVertices *>(explore)->clone(qctx);
+}
+
+std::string PushFilterDownGetVerticesRule::toString() const {
+    return "PushFilterDownGetVerticesRule";
+}
+
+}   // namespace opt
+}   // namespace nebula
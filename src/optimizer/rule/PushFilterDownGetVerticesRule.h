@@ -0,0 +1,37 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef OPTIMIZER_RULE_PUSHFILTERDOWNGETVERTICESRULE_H_
+#define OPTIMIZER_RULE_PUSHFILTERDOWNGETVERTICESRULE_H_
+
+#include <memory>
+
+#include "optimizer/rule/PushFilterDownExploreRule.h"
+
+namespace nebula {
+namespace opt {
+
+class PushFilterDownGetVerticesRule final : public PushFilterDownExploreRule {
+public:
+    const Pattern &pattern() const override;
+
+    std::string toString() const override;
+
+private:
+    PushFilterDownGetVerticesRule();
+
+    graph::ExtractFilterExprVisitor makeVisitor() const override;
+
+    graph::Explore *clone(graph::QueryContext *qctx,
+                          const graph::Explore *explore) const override;
+
+    static std::unique_ptr<OptRule> kInstance;
+};
+
+}   // namespace opt
+}   // namespace nebula
+
+#endif   // OPTIMIZER_RULE_PUSHFILTERDOWNGETVERTICESRULE_H_
@@ -0,0 +1,79 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "optimizer/rule/PushLimitDownIndexScanRule.h"
+
+#include "optimizer/OptGroup.h"
+#include "planner/PlanNode.h"
+#include "planner/Query.h"
+
+using nebula::graph::IndexScan;
+using nebula::graph::Limit;
+using nebula::graph::PlanNode;
+using nebula::graph::QueryContext;
+
+namespace nebula {
+namespace opt {
+
+std::unique_ptr<OptRule> PushLimitDownIndexScanRule::kInstance =
+    std::unique_ptr<PushLimitDownIndexScanRule>(new PushLimitDownIndexScanRule());
+
+PushLimitDownIndexScanRule::PushLimitDownIndexScanRule() {
+    RuleSet::QueryRules().addRule(this);
+}
+
+const Pattern &PushLimitDownIndexScanRule::pattern() const {
+    static Pattern pattern =
+        Pattern::create(graph::PlanNode::Kind::kLimit,
+                        {Pattern::create(graph::PlanNode::Kind::kIndexScan)});
+    return pattern;
+}
+
+StatusOr<OptRule::TransformResult> PushLimitDownIndexScanRule::transform(
+    QueryContext *qctx,
+    const MatchedResult &matched) const {
+    auto limitGroupNode = matched.node;
+    auto scanGroupNode = matched.dependencies.front().node;
+
+    const auto limit = static_cast<const Limit *>(limitGroupNode->node());
+    const auto scan = static_cast<const IndexScan *>(scanGroupNode->node());
+
+    int64_t limitRows = limit->offset() + limit->count();
+    if (limitRows >= scan->limit() || limit->inputVar() != scan->outputVar()) {
+        return TransformResult::noTransform();
+    }
+    // The others reading the scanned rows need all of them
+    if (qctx->symTable()->getVar(scan->outputVar())->readBy.size() != 1) {
+        return TransformResult::noTransform();
+    }
+
+    auto newLimit = limit->clone(qctx);
+    auto newLimitGroupNode = OptGroupNode::create(qctx, newLimit, limitGroupNode->group());
+
+    auto newScan = scan->clone(qctx);
+    newScan->setIndexQueryContext(
+        std::make_unique<std::vector<storage::cpp2::IndexQueryContext>>(*scan->queryContext()));
+    newScan->setLimit(limitRows);
+    auto newScanGroup = OptGroup::create(qctx);
+    auto newScanGroupNode = newScanGroup->makeGroupNode(qctx, newScan);
+
+    newLimitGroupNode->dependsOn(newScanGroup);
+    for (auto dep : scanGroupNode->dependencies()) {
+        newScanGroupNode->dependsOn(dep);
+    }
+
+    TransformResult result;
+    result.eraseAll = true;
+    result.newGroupNodes.emplace_back(newLimitGroupNode);
+    return result;
+}
+
+std::string PushLimitDownIndexScanRule::toString() const {
+    return "PushLimitDownIndexScanRule";
+}
+
+}   // namespace opt
+}   // namespace nebula
@@ -0,0 +1,86 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "optimizer/rule/PushSortDownIndexScanRule.h"
+
+#include "optimizer/OptGroup.h"
+#include "planner/PlanNode.h"
+#include "planner/Query.h"
+
+using nebula::graph::IndexScan;
+using nebula::graph::PlanNode;
+using nebula::graph::QueryContext;
+using nebula::graph::Sort;
+
+namespace nebula {
+namespace opt {
+
+std::unique_ptr<OptRule> PushSortDownIndexScanRule::kInstance =
+    std::unique_ptr<PushSortDownIndexScanRule>(new PushSortDownIndexScanRule());
+
+PushSortDownIndexScanRule::PushSortDownIndexScanRule() {
+    RuleSet::QueryRules().addRule(this);
+}
+
+const Pattern &PushSortDownIndexScanRule::pattern() const {
+    static Pattern pattern =
+        Pattern::create(graph::PlanNode::Kind::kSort,
+                        {Pattern::create(graph::PlanNode::Kind::kIndexScan)});
+    return pattern;
+}
+
+StatusOr<OptRule::TransformResult> PushSortDownIndexScanRule::transform(
+    QueryContext *qctx,
+    const MatchedResult &matched) const {
+    auto sortGroupNode = matched.node;
+    auto scanGroupNode = matched.dependencies.front().node;
+
+    const auto sort = static_cast<const Sort *>(sortGroupNode->node());
+    const auto scan = static_cast<const IndexScan *>(scanGroupNode->node());
+
+    if (sort->inputVar() != scan->outputVar() || !scan->sortFactors().empty()) {
+        return TransformResult::noTransform();
+    }
+    // The rows of each partition are in the order already, which are merged
+    // instead of being sorted.
+    const auto &factors = sort->factors();
+    const auto &sortedBy = scan->sortedBy();
+    if (factors.empty() || factors.size() > sortedBy.size()) {
+        return TransformResult::noTransform();
+    }
+    for (size_t i = 0; i < factors.size(); ++i) {
+        if (factors[i].first != sortedBy[i] ||
+            factors[i].second != OrderFactor::OrderType::ASCEND) {
+            return TransformResult::noTransform();
+        }
+    }
+    // The others reading the scanned rows need them in the order of the index
+    if (qctx->symTable()->getVar(scan->outputVar())->readBy.size() != 1) {
+        return TransformResult::noTransform();
+    }
+
+    auto newScan = scan->clone(qctx);
+    newScan->setIndexQueryContext(
+        std::make_unique<std::vector<storage::cpp2::IndexQueryContext>>(*scan->queryContext()));
+    newScan->takeOutputVar(sort);
+    newScan->setSortFactors(factors);
+    auto newScanGroupNode = OptGroupNode::create(qctx, newScan, sortGroupNode->group());
+    for (auto dep : scanGroupNode->dependencies()) {
+        newScanGroupNode->dependsOn(dep);
+    }
+
+    TransformResult result;
+    result.eraseAll = true;
+    result.newGroupNodes.emplace_back(newScanGroupNode);
+    return result;
+}
+
+std::string PushSortDownIndexScanRule::toString() const {
+    return "PushSortDownIndexScanRule";
+}
+
+}   // namespace opt
+}   // namespace nebula
@@ -0,0 +1,83 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "optimizer/rule/PushTopNDownIndexScanRule.h"
+
+#include "optimizer/OptGroup.h"
+#include "planner/PlanNode.h"
+#include "planner/Query.h"
+
+using nebula::graph::IndexScan;
+using nebula::graph::PlanNode;
+using nebula::graph::QueryContext;
+using nebula::graph::TopN;
+
+namespace nebula {
+namespace opt {
+
+std::unique_ptr<OptRule> PushTopNDownIndexScanRule::kInstance =
+    std::unique_ptr<PushTopNDownIndexScanRule>(new PushTopNDownIndexScanRule());
+
+PushTopNDownIndexScanRule::PushTopNDownIndexScanRule() {
+    RuleSet::QueryRules().addRule(this);
+}
+
+const Pattern &PushTopNDownIndexScanRule::pattern() const {
+    static Pattern pattern =
+        Pattern::create(graph::PlanNode::Kind::kTopN,
+                        {Pattern::create(graph::PlanNode::Kind::kIndexScan)});
+    return pattern;
+}
+
+StatusOr<OptRule::TransformResult> PushTopNDownIndexScanRule::transform(
+    QueryContext *qctx,
+    const MatchedResult &matched) const {
+    auto topnGroupNode = matched.node;
+    auto scanGroupNode = matched.dependencies.front().node;
+
+    const auto topn = static_cast<const TopN *>(topnGroupNode->node());
+    const auto scan = static_cast<const IndexScan *>(scanGroupNode->node());
+
+    int64_t limitRows = topn->offset() + topn->count();
+    if (limitRows >= scan->limit() || topn->inputVar() != scan->outputVar()) {
+        return TransformResult::noTransform();
+    }
+    // The others reading the scanned rows need all of them
+    if (qctx->symTable()->getVar(scan->outputVar())->readBy.size() != 1) {
+        return TransformResult::noTransform();
+    }
+
+    auto newTopN = TopN::make(qctx, nullptr, topn->factors(), topn->offset(), topn->count());
+    newTopN->takeOutputVar(topn);
+    newTopN->setInputVar(topn->inputVar());
+    auto newTopNGroupNode = OptGroupNode::create(qctx, newTopN, topnGroupNode->group());
+
+    auto newScan = scan->clone(qctx);
+    newScan->setIndexQueryContext(
+        std::make_unique<std::vector<storage::cpp2::IndexQueryContext>>(*scan->queryContext()));
+    newScan->setLimit(limitRows);
+    // The scanned rows are the input of the TopN
+    newScan->setSortFactors(topn->factors());
+    auto newScanGroup = OptGroup::create(qctx);
+    auto newScanGroupNode = newScanGroup->makeGroupNode(qctx, newScan);
+
+    newTopNGroupNode->dependsOn(newScanGroup);
+    for (auto dep : scanGroupNode->dependencies()) {
+        newScanGroupNode->dependsOn(dep);
+    }
+
+    TransformResult result;
+    result.eraseAll = true;
+    result.newGroupNodes.emplace_back(newTopNGroupNode);
+    return result;
+}
+
+std::string PushTopNDownIndexScanRule::toString() const {
+    return "PushTopNDownIndexScanRule";
+}
+
+}   // namespace opt
+}   // namespace nebula
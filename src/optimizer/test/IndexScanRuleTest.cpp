@@ -5,6 +5,11 @@
  */
 
 #include <gtest/gtest.h>
+#include "common/expression/ConstantExpression.h"
+#include "common/expression/LogicalExpression.h"
+#include "common/expression/PropertyExpression.h"
+#include "common/expression/RelationalExpression.h"
+#include "context/IndexStats.h"
 #include "optimizer/OptimizerUtils.h"
 #include "optimizer/rule/IndexScanRule.h"
 
@@ -220,8 +225,125 @@ TEST(IndexScanRuleTest, IQCtxTest) {
                 ASSERT_EQ(Value(3L), hint.get_end_value());
             }
         }
+
+        // setup FilterItems col0 > 1 and col2 != 3
+        // col2 is not covered by column hints, so the residual filter is expected.
+        {
+            items.items.clear();
+            iqctx.get()->clear();
+            items.addItem("col0", RelationalExpression::Kind::kRelGT, Value(1L));
+            items.addItem("col2", RelationalExpression::Kind::kRelNE, Value(3L));
+            LogicalExpression filter(
+                Expression::Kind::kLogicalAnd,
+                new RelationalExpression(
+                    Expression::Kind::kRelGT,
+                    new TagPropertyExpression(new std::string("t"), new std::string("col0")),
+                    new ConstantExpression(1L)),
+                new RelationalExpression(
+                    Expression::Kind::kRelNE,
+                    new TagPropertyExpression(new std::string("t"), new std::string("col2")),
+                    new ConstantExpression(3L)));
+
+            auto ret = instance->appendIQCtx(index, items, iqctx, &filter);
+            ASSERT_TRUE(ret.ok());
+
+            ASSERT_EQ(1, iqctx->size());
+            ASSERT_EQ(1, (iqctx.get()->begin())->get_column_hints().size());
+            ASSERT_EQ(Expression::encode(filter), (iqctx.get()->begin())->get_filter());
+        }
+
+        // setup FilterItems col0 > 1 and col0 != 3
+        // col0 is still scanned by the range, and != is left to the filter.
+        {
+            items.items.clear();
+            iqctx.get()->clear();
+            items.addItem("col0", RelationalExpression::Kind::kRelGT, Value(1L));
+            items.addItem("col0", RelationalExpression::Kind::kRelNE, Value(3L));
+            LogicalExpression filter(
+                Expression::Kind::kLogicalAnd,
+                new RelationalExpression(
+                    Expression::Kind::kRelGT,
+                    new TagPropertyExpression(new std::string("t"), new std::string("col0")),
+                    new ConstantExpression(1L)),
+                new RelationalExpression(
+                    Expression::Kind::kRelNE,
+                    new TagPropertyExpression(new std::string("t"), new std::string("col0")),
+                    new ConstantExpression(3L)));
+
+            auto ret = instance->appendIQCtx(index, items, iqctx, &filter);
+            ASSERT_TRUE(ret.ok());
+
+            ASSERT_EQ(1, iqctx->size());
+            const auto& colHints = (iqctx.get()->begin())->get_column_hints();
+            ASSERT_EQ(1, colHints.size());
+            ASSERT_EQ("col0", colHints[0].get_column_name());
+            ASSERT_EQ(storage::cpp2::ScanType::RANGE, colHints[0].get_scan_type());
+            ASSERT_EQ(Value(2L), colHints[0].get_begin_value());
+            ASSERT_EQ(Expression::encode(filter), (iqctx.get()->begin())->get_filter());
+        }
+
+        // setup FilterItems col0 > 1, all items are covered by column hints
+        {
+            items.items.clear();
+            iqctx.get()->clear();
+            items.addItem("col0", RelationalExpression::Kind::kRelGT, Value(1L));
+            RelationalExpression filter(
+                Expression::Kind::kRelGT,
+                new TagPropertyExpression(new std::string("t"), new std::string("col0")),
+                new ConstantExpression(1L));
+
+            auto ret = instance->appendIQCtx(index, items, iqctx, &filter);
+            ASSERT_TRUE(ret.ok());
+
+            ASSERT_EQ(1, iqctx->size());
+            ASSERT_EQ(1, (iqctx.get()->begin())->get_column_hints().size());
+            ASSERT_EQ("", (iqctx.get()->begin())->get_filter());
+        }
     }
 }
 
+TEST(IndexScanRuleTest, EstimateRowsTest) {
+    auto* inst = std::move(IndexScanRule::kInstance).get();
+    auto* instance = static_cast<IndexScanRule*>(inst);
+    graph::IndexStats::instance().clear();
+
+    IndexItem index = std::make_unique<meta::cpp2::IndexItem>();
+    {
+        std::vector<meta::cpp2::ColumnDef> cols;
+        for (int8_t i = 0; i < 2; i++) {
+            meta::cpp2::ColumnDef col;
+            col.set_name(folly::stringPrintf("col%d", i));
+            col.type.set_type(meta::cpp2::PropertyType::INT64);
+            cols.emplace_back(std::move(col));
+        }
+        index->set_fields(std::move(cols));
+        index->set_index_id(1);
+    }
+    IndexScanRule::FilterItems eq;
+    eq.addItem("col0", RelationalExpression::Kind::kRelEQ, Value(1L));
+    IndexScanRule::FilterItems range;
+    range.addItem("col0", RelationalExpression::Kind::kRelGT, Value(1L));
+
+    // Estimated by the column hints
+    auto eqRows = instance->estimateRows(1, index, eq);
+    auto rangeRows = instance->estimateRows(1, index, range);
+    ASSERT_LT(eqRows, rangeRows);
+
+    // Estimated by the former lookups regardless of the values
+    IndexQueryCtx iqctx = std::make_unique<std::vector<IndexQueryContext>>();
+    ASSERT_TRUE(instance->appendIQCtx(index, range, iqctx).ok());
+    graph::IndexStats::instance().add(1, iqctx->front(), 10);
+    graph::IndexStats::instance().add(1, iqctx->front(), 20);
+    ASSERT_EQ(15.0, IndexScanRule::estimateRows(1, iqctx->front()));
+    IndexScanRule::FilterItems other;
+    other.addItem("col0", RelationalExpression::Kind::kRelGT, Value(100L));
+    ASSERT_EQ(15.0, instance->estimateRows(1, index, other));
+    ASSERT_LT(instance->estimateRows(1, index, other), eqRows);
+    // Not shared by the spaces
+    ASSERT_EQ(rangeRows, instance->estimateRows(2, index, other));
+
+    graph::IndexStats::instance().clear();
+}
+
 }   // namespace opt
 }   // namespace nebula
@@ -0,0 +1,58 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef OPTIMIZER_TEST_OPTRULETESTUTILS_H_
+#define OPTIMIZER_TEST_OPTRULETESTUTILS_H_
+
+#include "common/base/Base.h"
+#include "context/QueryContext.h"
+#include "optimizer/OptGroup.h"
+#include "optimizer/OptRule.h"
+#include "planner/PlanNode.h"
+
+namespace nebula {
+namespace opt {
+
+class OptRuleTestUtils final {
+public:
+    OptRuleTestUtils() = delete;
+
+    // The rule of the query rules named `name'
+    static const OptRule* rule(const std::string& name) {
+        for (auto* rule : RuleSet::QueryRules().rules()) {
+            if (rule->toString() == name) {
+                return rule;
+            }
+        }
+        LOG(FATAL) << "Unknown rule " << name;
+        return nullptr;
+    }
+
+    // Apply the rule to the node over the input, each in a group of its own.
+    // An empty result if it's not transformed.
+    static OptRule::TransformResult transform(graph::QueryContext* qctx,
+                                              const std::string& name,
+                                              graph::PlanNode* node,
+                                              graph::PlanNode* input) {
+        auto* inputGroup = OptGroup::create(qctx);
+        inputGroup->makeGroupNode(qctx, input);
+        auto* group = OptGroup::create(qctx);
+        auto* groupNode = group->makeGroupNode(qctx, node);
+        groupNode->dependsOn(inputGroup);
+
+        auto* optRule = rule(name);
+        auto matched = optRule->match(groupNode);
+        CHECK(matched.ok()) << matched.status();
+        auto result = optRule->transform(qctx, matched.value());
+        CHECK(result.ok()) << result.status();
+        return std::move(result).value();
+    }
+};
+
+}   // namespace opt
+}   // namespace nebula
+
+#endif   // OPTIMIZER_TEST_OPTRULETESTUTILS_H_
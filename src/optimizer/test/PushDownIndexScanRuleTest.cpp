@@ -0,0 +1,166 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "context/QueryContext.h"
+#include "optimizer/OptGroup.h"
+#include "optimizer/OptRule.h"
+#include "optimizer/test/OptRuleTestUtils.h"
+#include "planner/Query.h"
+
+using nebula::graph::IndexScan;
+using nebula::graph::Limit;
+using nebula::graph::PlanNode;
+using nebula::graph::QueryContext;
+using nebula::graph::Sort;
+using nebula::graph::TopN;
+
+namespace nebula {
+namespace opt {
+
+class PushDownIndexScanRuleTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        qctx_ = std::make_unique<QueryContext>();
+        scan_ = makeScan();
+    }
+
+    IndexScan* makeScan() {
+        auto contexts = std::make_unique<std::vector<storage::cpp2::IndexQueryContext>>(1);
+        auto returnCols = std::make_unique<std::vector<std::string>>();
+        returnCols->emplace_back("age");
+        returnCols->emplace_back("name");
+        auto* scan = IndexScan::make(
+            qctx_.get(), nullptr, 1, std::move(contexts), std::move(returnCols), false, 1);
+        scan->setColNames({"VertexID", "player.age", "player.name"});
+        // The index is on (age, name)
+        scan->setSortedBy({1, 2});
+        return scan;
+    }
+
+    // Transform the node over the scan, an empty result if it's not transformed
+    OptRule::TransformResult transform(const std::string& name, PlanNode* node) {
+        return OptRuleTestUtils::transform(qctx_.get(), name, node, scan_);
+    }
+
+    static const IndexScan* scanOf(const OptGroupNode* groupNode) {
+        CHECK_EQ(1, groupNode->dependencies().size());
+        auto* node = groupNode->dependencies().front()->groupNodes().front()->node();
+        CHECK(node->kind() == PlanNode::Kind::kIndexScan);
+        return static_cast<const IndexScan*>(node);
+    }
+
+    std::unique_ptr<QueryContext> qctx_;
+    // Read by the node over it only, unless the case says otherwise
+    IndexScan* scan_{nullptr};
+};
+
+TEST_F(PushDownIndexScanRuleTest, Limit) {
+    auto* limit = Limit::make(qctx_.get(), scan_, 2, 3);
+    limit->setColNames({"VertexID", "player.age", "player.name"});
+    auto result = transform("PushLimitDownIndexScanRule", limit);
+    ASSERT_TRUE(result.eraseAll);
+    ASSERT_EQ(1, result.newGroupNodes.size());
+
+    auto* newLimit = result.newGroupNodes.front()->node();
+    ASSERT_EQ(PlanNode::Kind::kLimit, newLimit->kind());
+    EXPECT_EQ(limit->outputVar(), newLimit->outputVar());
+    EXPECT_EQ(limit->colNames(), newLimit->colNames());
+
+    auto* newScan = scanOf(result.newGroupNodes.front());
+    // The rows skipped by the offset are scanned too
+    EXPECT_EQ(5, newScan->limit());
+    EXPECT_EQ(scan_->outputVar(), newScan->outputVar());
+    EXPECT_EQ(std::vector<std::string>({"VertexID", "player.age", "player.name"}),
+              newScan->colNames());
+    EXPECT_EQ(newScan->outputVar(), newLimit->inputVar());
+}
+
+TEST_F(PushDownIndexScanRuleTest, LimitNotPushed) {
+    {
+        // Scanned fewer already
+        scan_->setLimit(3);
+        auto* limit = Limit::make(qctx_.get(), scan_, 0, 10);
+        auto result = transform("PushLimitDownIndexScanRule", limit);
+        EXPECT_TRUE(result.newGroupNodes.empty());
+    }
+    {
+        // All the scanned rows are read by another one
+        scan_ = makeScan();
+        auto* limit = Limit::make(qctx_.get(), scan_, 0, 10);
+        Limit::make(qctx_.get(), scan_, 0, 100);
+        auto result = transform("PushLimitDownIndexScanRule", limit);
+        EXPECT_TRUE(result.newGroupNodes.empty());
+    }
+}
+
+TEST_F(PushDownIndexScanRuleTest, TopN) {
+    auto* topn = TopN::make(qctx_.get(), scan_, {{2, OrderFactor::OrderType::DESCEND}}, 1, 4);
+    topn->setColNames({"VertexID", "player.age", "player.name"});
+    auto result = transform("PushTopNDownIndexScanRule", topn);
+    ASSERT_TRUE(result.eraseAll);
+    ASSERT_EQ(1, result.newGroupNodes.size());
+
+    // The TopN is kept over the partitions scanned
+    auto* newTopN = result.newGroupNodes.front()->node();
+    ASSERT_EQ(PlanNode::Kind::kTopN, newTopN->kind());
+    EXPECT_EQ(topn->outputVar(), newTopN->outputVar());
+    EXPECT_EQ(topn->colNames(), newTopN->colNames());
+
+    auto* newScan = scanOf(result.newGroupNodes.front());
+    EXPECT_EQ(5, newScan->limit());
+    EXPECT_EQ(topn->factors(), newScan->sortFactors());
+    EXPECT_EQ(std::vector<std::string>({"VertexID", "player.age", "player.name"}),
+              newScan->colNames());
+}
+
+TEST_F(PushDownIndexScanRuleTest, Sort) {
+    std::vector<std::pair<size_t, OrderFactor::OrderType>> factors = {
+        {1, OrderFactor::OrderType::ASCEND}};
+    auto* sort = Sort::make(qctx_.get(), scan_, factors);
+    sort->setColNames({"VertexID", "player.age", "player.name"});
+    auto result = transform("PushSortDownIndexScanRule", sort);
+    ASSERT_TRUE(result.eraseAll);
+    ASSERT_EQ(1, result.newGroupNodes.size());
+
+    // Replaced by the scan merging the partitions in the order
+    auto* newScan = result.newGroupNodes.front()->node();
+    ASSERT_EQ(PlanNode::Kind::kIndexScan, newScan->kind());
+    EXPECT_EQ(sort->outputVar(), newScan->outputVar());
+    EXPECT_EQ(sort->colNames(), newScan->colNames());
+    EXPECT_EQ(factors, static_cast<const IndexScan*>(newScan)->sortFactors());
+}
+
+TEST_F(PushDownIndexScanRuleTest, SortNotPushed) {
+    {
+        // Not a prefix of the index
+        auto* sort = Sort::make(qctx_.get(), scan_, {{2, OrderFactor::OrderType::ASCEND}});
+        auto result = transform("PushSortDownIndexScanRule", sort);
+        EXPECT_TRUE(result.newGroupNodes.empty());
+    }
+    {
+        // Against the order of the index
+        scan_ = makeScan();
+        auto* sort = Sort::make(qctx_.get(), scan_, {{1, OrderFactor::OrderType::DESCEND}});
+        auto result = transform("PushSortDownIndexScanRule", sort);
+        EXPECT_TRUE(result.newGroupNodes.empty());
+    }
+    {
+        // Longer than the index
+        scan_ = makeScan();
+        auto* sort = Sort::make(qctx_.get(),
+                                scan_,
+                                {{1, OrderFactor::OrderType::ASCEND},
+                                 {2, OrderFactor::OrderType::ASCEND},
+                                 {0, OrderFactor::OrderType::ASCEND}});
+        auto result = transform("PushSortDownIndexScanRule", sort);
+        EXPECT_TRUE(result.newGroupNodes.empty());
+    }
+}
+
+}   // namespace opt
+}   // namespace nebula
@@ -0,0 +1,266 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/expression/ConstantExpression.h"
+#include "common/expression/LogicalExpression.h"
+#include "common/expression/PropertyExpression.h"
+#include "common/expression/RelationalExpression.h"
+#include "common/expression/UnaryExpression.h"
+#include "context/QueryContext.h"
+#include "optimizer/OptGroup.h"
+#include "optimizer/OptRule.h"
+#include "optimizer/test/OptRuleTestUtils.h"
+#include "planner/Query.h"
+
+using nebula::graph::Explore;
+using nebula::graph::Filter;
+using nebula::graph::GetEdges;
+using nebula::graph::GetNeighbors;
+using nebula::graph::GetVertices;
+using nebula::graph::PlanNode;
+using nebula::graph::QueryContext;
+
+namespace nebula {
+namespace opt {
+
+class PushFilterDownRuleTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        qctx_ = std::make_unique<QueryContext>();
+    }
+
+    // Transform the filter over the explore node, an empty result if it's not transformed
+    OptRule::TransformResult transform(const std::string& name, Filter* filter) {
+        return OptRuleTestUtils::transform(qctx_.get(), name, filter, explore_);
+    }
+
+    Filter* makeFilter(PlanNode* input, Expression* condition) {
+        explore_ = input;
+        auto* filter = Filter::make(qctx_.get(), input, qctx_->objPool()->add(condition));
+        filter->setColNames(input->colNames());
+        return filter;
+    }
+
+    GetVertices* makeGetVertices() {
+        auto* gv = GetVertices::make(qctx_.get(), nullptr, 1, nullptr, {}, {});
+        gv->setColNames({"_vid", "player.age"});
+        return gv;
+    }
+
+    GetEdges* makeGetEdges() {
+        auto* ge = GetEdges::make(
+            qctx_.get(), nullptr, 1, nullptr, nullptr, nullptr, nullptr, {}, {});
+        ge->setColNames({"like._src", "like._type", "like._rank", "like._dst"});
+        return ge;
+    }
+
+    GetNeighbors* makeGetNeighbors() {
+        auto* gn = GetNeighbors::make(qctx_.get(), nullptr, 1);
+        gn->setSrc(qctx_->objPool()->add(inputProp("_vid")));
+        gn->setColNames({"_vid", "_stats", "_tag:player:age", "_edge:+like:likeness"});
+        return gn;
+    }
+
+    static Expression* tagProp(const std::string& tag, const std::string& prop) {
+        return new TagPropertyExpression(new std::string(tag), new std::string(prop));
+    }
+
+    static Expression* edgeProp(const std::string& edge, const std::string& prop) {
+        return new EdgePropertyExpression(new std::string(edge), new std::string(prop));
+    }
+
+    static Expression* srcProp(const std::string& tag, const std::string& prop) {
+        return new SourcePropertyExpression(new std::string(tag), new std::string(prop));
+    }
+
+    static Expression* inputProp(const std::string& prop) {
+        return new InputPropertyExpression(new std::string(prop));
+    }
+
+    static Expression* gtExpr(Expression* lhs, int64_t value) {
+        return new RelationalExpression(
+            Expression::Kind::kRelGT, lhs, new ConstantExpression(value));
+    }
+
+    static Expression* andExpr(Expression* lhs, Expression* rhs) {
+        return new LogicalExpression(Expression::Kind::kLogicalAnd, lhs, rhs);
+    }
+
+    static const Explore* exploreOf(const OptGroupNode* groupNode) {
+        CHECK_EQ(1, groupNode->dependencies().size());
+        return static_cast<const Explore*>(
+            groupNode->dependencies().front()->groupNodes().front()->node());
+    }
+
+    static void checkFilter(const Explore* explore, const Expression* expected) {
+        ASSERT_FALSE(explore->filter().empty());
+        auto filter = Expression::decode(explore->filter());
+        EXPECT_EQ(*expected, *filter) << filter->toString() << " vs. " << expected->toString();
+    }
+
+    std::unique_ptr<QueryContext> qctx_;
+    // The input of the last filter made
+    PlanNode* explore_{nullptr};
+};
+
+TEST_F(PushFilterDownRuleTest, GetVerticesPushed) {
+    auto* gv = makeGetVertices();
+    // player.age > 30
+    auto* filter = makeFilter(gv, gtExpr(tagProp("player", "age"), 30));
+    auto result = transform("PushFilterDownGetVerticesRule", filter);
+    ASSERT_TRUE(result.eraseCurr);
+    ASSERT_EQ(1, result.newGroupNodes.size());
+
+    // Replaced by the GetVertices evaluating the whole filter
+    auto* newGV = static_cast<const Explore*>(result.newGroupNodes.front()->node());
+    ASSERT_EQ(PlanNode::Kind::kGetVertices, newGV->kind());
+    EXPECT_EQ(filter->outputVar(), newGV->outputVar());
+    EXPECT_EQ(filter->colNames(), newGV->colNames());
+    std::unique_ptr<Expression> expected(gtExpr(tagProp("player", "age"), 30));
+    checkFilter(newGV, expected.get());
+    // The node matched is kept unchanged
+    EXPECT_TRUE(gv->filter().empty());
+}
+
+TEST_F(PushFilterDownRuleTest, GetVerticesPartlyPushed) {
+    auto* gv = makeGetVertices();
+    // player.age > 30 AND $-.score > 60
+    auto* filter = makeFilter(
+        gv, andExpr(gtExpr(tagProp("player", "age"), 30), gtExpr(inputProp("score"), 60)));
+    auto result = transform("PushFilterDownGetVerticesRule", filter);
+    ASSERT_TRUE(result.eraseCurr);
+    ASSERT_EQ(1, result.newGroupNodes.size());
+
+    // The part the storage couldn't evaluate is left in the filter
+    auto* newFilter = static_cast<const Filter*>(result.newGroupNodes.front()->node());
+    ASSERT_EQ(PlanNode::Kind::kFilter, newFilter->kind());
+    EXPECT_EQ(filter->outputVar(), newFilter->outputVar());
+    std::unique_ptr<Expression> remained(gtExpr(inputProp("score"), 60));
+    EXPECT_EQ(*remained, *newFilter->condition());
+
+    auto* newGV = exploreOf(result.newGroupNodes.front());
+    ASSERT_EQ(PlanNode::Kind::kGetVertices, newGV->kind());
+    EXPECT_EQ(newGV->outputVar(), newFilter->inputVar());
+    std::unique_ptr<Expression> pushed(
+        andExpr(gtExpr(tagProp("player", "age"), 30), new ConstantExpression(true)));
+    checkFilter(newGV, pushed.get());
+}
+
+TEST_F(PushFilterDownRuleTest, GetVerticesNotPushed) {
+    {
+        // $-.score > 60
+        auto* filter = makeFilter(makeGetVertices(), gtExpr(inputProp("score"), 60));
+        auto result = transform("PushFilterDownGetVerticesRule", filter);
+        EXPECT_TRUE(result.newGroupNodes.empty());
+    }
+    {
+        // The edge props aren't read by the GetVertices
+        auto* filter = makeFilter(makeGetVertices(), gtExpr(edgeProp("like", "likeness"), 90));
+        auto result = transform("PushFilterDownGetVerticesRule", filter);
+        EXPECT_TRUE(result.newGroupNodes.empty());
+    }
+    {
+        // A conjunction under NOT couldn't be split
+        auto* filter = makeFilter(
+            makeGetVertices(),
+            new UnaryExpression(
+                Expression::Kind::kUnaryNot,
+                andExpr(gtExpr(tagProp("player", "age"), 30), gtExpr(inputProp("score"), 60))));
+        auto result = transform("PushFilterDownGetVerticesRule", filter);
+        EXPECT_TRUE(result.newGroupNodes.empty());
+    }
+}
+
+TEST_F(PushFilterDownRuleTest, GetEdgesPushed) {
+    auto* ge = makeGetEdges();
+    ge->setFilter(std::unique_ptr<Expression>(gtExpr(edgeProp("like", "likeness"), 90))->encode());
+    // like.start > 2000
+    auto* filter = makeFilter(ge, gtExpr(edgeProp("like", "start"), 2000));
+    auto result = transform("PushFilterDownGetEdgesRule", filter);
+    ASSERT_TRUE(result.eraseCurr);
+    ASSERT_EQ(1, result.newGroupNodes.size());
+
+    // Combined with the filter of the GetEdges
+    auto* newGE = static_cast<const Explore*>(result.newGroupNodes.front()->node());
+    ASSERT_EQ(PlanNode::Kind::kGetEdges, newGE->kind());
+    EXPECT_EQ(filter->outputVar(), newGE->outputVar());
+    EXPECT_EQ(filter->colNames(), newGE->colNames());
+    std::unique_ptr<Expression> expected(andExpr(gtExpr(edgeProp("like", "start"), 2000),
+                                                 gtExpr(edgeProp("like", "likeness"), 90)));
+    checkFilter(newGE, expected.get());
+}
+
+TEST_F(PushFilterDownRuleTest, GetEdgesPartlyPushed) {
+    auto* ge = makeGetEdges();
+    // player.age > 30 AND like.likeness > 90
+    auto* filter = makeFilter(ge,
+                              andExpr(gtExpr(tagProp("player", "age"), 30),
+                                      gtExpr(edgeProp("like", "likeness"), 90)));
+    auto result = transform("PushFilterDownGetEdgesRule", filter);
+    ASSERT_EQ(1, result.newGroupNodes.size());
+
+    auto* newFilter = static_cast<const Filter*>(result.newGroupNodes.front()->node());
+    ASSERT_EQ(PlanNode::Kind::kFilter, newFilter->kind());
+    std::unique_ptr<Expression> remained(gtExpr(tagProp("player", "age"), 30));
+    EXPECT_EQ(*remained, *newFilter->condition());
+
+    auto* newGE = exploreOf(result.newGroupNodes.front());
+    ASSERT_EQ(PlanNode::Kind::kGetEdges, newGE->kind());
+    std::unique_ptr<Expression> pushed(
+        andExpr(new ConstantExpression(true), gtExpr(edgeProp("like", "likeness"), 90)));
+    checkFilter(newGE, pushed.get());
+}
+
+TEST_F(PushFilterDownRuleTest, GetEdgesNotPushed) {
+    // The tag props aren't read by the GetEdges
+    auto* filter = makeFilter(makeGetEdges(), gtExpr(tagProp("player", "age"), 30));
+    auto result = transform("PushFilterDownGetEdgesRule", filter);
+    EXPECT_TRUE(result.newGroupNodes.empty());
+}
+
+TEST_F(PushFilterDownRuleTest, GetNeighbors) {
+    {
+        // $^.player.age > 30 AND like.likeness > 90
+        auto* filter = makeFilter(makeGetNeighbors(),
+                                  andExpr(gtExpr(srcProp("player", "age"), 30),
+                                          gtExpr(edgeProp("like", "likeness"), 90)));
+        auto result = transform("PushFilterDownGetNbrsRule", filter);
+        ASSERT_EQ(1, result.newGroupNodes.size());
+        auto* newGN = static_cast<const Explore*>(result.newGroupNodes.front()->node());
+        ASSERT_EQ(PlanNode::Kind::kGetNeighbors, newGN->kind());
+        EXPECT_EQ(filter->outputVar(), newGN->outputVar());
+        EXPECT_EQ(filter->colNames(), newGN->colNames());
+        checkFilter(newGN, filter->condition());
+    }
+    {
+        // $-.score > 60 AND like.likeness > 90
+        auto* filter = makeFilter(
+            makeGetNeighbors(),
+            andExpr(gtExpr(inputProp("score"), 60), gtExpr(edgeProp("like", "likeness"), 90)));
+        auto result = transform("PushFilterDownGetNbrsRule", filter);
+        ASSERT_EQ(1, result.newGroupNodes.size());
+        auto* newFilter = static_cast<const Filter*>(result.newGroupNodes.front()->node());
+        ASSERT_EQ(PlanNode::Kind::kFilter, newFilter->kind());
+        std::unique_ptr<Expression> remained(gtExpr(inputProp("score"), 60));
+        EXPECT_EQ(*remained, *newFilter->condition());
+        ASSERT_EQ(PlanNode::Kind::kGetNeighbors,
+                  exploreOf(result.newGroupNodes.front())->kind());
+    }
+    {
+        // The props of the dst vertex aren't read by the GetNeighbors
+        auto* filter = makeFilter(
+            makeGetNeighbors(),
+            gtExpr(new DestPropertyExpression(new std::string("player"), new std::string("age")),
+                   30));
+        auto result = transform("PushFilterDownGetNbrsRule", filter);
+        EXPECT_TRUE(result.newGroupNodes.empty());
+    }
+}
+
+}   // namespace opt
+}   // namespace nebula
@@ -45,6 +45,10 @@ std::string ShowCollationSentence::toString() const {
     return std::string("SHOW COLLATION");
 }
 
+std::string ShowQueriesSentence::toString() const {
+    return isSlow_ ? std::string("SHOW SLOW QUERIES") : std::string("SHOW QUERIES");
+}
+
 std::string SpaceOptItem::toString() const {
     switch (optType_) {
         case PARTITION_NUM:
@@ -117,6 +117,23 @@ public:
     std::string toString() const override;
 };
 
+class ShowQueriesSentence final : public Sentence {
+public:
+    explicit ShowQueriesSentence(bool isSlow = false) {
+        kind_ = Kind::kShowQueries;
+        isSlow_ = isSlow;
+    }
+
+    std::string toString() const override;
+
+    bool isSlow() const {
+        return isSlow_;
+    }
+
+private:
+    bool isSlow_{false};
+};
+
 class SpaceOptItem final {
 public:
     using Value = boost::variant<int64_t, std::string, meta::cpp2::ColumnTypeDef>;
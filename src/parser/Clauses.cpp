@@ -20,6 +20,9 @@ std::string StepClause::toString() const {
     } else {
         buf += std::to_string(steps_);
     }
+    if (distinct_) {
+        buf += " DISTINCT";
+    }
     buf += " STEPS";
     return buf;
 }
@@ -40,11 +40,21 @@ public:
         return mToN_ != nullptr;
     }
 
+    // Expand each vertex at most once through all the steps
+    bool isDistinct() const {
+        return distinct_;
+    }
+
+    void setDistinct() {
+        distinct_ = true;
+    }
+
     std::string toString() const;
 
 private:
     uint32_t                                    steps_{1};
     std::unique_ptr<MToN>                       mToN_;
+    bool                                        distinct_{false};
 };
 
 
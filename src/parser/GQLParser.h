@@ -13,6 +13,10 @@
 
 namespace nebula {
 
+/**
+ * GQLParser is reentrant, so it's cheaper to reuse one of each thread than
+ * to make a new one for each query, see `threadLocal()'.
+ */
 class GQLParser {
 public:
     GQLParser() : parser_(scanner_, error_, &sentences_) {
@@ -37,13 +41,18 @@ public:
         if (sentences_ != nullptr) delete sentences_;
     }
 
-    StatusOr<std::unique_ptr<Sentence>> parse(std::string query) {
-        // Since GraphScanner needs a writable buffer, we have to copy the query string
-        buffer_ = std::move(query);
-        pos_ = &buffer_[0];
-        end_ = pos_ + buffer_.size();
+    static GQLParser& threadLocal() {
+        static thread_local GQLParser parser;
+        return parser;
+    }
+
+    // The scanner reads the query in place, which must live until it returns
+    StatusOr<std::unique_ptr<Sentence>> parse(const std::string &query) {
+        pos_ = query.data();
+        end_ = pos_ + query.size();
 
-        scanner_.setQuery(&buffer_);
+        scanner_.setQuery(&query);
+        scanner_.setUnaryMinus(false);
         if (parser_.parse() != 0) {
             pos_ = nullptr;
             end_ = nullptr;
@@ -58,6 +67,7 @@ public:
         }
 
         if (sentences_ == nullptr) {
+            scanner_.setQuery(nullptr);
             return Status::StatementEmpty();
         }
         auto *sentences = sentences_;
@@ -67,7 +77,6 @@ public:
     }
 
 private:
-    std::string                     buffer_;
     const char                     *pos_{nullptr};
     const char                     *end_{nullptr};
     nebula::GraphScanner            scanner_;
@@ -41,13 +41,16 @@ public:
     // This makes the scanner reentrant.
     void flushBuffer() {
         yy_flush_buffer(yy_buffer_stack ? yy_buffer_stack[yy_buffer_stack_top] : nullptr);
+        // It may fail in a string or a comment, so back to the INITIAL start condition
+        yy_start = 1;
+        hasUnaryMinus_ = false;
     }
 
-    void setQuery(std::string *query) {
+    void setQuery(const std::string *query) {
         query_ = query;
     }
 
-    std::string* query() {
+    const std::string* query() const {
         return query_;
     }
 
@@ -172,7 +175,7 @@ private:
     size_t                              sbufSize_{0};
     size_t                              sbufPos_{0};
     std::function<int(char*, int)>      readBuffer_;
-    std::string*                        query_{nullptr};
+    const std::string*                  query_{nullptr};
 };
 
 }   // namespace nebula
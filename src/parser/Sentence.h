@@ -71,6 +71,7 @@ public:
         kShowSnapshots,
         kShowCharset,
         kShowCollation,
+        kShowQueries,
         kDeleteVertices,
         kDeleteEdges,
         kLookup,
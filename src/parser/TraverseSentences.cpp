@@ -193,6 +193,11 @@ std::string FindPathSentence::toString() const {
         buf += over_->toString();
         buf += " ";
     }
+    if (weight_ != nullptr) {
+        buf += "WEIGHT ";
+        buf += *weight_;
+        buf += " ";
+    }
     if (step_ != nullptr) {
         buf += step_->toString();
         buf += " ";
@@ -148,11 +148,11 @@ public:
 
     std::string toString() const override;
 
-    auto left() {
+    Sentence* left() const {
         return left_.get();
     }
 
-    auto right() {
+    Sentence* right() const {
         return right_.get();
     }
 
@@ -454,6 +454,10 @@ public:
         where_.reset(clause);
     }
 
+    void setWeight(std::string *weight) {
+        weight_.reset(weight);
+    }
+
     FromClause* from() const {
         return from_.get();
     }
@@ -478,6 +482,11 @@ public:
         return isShortest_;
     }
 
+    // The edge property as the cost of the edges, nullptr if unweighted
+    const std::string* weight() const {
+        return weight_.get();
+    }
+
     std::string toString() const override;
 
 private:
@@ -485,6 +494,7 @@ private:
     std::unique_ptr<FromClause>     from_;
     std::unique_ptr<ToClause>       to_;
     std::unique_ptr<OverClause>     over_;
+    std::unique_ptr<std::string>    weight_;
     std::unique_ptr<StepClause>     step_;
     std::unique_ptr<WhereClause>    where_;
 };
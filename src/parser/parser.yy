@@ -141,7 +141,7 @@ static constexpr size_t MAX_ABS_INTEGER = 9223372036854775808ULL;
 %token KW_ORDER KW_ASC KW_LIMIT KW_OFFSET KW_GROUP
 %token KW_DISTINCT KW_ALL KW_OF
 %token KW_BALANCE KW_LEADER
-%token KW_SHORTEST KW_PATH
+%token KW_SHORTEST KW_PATH KW_WEIGHT
 %token KW_IS KW_NULL KW_DEFAULT
 %token KW_SNAPSHOT KW_SNAPSHOTS KW_LOOKUP
 %token KW_JOBS KW_JOB KW_RECOVER KW_FLUSH KW_COMPACT KW_REBUILD KW_SUBMIT
@@ -154,6 +154,7 @@ static constexpr size_t MAX_ABS_INTEGER = 9223372036854775808ULL;
 %token KW_CONTAINS
 %token KW_STARTS KW_ENDS
 %token KW_UNWIND KW_SKIP KW_OPTIONAL
+%token KW_QUERIES KW_SLOW
 
 /* symbols */
 %token L_PAREN R_PAREN L_BRACKET R_BRACKET L_BRACE R_BRACE COMMA
@@ -177,6 +178,7 @@ static constexpr size_t MAX_ABS_INTEGER = 9223372036854775808ULL;
 %type <expr> var_prop_expression
 %type <expr> vid_ref_expression
 %type <expr> vid
+%type <expr> param_vid
 %type <expr> function_call_expression
 %type <expr> uuid_expression
 %type <expr> list_expression
@@ -191,6 +193,7 @@ static constexpr size_t MAX_ABS_INTEGER = 9223372036854775808ULL;
 %type <step_clause> step_clause
 %type <from_clause> from_clause
 %type <vid_list> vid_list
+%type <vid_list> param_vid_list
 %type <over_edge> over_edge
 %type <over_edges> over_edges
 %type <over_clause> over_clause
@@ -245,6 +248,7 @@ static constexpr size_t MAX_ABS_INTEGER = 9223372036854775808ULL;
 %type <expr> match_skip
 %type <expr> match_limit
 %type <strval> match_alias
+%type <strval> find_path_weight_clause
 %type <match_edge_type_list> match_edge_type_list
 %type <match_edge_type_list> opt_match_edge_type_list
 %type <reading_clause> unwind_clause with_clause match_clause reading_clause
@@ -384,6 +388,7 @@ unreserved_keyword
     | KW_STORAGE            { $$ = new std::string("storage"); }
     | KW_ALL                { $$ = new std::string("all"); }
     | KW_SHORTEST           { $$ = new std::string("shortest"); }
+    | KW_WEIGHT             { $$ = new std::string("weight"); }
     | KW_COUNT_DISTINCT     { $$ = new std::string("count_distinct"); }
     | KW_CONTAINS           { $$ = new std::string("contains"); }
     | KW_STARTS             { $$ = new std::string("starts"); }
@@ -398,6 +403,8 @@ unreserved_keyword
     | KW_BOTH               { $$ = new std::string("both"); }
     | KW_OUT                { $$ = new std::string("out"); }
     | KW_SUBGRAPH           { $$ = new std::string("subgraph"); }
+    | KW_QUERIES            { $$ = new std::string("queries"); }
+    | KW_SLOW               { $$ = new std::string("slow"); }
     ;
 
 agg_function
@@ -806,10 +813,18 @@ step_clause
     | legal_integer KW_TO legal_integer KW_STEPS {
         $$ = new StepClause($1, $3);
     }
+    | legal_integer KW_DISTINCT KW_STEPS {
+        $$ = new StepClause($1);
+        $$->setDistinct();
+    }
+    | legal_integer KW_TO legal_integer KW_DISTINCT KW_STEPS {
+        $$ = new StepClause($1, $3);
+        $$->setDistinct();
+    }
     ;
 
 from_clause
-    : KW_FROM vid_list {
+    : KW_FROM param_vid_list {
         $$ = new FromClause($2);
     }
     | KW_FROM vid_ref_expression {
@@ -828,6 +843,27 @@ vid_list
     }
     ;
 
+param_vid_list
+    : param_vid {
+        $$ = new VertexIDList();
+        $$->add($1);
+    }
+    | param_vid_list COMMA param_vid {
+        $$ = $1;
+        $$->add($3);
+    }
+    ;
+
+param_vid
+    : vid {
+        $$ = $1;
+    }
+    | VARIABLE {
+        // Bound by the prepared statements
+        $$ = new VariableExpression($1);
+    }
+    ;
+
 vid
     : function_call_expression {
         $$ = $1;
@@ -1259,13 +1295,13 @@ order_by_sentence
     ;
 
 fetch_vertices_sentence
-    : KW_FETCH KW_PROP KW_ON name_label vid_list yield_clause {
+    : KW_FETCH KW_PROP KW_ON name_label param_vid_list yield_clause {
         $$ = new FetchVerticesSentence($4, $5, $6);
     }
     | KW_FETCH KW_PROP KW_ON name_label vid_ref_expression yield_clause {
         $$ = new FetchVerticesSentence($4, $5, $6);
     }
-    | KW_FETCH KW_PROP KW_ON STAR vid_list yield_clause {
+    | KW_FETCH KW_PROP KW_ON STAR param_vid_list yield_clause {
         $$ = new FetchVerticesSentence($5, $6);
     }
     | KW_FETCH KW_PROP KW_ON STAR vid_ref_expression yield_clause {
@@ -1339,18 +1375,25 @@ find_path_sentence
         /* s->setWhere($8); */
         $$ = s;
     }
-    | KW_FIND KW_SHORTEST KW_PATH from_clause to_clause over_clause find_path_upto_clause
+    | KW_FIND KW_SHORTEST KW_PATH from_clause to_clause over_clause find_path_weight_clause
+      find_path_upto_clause
     /* where_clause */ {
         auto *s = new FindPathSentence(true);
         s->setFrom($4);
         s->setTo($5);
         s->setOver($6);
-        s->setStep($7);
-        /* s->setWhere($8); */
+        s->setWeight($7);
+        s->setStep($8);
+        /* s->setWhere($9); */
         $$ = s;
     }
     ;
 
+find_path_weight_clause
+    : %empty { $$ = nullptr; }
+    | KW_WEIGHT name_label { $$ = $2; }
+    ;
+
 find_path_upto_clause
     : %empty { $$ = new StepClause(5); }
     | KW_UPTO legal_integer KW_STEPS {
@@ -2118,6 +2161,12 @@ show_sentence
     | KW_SHOW KW_COLLATION {
         $$ = new ShowCollationSentence();
     }
+    | KW_SHOW KW_QUERIES {
+        $$ = new ShowQueriesSentence();
+    }
+    | KW_SHOW KW_SLOW KW_QUERIES {
+        $$ = new ShowQueriesSentence(true);
+    }
     ;
 
 config_module_enum
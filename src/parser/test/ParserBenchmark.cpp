@@ -16,6 +16,19 @@ auto complexQuery =  "GO 2 STEPS FROM 123456789 OVER myedge "
                      "alias.prop5 == alias.prop6 YIELD 1 AS first, 2 AS second";
 
 
+std::string makeBulkInsert(size_t rows) {
+    std::string query = "INSERT VERTEX person(name, age, city) VALUES ";
+    for (auto i = 0UL; i < rows; i++) {
+        if (i > 0) {
+            query += ", ";
+        }
+        query += folly::stringPrintf("\"vid_%lu\":(\"name_%lu\", %lu, \"city\")", i, i, i % 100);
+    }
+    return query;
+}
+
+auto bulkInsertQuery = makeBulkInsert(10000);
+
 size_t SimpleQuery(size_t iters, size_t nrThreads) {
     constexpr size_t ops = 500000UL;
 
@@ -64,6 +77,52 @@ size_t ComplexQuery(size_t iters, size_t nrThreads) {
     return iters * ops;
 }
 
+// Reuse the parser of each thread, as the query engine does
+size_t ThreadLocalQuery(size_t iters, size_t nrThreads) {
+    constexpr size_t ops = 500000UL;
+
+    auto parse = [&] () {
+        auto n = iters * ops;
+        for (auto i = 0UL; i < n; i++) {
+            auto result = GQLParser::threadLocal().parse(complexQuery);
+            folly::doNotOptimizeAway(result);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (auto i = 0u; i < nrThreads; i++) {
+        workers.emplace_back(parse);
+    }
+    for (auto i = 0u; i < nrThreads; i++) {
+        workers[i].join();
+    }
+
+    return iters * ops;
+}
+
+// Throughput in rows of a large INSERT
+size_t BulkInsert(size_t iters, size_t nrThreads) {
+    constexpr size_t ops = 10UL;
+
+    auto parse = [&] () {
+        auto n = iters * ops;
+        for (auto i = 0UL; i < n; i++) {
+            auto result = GQLParser::threadLocal().parse(bulkInsertQuery);
+            folly::doNotOptimizeAway(result);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (auto i = 0u; i < nrThreads; i++) {
+        workers.emplace_back(parse);
+    }
+    for (auto i = 0u; i < nrThreads; i++) {
+        workers[i].join();
+    }
+
+    return iters * ops * 10000UL;
+}
+
 BENCHMARK_NAMED_PARAM_MULTI(SimpleQuery, 1_thread, 1)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(SimpleQuery, 2_thread, 2)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(SimpleQuery, 4_thread, 4)
@@ -82,6 +141,21 @@ BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(ComplexQuery, 16_thread, 16)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(ComplexQuery, 32_thread, 32)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(ComplexQuery, 48_thread, 48)
 
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK_NAMED_PARAM_MULTI(ThreadLocalQuery, 1_thread, 1)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(ThreadLocalQuery, 2_thread, 2)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(ThreadLocalQuery, 4_thread, 4)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(ThreadLocalQuery, 8_thread, 8)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(ThreadLocalQuery, 16_thread, 16)
+
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK_NAMED_PARAM_MULTI(BulkInsert, 1_thread, 1)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(BulkInsert, 2_thread, 2)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(BulkInsert, 4_thread, 4)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(BulkInsert, 8_thread, 8)
+
 int
 main(int argc, char **argv) {
     gflags::ParseCommandLineFlags(&argc, &argv, true);
@@ -95,6 +169,10 @@ main(int argc, char **argv) {
         auto result = parser.parse(complexQuery);
         CHECK(result.ok()) << result.status();
     }
+    {
+        auto result = GQLParser::threadLocal().parse(bulkInsertQuery);
+        CHECK(result.ok()) << result.status();
+    }
 
     folly::runBenchmarks();
     return 0;
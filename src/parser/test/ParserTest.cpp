@@ -59,6 +59,12 @@ TEST(Parser, Go) {
         auto result = parser.parse(query);
         ASSERT_TRUE(result.ok()) << result.status();
     }
+    {
+        GQLParser parser;
+        std::string query = "GO FROM $id, \"1\" OVER friend";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
     {
         GQLParser parser;
         std::string query = "GO FROM \"1\" OVER friend;";
@@ -71,6 +77,18 @@ TEST(Parser, Go) {
         auto result = parser.parse(query);
         ASSERT_TRUE(result.ok()) << result.status();
     }
+    {
+        GQLParser parser;
+        std::string query = "GO 3 DISTINCT STEPS FROM \"1\" OVER friend";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
+    {
+        GQLParser parser;
+        std::string query = "GO 1 TO 3 DISTINCT STEPS FROM \"1\" OVER friend";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
     {
         GQLParser parser;
         std::string query = "GO FROM \"1\" OVER friend";
@@ -1041,6 +1059,12 @@ TEST(Parser, FetchVertex) {
         auto result = parser.parse(query);
         ASSERT_TRUE(result.ok()) << result.status();
     }
+    {
+        GQLParser parser;
+        std::string query = "FETCH PROP ON person $id";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
     {
         GQLParser parser;
         std::string query = "FETCH PROP ON person \"Tom\"";
@@ -1361,6 +1385,20 @@ TEST(Parser, AdminOperation) {
         auto result = parser.parse(query);
         ASSERT_TRUE(result.ok()) << result.status();
     }
+    {
+        GQLParser parser;
+        std::string query = "SHOW QUERIES";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+        ASSERT_EQ(result.value()->toString(), query);
+    }
+    {
+        GQLParser parser;
+        std::string query = "SHOW SLOW QUERIES";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+        ASSERT_EQ(result.value()->toString(), query);
+    }
 }
 
 TEST(Parser, UserOperation) {
@@ -1858,6 +1896,19 @@ TEST(Parser, FindPath) {
         auto result = parser.parse(query);
         ASSERT_TRUE(result.ok()) << result.status();
     }
+    {
+        GQLParser parser;
+        std::string query = "FIND SHORTEST PATH FROM \"1\" TO \"2\" OVER like WEIGHT likeness "
+                            "UPTO 3 STEPS";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
+    {
+        GQLParser parser;
+        std::string query = "FIND ALL PATH FROM \"1\" TO \"2\" OVER like WEIGHT likeness";
+        auto result = parser.parse(query);
+        ASSERT_FALSE(result.ok());
+    }
 }
 
 TEST(Parser, Limit) {
@@ -2514,4 +2565,33 @@ TEST(Parser, Match) {
     }
 }
 
+TEST(Parser, Reuse) {
+    GQLParser parser;
+    {
+        std::string query = "GO FROM \"1\" OVER friend";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
+    {
+        // Fail in a string
+        auto result = parser.parse("GO FROM \"1 OVER friend");
+        ASSERT_FALSE(result.ok());
+    }
+    {
+        // Fail in a comment
+        auto result = parser.parse("GO FROM \"1\" OVER friend /* comment");
+        ASSERT_FALSE(result.ok());
+    }
+    {
+        auto result = parser.parse("");
+        ASSERT_FALSE(result.ok());
+    }
+    {
+        std::string query = "GO FROM \"2\" OVER friend";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+        ASSERT_NE(std::string::npos, result.value()->toString().find("\"2\""));
+    }
+}
+
 }   // namespace nebula
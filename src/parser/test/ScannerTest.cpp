@@ -408,6 +408,9 @@ TEST(Scanner, Basic) {
         CHECK_SEMANTIC_TYPE("SHORTEST", TokenType::KW_SHORTEST),
         CHECK_SEMANTIC_TYPE("Shortest", TokenType::KW_SHORTEST),
         CHECK_SEMANTIC_TYPE("shortest", TokenType::KW_SHORTEST),
+        CHECK_SEMANTIC_TYPE("WEIGHT", TokenType::KW_WEIGHT),
+        CHECK_SEMANTIC_TYPE("Weight", TokenType::KW_WEIGHT),
+        CHECK_SEMANTIC_TYPE("weight", TokenType::KW_WEIGHT),
         CHECK_SEMANTIC_TYPE("SUBGRAPH", TokenType::KW_SUBGRAPH),
         CHECK_SEMANTIC_TYPE("Subgraph", TokenType::KW_SUBGRAPH),
         CHECK_SEMANTIC_TYPE("subgraph", TokenType::KW_SUBGRAPH),
@@ -447,6 +450,10 @@ TEST(Scanner, Basic) {
         CHECK_SEMANTIC_TYPE("skip", TokenType::KW_SKIP),
         CHECK_SEMANTIC_TYPE("OPTIONAL", TokenType::KW_OPTIONAL),
         CHECK_SEMANTIC_TYPE("optional", TokenType::KW_OPTIONAL),
+        CHECK_SEMANTIC_TYPE("QUERIES", TokenType::KW_QUERIES),
+        CHECK_SEMANTIC_TYPE("queries", TokenType::KW_QUERIES),
+        CHECK_SEMANTIC_TYPE("SLOW", TokenType::KW_SLOW),
+        CHECK_SEMANTIC_TYPE("slow", TokenType::KW_SLOW),
 
         CHECK_SEMANTIC_TYPE("_type", TokenType::TYPE_PROP),
         CHECK_SEMANTIC_TYPE("_id", TokenType::ID_PROP),
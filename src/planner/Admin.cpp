@@ -161,5 +161,11 @@ std::unique_ptr<cpp2::PlanNodeDescription> ShowBalance::explain() const {
     return desc;
 }
 
+std::unique_ptr<cpp2::PlanNodeDescription> ShowQueries::explain() const {
+    auto desc = SingleInputNode::explain();
+    addDescription("isSlow", util::toJson(isSlow_), desc.get());
+    return desc;
+}
+
 }   // namespace graph
 }   // namespace nebula
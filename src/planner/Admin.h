@@ -778,6 +778,25 @@ private:
     explicit ShowCollation(QueryContext* qctx, PlanNode* input)
         : SingleInputNode(qctx, Kind::kShowCollation, input) {}
 };
+
+class ShowQueries final : public SingleInputNode {
+public:
+    static ShowQueries* make(QueryContext* qctx, PlanNode* input, bool isSlow) {
+        return qctx->objPool()->add(new ShowQueries(qctx, input, isSlow));
+    }
+
+    std::unique_ptr<cpp2::PlanNodeDescription> explain() const override;
+
+    bool isSlow() const {
+        return isSlow_;
+    }
+
+private:
+    ShowQueries(QueryContext* qctx, PlanNode* input, bool isSlow)
+        : SingleInputNode(qctx, Kind::kShowQueries, input), isSlow_(isSlow) {}
+
+    bool isSlow_{false};
+};
 }  // namespace graph
 }  // namespace nebula
 #endif  // PLANNER_ADMIN_H_
@@ -6,6 +6,9 @@
 
 #include "planner/Algo.h"
 
+#include "common/interface/gen-cpp2/graph_types.h"
+#include "util/ToJson.h"
+
 namespace nebula {
 namespace graph {
 
@@ -13,5 +16,16 @@ void ProduceSemiShortestPath::setStartsVid(std::vector<Value> starts) {
     starts_ = std::move(starts);
 }
 
+std::unique_ptr<cpp2::PlanNodeDescription> DijkstraShortestPath::explain() const {
+    auto desc = SingleInputNode::explain();
+    addDescription("space", util::toJson(space_), desc.get());
+    addDescription("srcs", folly::toJson(util::toJson(srcs_)), desc.get());
+    addDescription("dsts", folly::toJson(util::toJson(dsts_)), desc.get());
+    addDescription("edgeTypes", folly::toJson(util::toJson(edgeTypes_)), desc.get());
+    addDescription("weight", weight_, desc.get());
+    addDescription("steps", util::toJson(steps_), desc.get());
+    return desc;
+}
+
 }  // namnspace graph
 }  // namespace nebula
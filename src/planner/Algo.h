@@ -92,6 +92,83 @@ class ProduceAllPaths final : public SingleInputNode {
     ProduceAllPaths(QueryContext* qctx, PlanNode* input)
         : SingleInputNode(qctx, Kind::kProduceAllPaths, input) {}
 };
+
+/**
+ * Find the minimum cost path of each (src, dst) pair by the bidirectional
+ * Dijkstra, the cost of an edge is its weight property. It fetches the
+ * neighbors from the storage by itself, so there is no loop in the plan.
+ */
+class DijkstraShortestPath final : public SingleInputNode {
+public:
+    static DijkstraShortestPath* make(QueryContext* qctx,
+                                      PlanNode* input,
+                                      GraphSpaceID space,
+                                      std::vector<Value> srcs,
+                                      std::vector<Value> dsts,
+                                      std::vector<EdgeType> edgeTypes,
+                                      std::string weight,
+                                      size_t steps) {
+        return qctx->objPool()->add(new DijkstraShortestPath(qctx,
+                                                             input,
+                                                             space,
+                                                             std::move(srcs),
+                                                             std::move(dsts),
+                                                             std::move(edgeTypes),
+                                                             std::move(weight),
+                                                             steps));
+    }
+
+    std::unique_ptr<cpp2::PlanNodeDescription> explain() const override;
+
+    GraphSpaceID space() const {
+        return space_;
+    }
+
+    const std::vector<Value>& srcs() const {
+        return srcs_;
+    }
+
+    const std::vector<Value>& dsts() const {
+        return dsts_;
+    }
+
+    // The edge types to expand from the srcs, the ones from the dsts are reversed
+    const std::vector<EdgeType>& edgeTypes() const {
+        return edgeTypes_;
+    }
+
+    const std::string& weight() const {
+        return weight_;
+    }
+
+    size_t steps() const {
+        return steps_;
+    }
+
+private:
+    DijkstraShortestPath(QueryContext* qctx,
+                         PlanNode* input,
+                         GraphSpaceID space,
+                         std::vector<Value> srcs,
+                         std::vector<Value> dsts,
+                         std::vector<EdgeType> edgeTypes,
+                         std::string weight,
+                         size_t steps)
+        : SingleInputNode(qctx, Kind::kDijkstraShortest, input),
+          space_(space),
+          srcs_(std::move(srcs)),
+          dsts_(std::move(dsts)),
+          edgeTypes_(std::move(edgeTypes)),
+          weight_(std::move(weight)),
+          steps_(steps) {}
+
+    GraphSpaceID            space_;
+    std::vector<Value>      srcs_;
+    std::vector<Value>      dsts_;
+    std::vector<EdgeType>   edgeTypes_;
+    std::string             weight_;
+    size_t                  steps_{0};
+};
 }  // namespace graph
 }  // namespace nebula
 #endif  // PLANNER_ALGO_H_
@@ -70,6 +70,18 @@ static size_t makePlanNodeDesc(const PlanNode* node, cpp2::PlanDescription* plan
             makePlanNodeDesc(loop->dep(), planDesc);
             break;
         }
+        case PlanNode::Kind::kGetNeighborsProjectDedup: {
+            auto fused = static_cast<const GetNeighborsProjectDedup*>(node);
+            auto descs = fused->explainFused();
+            planNodeDesc = std::move(descs.front());
+            for (size_t i = 1; i < descs.size(); ++i) {
+                planDesc->node_index_map.emplace(descs[i].get_id(),
+                                                 planDesc->plan_node_descs.size());
+                planDesc->plan_node_descs.emplace_back(std::move(descs[i]));
+            }
+            makePlanNodeDesc(fused->dep(), planDesc);
+            break;
+        }
         default: {
             // Other plan nodes have single dependency
             DCHECK_EQ(node->dependencies().size(), 1U);
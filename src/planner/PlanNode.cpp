@@ -38,6 +38,12 @@ const char* PlanNode::toString(PlanNode::Kind kind) {
             return "GetEdges";
         case Kind::kIndexScan:
             return "IndexScan";
+        case Kind::kScanVertices:
+            return "ScanVertices";
+        case Kind::kTraverse:
+            return "Traverse";
+        case Kind::kGetNeighborsProjectDedup:
+            return "GetNeighborsProjectDedup";
         case Kind::kFilter:
             return "Filter";
         case Kind::kUnion:
@@ -179,6 +185,8 @@ const char* PlanNode::toString(PlanNode::Kind kind) {
             return "ShowCharset";
         case Kind::kShowCollation:
             return "ShowCollation";
+        case Kind::kShowQueries:
+            return "ShowQueries";
         case Kind::kShowConfigs:
             return "ShowConfigs";
         case Kind::kSetConfig:
@@ -193,6 +201,8 @@ const char* PlanNode::toString(PlanNode::Kind kind) {
             return "ConjunctPath";
         case Kind::kProduceAllPaths:
             return "ProduceAllPaths";
+        case Kind::kDijkstraShortest:
+            return "DijkstraShortest";
             // no default so the compiler will warning when lack
     }
     LOG(FATAL) << "Impossible kind plan node " << static_cast<int>(kind);
@@ -32,6 +32,9 @@ public:
         kGetVertices,
         kGetEdges,
         kIndexScan,
+        kScanVertices,
+        kTraverse,
+        kGetNeighborsProjectDedup,
         kFilter,
         kUnion,
         kIntersect,
@@ -105,6 +108,7 @@ public:
         kShowParts,
         kShowCharset,
         kShowCollation,
+        kShowQueries,
         kShowConfigs,
         kSetConfig,
         kGetConfig,
@@ -112,6 +116,7 @@ public:
         kProduceSemiShortestPath,
         kConjunctPath,
         kProduceAllPaths,
+        kDijkstraShortest,
     };
 
     PlanNode(QueryContext* qctx, Kind kind);
@@ -141,6 +146,13 @@ public:
         qctx_->symTable()->updateWrittenBy(oldVar, var, this);
     }
 
+    // Write the output var of the other node instead of it, e.g. the node
+    // replaced by an optimizer rule. The columns of the var are kept.
+    void takeOutputVar(const PlanNode* node) {
+        setColNames(node->colNames());
+        setOutputVar(node->outputVar());
+    }
+
     std::string outputVar(size_t index = 0) const {
         DCHECK_LT(index, outputVars_.size());
         return outputVars_[index]->name;
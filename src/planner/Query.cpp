@@ -83,6 +83,22 @@ std::unique_ptr<cpp2::PlanNodeDescription> GetNeighbors::explain() const {
     return desc;
 }
 
+GetVertices* GetVertices::clone(QueryContext* qctx) const {
+    auto newGV = GetVertices::make(qctx,
+                                   nullptr,
+                                   space_,
+                                   src_ ? qctx->objPool()->add(src_->clone().release()) : nullptr,
+                                   props_,
+                                   exprs_,
+                                   dedup_,
+                                   orderBy_,
+                                   limit_,
+                                   filter_);
+    newGV->setInputVar(inputVar());
+    newGV->setOutputVar(outputVar());
+    return newGV;
+}
+
 std::unique_ptr<cpp2::PlanNodeDescription> GetVertices::explain() const {
     auto desc = Explore::explain();
     addDescription("src", src_ ? src_->toString() : "", desc.get());
@@ -91,6 +107,47 @@ std::unique_ptr<cpp2::PlanNodeDescription> GetVertices::explain() const {
     return desc;
 }
 
+std::unique_ptr<cpp2::PlanNodeDescription> ScanVertices::explain() const {
+    auto desc = Explore::explain();
+    addDescription("props", folly::toJson(util::toJson(props_)), desc.get());
+    return desc;
+}
+
+std::unique_ptr<cpp2::PlanNodeDescription> Traverse::explain() const {
+    auto desc = Explore::explain();
+    addDescription("src", src_ ? src_->toString() : "", desc.get());
+    addDescription("edgeDirection",
+                   storage::cpp2::_EdgeDirection_VALUES_TO_NAMES.at(edgeDirection_),
+                   desc.get());
+    addDescription(
+        "vertexProps", vertexProps_ ? folly::toJson(util::toJson(*vertexProps_)) : "", desc.get());
+    addDescription(
+        "edgeProps", edgeProps_ ? folly::toJson(util::toJson(*edgeProps_)) : "", desc.get());
+    addDescription("steps", folly::stringPrintf("%ld..%ld", minSteps_, maxSteps_), desc.get());
+    addDescription("edgeFilter", edgeFilter_ ? edgeFilter_->toString() : "", desc.get());
+    return desc;
+}
+
+GetEdges* GetEdges::clone(QueryContext* qctx) const {
+    auto pool = qctx->objPool();
+    auto newGE = GetEdges::make(qctx,
+                                nullptr,
+                                space_,
+                                src_ ? pool->add(src_->clone().release()) : nullptr,
+                                type_ ? pool->add(type_->clone().release()) : nullptr,
+                                ranking_ ? pool->add(ranking_->clone().release()) : nullptr,
+                                dst_ ? pool->add(dst_->clone().release()) : nullptr,
+                                props_,
+                                exprs_,
+                                dedup_,
+                                limit_,
+                                orderBy_,
+                                filter_);
+    newGE->setInputVar(inputVar());
+    newGE->setOutputVar(outputVar());
+    return newGE;
+}
+
 std::unique_ptr<cpp2::PlanNodeDescription> GetEdges::explain() const {
     auto desc = Explore::explain();
     addDescription("src", src_ ? src_->toString() : "", desc.get());
@@ -107,13 +164,37 @@ IndexScan* IndexScan::clone(QueryContext* qctx) const {
     auto returnCols = std::make_unique<std::vector<std::string>>(*returnColumns());
     auto *scan = IndexScan::make(
         qctx, nullptr, space(), std::move(ctx), std::move(returnCols), isEdge(), schemaId());
-    scan->setOutputVar(this->outputVar());
+    scan->setDedup(dedup());
+    scan->setIntersect(intersect());
+    scan->setLimit(limit());
+    scan->setOrderBy(orderBy());
+    scan->setFilter(filter());
+    scan->setSortedBy(sortedBy());
+    scan->setSortFactors(sortFactors());
+    scan->takeOutputVar(this);
     return scan;
 }
 
 std::unique_ptr<cpp2::PlanNodeDescription> IndexScan::explain() const {
     auto desc = Explore::explain();
-    // TODO
+    addDescription("contexts", folly::to<std::string>(contexts_ ? contexts_->size() : 0),
+                   desc.get());
+    if (intersect_) {
+        addDescription("intersect", "true", desc.get());
+    }
+    if (!sortedBy_.empty()) {
+        addDescription("sortedBy", folly::join(",", sortedBy_), desc.get());
+    }
+    if (!sortFactors_.empty()) {
+        std::vector<std::string> factors;
+        for (const auto& factor : sortFactors_) {
+            factors.emplace_back(folly::stringPrintf(
+                "%lu %s",
+                factor.first,
+                factor.second == OrderFactor::OrderType::ASCEND ? "ASCEND" : "DESCEND"));
+        }
+        addDescription("sortFactors", folly::join(",", factors), desc.get());
+    }
     return desc;
 }
 
@@ -150,7 +231,7 @@ std::unique_ptr<cpp2::PlanNodeDescription> Sort::explain() const {
 Limit* Limit::clone(QueryContext* qctx) const {
     auto newLimit = Limit::make(qctx, nullptr, offset_, count_);
     newLimit->setInputVar(inputVar());
-    newLimit->setOutputVar(outputVar());
+    newLimit->takeOutputVar(this);
     return newLimit;
 }
 
@@ -161,6 +242,30 @@ std::unique_ptr<cpp2::PlanNodeDescription> Limit::explain() const {
     return desc;
 }
 
+std::unique_ptr<cpp2::PlanNodeDescription> Dedup::explain() const {
+    auto desc = SingleInputNode::explain();
+    if (frontier_) {
+        addDescription("frontier", "true", desc.get());
+    }
+    return desc;
+}
+
+std::vector<cpp2::PlanNodeDescription> GetNeighborsProjectDedup::explainFused() const {
+    DCHECK_EQ(id_, dedup_->id());
+    auto dedup = dedup_->explain();
+    auto project = project_->explain();
+    auto gn = gn_->explain();
+    // The dependency of the GetNeighbors may be replaced by the optimizer too
+    gn->set_dependencies({dep()->id()});
+
+    std::vector<cpp2::PlanNodeDescription> descs;
+    for (auto* desc : {dedup.get(), project.get(), gn.get()}) {
+        addDescription("fused", toString(kind_), desc);
+        descs.emplace_back(std::move(*desc));
+    }
+    return descs;
+}
+
 std::unique_ptr<cpp2::PlanNodeDescription> TopN::explain() const {
     auto desc = SingleInputNode::explain();
     addDescription("factors", folly::toJson(util::toJson(factorsString())), desc.get());
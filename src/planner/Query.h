@@ -255,6 +255,8 @@ public:
 
     std::unique_ptr<cpp2::PlanNodeDescription> explain() const override;
 
+    GetVertices* clone(QueryContext* qctx) const;
+
     Expression* src() const {
         return src_;
     }
@@ -299,6 +301,150 @@ private:
     std::vector<storage::cpp2::Expr>         exprs_;
 };
 
+/**
+ * Scan all the vertices of a tag in all the partitions, for the queries
+ * without a usable index.
+ */
+class ScanVertices final : public Explore {
+public:
+    static ScanVertices* make(QueryContext* qctx,
+                              PlanNode* input,
+                              GraphSpaceID space,
+                              storage::cpp2::VertexProp props,
+                              int64_t limit = std::numeric_limits<int64_t>::max(),
+                              std::string filter = "") {
+        return qctx->objPool()->add(new ScanVertices(
+                qctx,
+                input,
+                space,
+                std::move(props),
+                limit,
+                std::move(filter)));
+    }
+
+    std::unique_ptr<cpp2::PlanNodeDescription> explain() const override;
+
+    // The tag and its props to return
+    const storage::cpp2::VertexProp& props() const {
+        return props_;
+    }
+
+private:
+    ScanVertices(QueryContext* qctx,
+                 PlanNode* input,
+                 GraphSpaceID space,
+                 storage::cpp2::VertexProp props,
+                 int64_t limit,
+                 std::string filter)
+        : Explore(qctx,
+                  Kind::kScanVertices,
+                  input,
+                  space,
+                  false,
+                  limit,
+                  std::move(filter),
+                  {}),
+          props_(std::move(props)) { }
+
+private:
+    storage::cpp2::VertexProp                props_;
+};
+
+/**
+ * Expand from the src vertices for all the steps in the range at a time, e.g.
+ * (a)-[e:like*1..3]->(b), instead of a GetNeighbors and the joins for each
+ * step. Returns the src vertex, the list of the edges and the dst vid of each
+ * path, the edges are not repeated in a path.
+ */
+class Traverse final : public Explore {
+public:
+    using VertexProps = GetNeighbors::VertexProps;
+    using EdgeProps = GetNeighbors::EdgeProps;
+
+    static Traverse* make(QueryContext* qctx,
+                          PlanNode* input,
+                          GraphSpaceID space,
+                          Expression* src,
+                          storage::cpp2::EdgeDirection edgeDirection,
+                          VertexProps vertexProps,
+                          EdgeProps edgeProps,
+                          int64_t minSteps,
+                          int64_t maxSteps,
+                          Expression* edgeFilter = nullptr) {
+        return qctx->objPool()->add(new Traverse(qctx,
+                                                 input,
+                                                 space,
+                                                 src,
+                                                 edgeDirection,
+                                                 std::move(vertexProps),
+                                                 std::move(edgeProps),
+                                                 minSteps,
+                                                 maxSteps,
+                                                 edgeFilter));
+    }
+
+    std::unique_ptr<cpp2::PlanNodeDescription> explain() const override;
+
+    Expression* src() const {
+        return src_;
+    }
+
+    storage::cpp2::EdgeDirection edgeDirection() const {
+        return edgeDirection_;
+    }
+
+    // The props of the src vertices
+    const std::vector<storage::cpp2::VertexProp>* vertexProps() const {
+        return vertexProps_.get();
+    }
+
+    const std::vector<storage::cpp2::EdgeProp>* edgeProps() const {
+        return edgeProps_.get();
+    }
+
+    int64_t minSteps() const {
+        return minSteps_;
+    }
+
+    int64_t maxSteps() const {
+        return maxSteps_;
+    }
+
+    // Evaluated on each edge of each step, nullptr if all of them are taken
+    Expression* edgeFilter() const {
+        return edgeFilter_;
+    }
+
+private:
+    Traverse(QueryContext* qctx,
+             PlanNode* input,
+             GraphSpaceID space,
+             Expression* src,
+             storage::cpp2::EdgeDirection edgeDirection,
+             VertexProps vertexProps,
+             EdgeProps edgeProps,
+             int64_t minSteps,
+             int64_t maxSteps,
+             Expression* edgeFilter)
+        : Explore(qctx, Kind::kTraverse, input, space),
+          src_(src),
+          edgeDirection_(edgeDirection),
+          vertexProps_(std::move(vertexProps)),
+          edgeProps_(std::move(edgeProps)),
+          minSteps_(minSteps),
+          maxSteps_(maxSteps),
+          edgeFilter_(edgeFilter) {}
+
+private:
+    Expression*                                  src_{nullptr};
+    storage::cpp2::EdgeDirection edgeDirection_{storage::cpp2::EdgeDirection::OUT_EDGE};
+    VertexProps                                  vertexProps_;
+    EdgeProps                                    edgeProps_;
+    int64_t                                      minSteps_{1};
+    int64_t                                      maxSteps_{1};
+    Expression*                                  edgeFilter_{nullptr};
+};
+
 /**
  * Get property with given edge keys.
  */
@@ -335,6 +481,8 @@ public:
 
     std::unique_ptr<cpp2::PlanNodeDescription> explain() const override;
 
+    GetEdges* clone(QueryContext* qctx) const;
+
     Expression* src() const {
         return src_;
     }
@@ -468,6 +616,43 @@ public:
         schemaId_ = schema;
     }
 
+    /**
+     * Whether a vertex or an edge is returned only if it's hit by all the
+     * query contexts, each of them is served by its own index. Otherwise the
+     * results of them are united, and deduplicated if dedup() is set.
+     */
+    bool intersect() const {
+        return intersect_;
+    }
+
+    void setIntersect(bool intersect) {
+        intersect_ = intersect;
+    }
+
+    /**
+     * The columns by which the rows of each partition are sorted ascending,
+     * i.e. the fields of the index following the ones of the prefix hints.
+     */
+    const std::vector<size_t>& sortedBy() const {
+        return sortedBy_;
+    }
+
+    void setSortedBy(std::vector<size_t> sortedBy) {
+        sortedBy_ = std::move(sortedBy);
+    }
+
+    /**
+     * The order of the output rows, which are merged from the sorted runs of
+     * the partitions. Only the first limit() rows are merged if it's set.
+     */
+    const std::vector<std::pair<size_t, OrderFactor::OrderType>>& sortFactors() const {
+        return sortFactors_;
+    }
+
+    void setSortFactors(std::vector<std::pair<size_t, OrderFactor::OrderType>> factors) {
+        sortFactors_ = std::move(factors);
+    }
+
 private:
     IndexScan(QueryContext* qctx,
               PlanNode* input,
@@ -499,6 +684,9 @@ private:
     IndexReturnCols                               returnCols_;
     bool                                          isEdge_;
     int32_t                                       schemaId_;
+    bool                                          intersect_{false};
+    std::vector<size_t>                           sortedBy_;
+    std::vector<std::pair<size_t, OrderFactor::OrderType>> sortFactors_;
 };
 
 /**
@@ -828,11 +1016,91 @@ public:
         return qctx->objPool()->add(new Dedup(qctx, input));
     }
 
+    /**
+     * Also drop the rows which were output before, i.e. by the former iterations
+     * of the loop or held by the output var before the loop, so a traversal
+     * never expands a vertex twice.
+     */
+    bool frontier() const {
+        return frontier_;
+    }
+
+    void setFrontier(bool frontier) {
+        frontier_ = frontier;
+    }
+
+    std::unique_ptr<cpp2::PlanNodeDescription> explain() const override;
+
 private:
     Dedup(QueryContext* qctx,
           PlanNode* input)
         : SingleInputNode(qctx, Kind::kDedup, input) {
     }
+
+    bool                    frontier_{false};
+};
+
+/**
+ * The GetNeighbors, the Project of the neighbors and the Dedup of the projected
+ * rows fused by the optimizer, so the response of the storage is projected and
+ * deduplicated in a single pass.
+ *
+ * It takes the id of the Dedup and is described as the fused nodes, which the
+ * profiling stats of each stage are attributed to.
+ */
+class GetNeighborsProjectDedup final : public SingleInputNode {
+public:
+    static GetNeighborsProjectDedup* make(QueryContext* qctx,
+                                          PlanNode* input,
+                                          const GetNeighbors* gn,
+                                          const Project* project,
+                                          const Dedup* dedup) {
+        return qctx->objPool()->add(new GetNeighborsProjectDedup(qctx, input, gn, project, dedup));
+    }
+
+    const GetNeighbors* getNeighbors() const {
+        return gn_;
+    }
+
+    const Project* project() const {
+        return project_;
+    }
+
+    const Dedup* dedup() const {
+        return dedup_;
+    }
+
+    // Whether the neighbors are also read by the others, then they are still
+    // output to the output var of the GetNeighbors
+    bool keepNeighbors() const {
+        return keepNeighbors_;
+    }
+
+    void setKeepNeighbors(bool keep) {
+        keepNeighbors_ = keep;
+    }
+
+    // The descriptions of the fused Dedup, Project and GetNeighbors in turn
+    std::vector<cpp2::PlanNodeDescription> explainFused() const;
+
+private:
+    GetNeighborsProjectDedup(QueryContext* qctx,
+                             PlanNode* input,
+                             const GetNeighbors* gn,
+                             const Project* project,
+                             const Dedup* dedup)
+        : SingleInputNode(qctx, Kind::kGetNeighborsProjectDedup, input),
+          gn_(gn),
+          project_(project),
+          dedup_(dedup) {
+        setId(dedup->id());
+    }
+
+private:
+    const GetNeighbors*     gn_{nullptr};
+    const Project*          project_{nullptr};
+    const Dedup*            dedup_{nullptr};
+    bool                    keepNeighbors_{false};
 };
 
 class DataCollect final : public SingleDependencyNode {
@@ -6,18 +6,87 @@
 
 #include "planner/planners/MatchTagScanPlanner.h"
 
+#include "parser/MatchSentence.h"
+
 namespace nebula {
 namespace graph {
 bool MatchTagScanPlanner::match(AstContext* astCtx) {
-    // TODO:
-    UNUSED(astCtx);
-    return false;
+    if (astCtx->sentence->kind() != Sentence::Kind::kMatch) {
+        return false;
+    }
+    auto* matchCtx = static_cast<MatchAstContext*>(astCtx);
+
+    auto& head = matchCtx->nodeInfos[0];
+    if (head.label == nullptr) {
+        return false;
+    }
+
+    // Pushed down to filter the vertices in storage, the filter on the whole
+    // pattern is still applied after all
+    Expression *filter = nullptr;
+    if (matchCtx->filter != nullptr) {
+        filter = makeIndexFilter(*head.label, *head.alias, matchCtx->filter.get(), matchCtx->qctx);
+    }
+    if (filter == nullptr) {
+        if (head.props != nullptr && !head.props->items().empty()) {
+            filter = makeIndexFilter(*head.label, head.props, matchCtx->qctx);
+        }
+    }
+
+    matchCtx->scanInfo.filter = filter;
+    matchCtx->scanInfo.schemaId = head.tid;
+
+    return true;
+}
+
+Status MatchTagScanPlanner::buildScanNode() {
+    if (!startFromNode_) {
+        return Status::SemanticError("Scan from edge not supported now");
+    }
+    if (startIndex_ != 0) {
+        return Status::SemanticError("Only support scan from the head node");
+    }
+
+    // Only the vids, the props are got by the GetVertices after
+    VertexProp props;
+    props.set_tag(matchCtx_->scanInfo.schemaId);
+    props.set_props({kVid});
+    std::string filter;
+    if (matchCtx_->scanInfo.filter != nullptr) {
+        filter = Expression::encode(*matchCtx_->scanInfo.filter);
+    }
+    auto scan = ScanVertices::make(matchCtx_->qctx,
+                                   nullptr,
+                                   matchCtx_->space.id,
+                                   std::move(props),
+                                   scanLimit(),
+                                   std::move(filter));
+    scan->setColNames({kVid});
+    subPlan_.tail = scan;
+    subPlan_.root = scan;
+
+    return Status::OK();
 }
 
-StatusOr<SubPlan> MatchTagScanPlanner::transform(AstContext* astCtx) {
-    // TODO:
-    UNUSED(astCtx);
-    return Status::Error();
+int64_t MatchTagScanPlanner::scanLimit() const {
+    constexpr auto kMax = std::numeric_limits<int64_t>::max();
+    auto* sentence = static_cast<const MatchSentence*>(matchCtx_->sentence);
+    auto& head = matchCtx_->nodeInfos[0];
+    // Each of the scanned vertices is one row of the result exactly
+    if (!matchCtx_->edgeInfos.empty() ||
+            matchCtx_->filter != nullptr ||
+            head.filter != nullptr ||
+            (head.props != nullptr && !head.props->items().empty()) ||
+            sentence->ret()->isDistinct() ||
+            !matchCtx_->indexedOrderFactors.empty()) {
+        return kMax;
+    }
+    auto skip = std::max<int64_t>(matchCtx_->skip, 0);
+    auto limit = matchCtx_->limit;
+    if (limit < 0 || limit > kMax - skip) {
+        return kMax;
+    }
+    return skip + limit;
 }
 }  // namespace graph
 }  // namespace nebula
@@ -9,10 +9,15 @@
 
 #include "context/QueryContext.h"
 #include "planner/Planner.h"
+#include "planner/planners/MatchVertexIndexSeekPlanner.h"
 
 namespace nebula {
 namespace graph {
-class MatchTagScanPlanner final : public Planner {
+/*
+ * Scan all the vertices of the head tag when there is no index to seek them,
+ * the rest of the pattern is built the same as the index seek.
+ */
+class MatchTagScanPlanner final : public MatchVertexIndexSeekPlanner {
 public:
     static std::unique_ptr<MatchTagScanPlanner> make() {
         return std::unique_ptr<MatchTagScanPlanner>(new MatchTagScanPlanner());
@@ -20,10 +25,14 @@ public:
 
     static bool match(AstContext* astCtx);
 
-    StatusOr<SubPlan> transform(AstContext* astCtx) override;
-
 private:
     MatchTagScanPlanner() = default;
+
+    Status buildScanNode() override;
+
+    // The max vertices to scan, only bounded when the head nodes are returned
+    // as they are, e.g. MATCH (v:Tag) RETURN v LIMIT 10
+    int64_t scanLimit() const;
 };
 }  // namespace graph
 }  // namespace nebula
@@ -36,6 +36,10 @@ bool MatchVertexIndexSeekPlanner::match(AstContext* astCtx) {
     if (filter == nullptr) {
         return false;
     }
+    // Leave it to the tag scan
+    if (!hasTagIndex(matchCtx->qctx, matchCtx->space.id, head.tid)) {
+        return false;
+    }
 
     matchCtx->scanInfo.filter = filter;
     matchCtx->scanInfo.schemaId = head.tid;
@@ -43,6 +47,19 @@ bool MatchVertexIndexSeekPlanner::match(AstContext* astCtx) {
     return true;
 }
 
+bool MatchVertexIndexSeekPlanner::hasTagIndex(QueryContext* qctx,
+                                              GraphSpaceID space,
+                                              TagID tagId) {
+    auto indexes = qctx->getMetaClient()->getTagIndexesFromCache(space);
+    if (!indexes.ok()) {
+        return false;
+    }
+    auto& items = indexes.value();
+    return std::any_of(items.begin(), items.end(), [tagId](auto& index) {
+        return index->get_schema_id().get_tag_id() == tagId;
+    });
+}
+
 Expression* MatchVertexIndexSeekPlanner::makeIndexFilter(const std::string &label,
                                                          const MapExpression *map,
                                                          QueryContext* qctx) {
@@ -201,15 +218,12 @@ Status MatchVertexIndexSeekPlanner::buildStep() {
 
     auto &srcNodeInfo = matchCtx_->nodeInfos[curStep_];
     auto &edgeInfo = matchCtx_->edgeInfos[curStep_];
-    auto *gn = GetNeighbors::make(matchCtx_->qctx, subPlan_.root, matchCtx_->space.id);
-    gn->setSrc(gnSrcExpr_);
     auto vertexProps = std::make_unique<std::vector<VertexProp>>();
     if (srcNodeInfo.label != nullptr) {
         VertexProp vertexProp;
         vertexProp.set_tag(srcNodeInfo.tid);
         vertexProps->emplace_back(std::move(vertexProp));
     }
-    gn->setVertexProps(std::move(vertexProps));
     auto edgeProps = std::make_unique<std::vector<EdgeProp>>();
     if (!edgeInfo.edgeTypes.empty()) {
         for (auto edgeType : edgeInfo.edgeTypes) {
@@ -225,17 +239,27 @@ Status MatchVertexIndexSeekPlanner::buildStep() {
             edgeProps->emplace_back(std::move(edgeProp));
         }
     }
-    gn->setEdgeProps(std::move(edgeProps));
-    gn->setEdgeDirection(edgeInfo.direction);
 
-    auto *yields = saveObject(new YieldColumns());
-    yields->addColumn(new YieldColumn(new VertexExpression()));
-    yields->addColumn(new YieldColumn(new EdgeExpression()));
-    auto *project = Project::make(matchCtx_->qctx, gn, yields);
-    project->setInputVar(gn->outputVar());
-    project->setColNames({*srcNodeInfo.alias, *edgeInfo.alias});
-
-    subPlan_.root = project;
+    if (edgeInfo.range != nullptr) {
+        NG_RETURN_IF_ERROR(buildTraverse(std::move(vertexProps), std::move(edgeProps)));
+    } else {
+        auto *gn = GetNeighbors::make(matchCtx_->qctx, subPlan_.root, matchCtx_->space.id);
+        gn->setSrc(gnSrcExpr_);
+        gn->setVertexProps(std::move(vertexProps));
+        gn->setEdgeProps(std::move(edgeProps));
+        gn->setEdgeDirection(edgeInfo.direction);
+
+        auto *yields = saveObject(new YieldColumns());
+        yields->addColumn(new YieldColumn(new VertexExpression()));
+        yields->addColumn(new YieldColumn(new EdgeExpression()));
+        auto *project = Project::make(matchCtx_->qctx, gn, yields);
+        project->setInputVar(gn->outputVar());
+        project->setColNames({*srcNodeInfo.alias, *edgeInfo.alias});
+        dstColNames_.emplace_back();
+
+        subPlan_.root = project;
+    }
+    auto *expand = subPlan_.root;
 
     auto rewriter = [] (const Expression *expr) {
         DCHECK_EQ(expr->kind(), Expression::Kind::kLabelAttribute);
@@ -251,7 +275,8 @@ Status MatchVertexIndexSeekPlanner::buildStep() {
         subPlan_.root = node;
     }
 
-    if (edgeInfo.filter != nullptr) {
+    // The edges of the variable length steps are filtered in the traverse
+    if (edgeInfo.filter != nullptr && edgeInfo.range == nullptr) {
         RewriteMatchLabelVisitor visitor(rewriter);
         edgeInfo.filter->accept(&visitor);
         auto *node = Filter::make(matchCtx_->qctx, subPlan_.root, edgeInfo.filter);
@@ -260,12 +285,7 @@ Status MatchVertexIndexSeekPlanner::buildStep() {
         subPlan_.root = node;
     }
 
-    gnSrcExpr_ = new AttributeExpression(
-            new VariablePropertyExpression(
-                new std::string(project->outputVar()),
-                new std::string(*edgeInfo.alias)),
-            new LabelExpression("_dst"));
-    saveObject(gnSrcExpr_);
+    gnSrcExpr_ = dstOf(curStep_, expand->outputVar());
 
     prevStepRoot_ = thisStepRoot_;
     thisStepRoot_ = subPlan_.root;
@@ -274,19 +294,69 @@ Status MatchVertexIndexSeekPlanner::buildStep() {
 }
 
 
+Status MatchVertexIndexSeekPlanner::buildTraverse(
+        std::unique_ptr<std::vector<VertexProp>> vertexProps,
+        std::unique_ptr<std::vector<EdgeProp>> edgeProps) {
+    auto &srcNodeInfo = matchCtx_->nodeInfos[curStep_];
+    auto &edgeInfo = matchCtx_->edgeInfos[curStep_];
+
+    // Evaluated on each edge got from storage
+    Expression *edgeFilter = nullptr;
+    if (edgeInfo.filter != nullptr) {
+        auto newFilter = edgeInfo.filter->clone();
+        RewriteMatchLabelVisitor visitor([](const Expression *expr) -> Expression* {
+            DCHECK_EQ(expr->kind(), Expression::Kind::kLabelAttribute);
+            auto *la = static_cast<const LabelAttributeExpression*>(expr);
+            return new AttributeExpression(new EdgeExpression(),
+                                           new LabelExpression(*la->right()->name()));
+        });
+        newFilter->accept(&visitor);
+        edgeFilter = saveObject(newFilter.release());
+    }
+
+    auto *traverse = Traverse::make(matchCtx_->qctx,
+                                    subPlan_.root,
+                                    matchCtx_->space.id,
+                                    gnSrcExpr_,
+                                    edgeInfo.direction,
+                                    std::move(vertexProps),
+                                    std::move(edgeProps),
+                                    edgeInfo.range->min(),
+                                    edgeInfo.range->max(),
+                                    edgeFilter);
+    auto dstColName = matchCtx_->qctx->vctx()->anonVarGen()->getVar();
+    traverse->setColNames({*srcNodeInfo.alias, *edgeInfo.alias, dstColName});
+    dstColNames_.emplace_back(std::move(dstColName));
+    subPlan_.root = traverse;
+
+    return Status::OK();
+}
+
+
+Expression* MatchVertexIndexSeekPlanner::dstOf(size_t step, const std::string &var) const {
+    Expression *dst = nullptr;
+    if (dstColNames_[step].empty()) {
+        dst = new AttributeExpression(
+                new VariablePropertyExpression(
+                    new std::string(var),
+                    new std::string(*matchCtx_->edgeInfos[step].alias)),
+                new LabelExpression("_dst"));
+    } else {
+        dst = new VariablePropertyExpression(new std::string(var),
+                                             new std::string(dstColNames_[step]));
+    }
+    return saveObject(dst);
+}
+
+
 Status MatchVertexIndexSeekPlanner::buildGetTailVertices() {
     Expression *src = nullptr;
     if (!matchCtx_->edgeInfos.empty()) {
-        src = new AttributeExpression(
-                new VariablePropertyExpression(
-                    new std::string(),
-                    new std::string(*matchCtx_->edgeInfos[curStep_].alias)),
-                new LabelExpression("_dst"));
+        src = dstOf(curStep_, "");
     } else {
-        src = new VariablePropertyExpression(new std::string(),
-                new std::string(kVid));
+        src = saveObject(new VariablePropertyExpression(new std::string(),
+                new std::string(kVid)));
     }
-    saveObject(src);
 
     auto &nodeInfo = matchCtx_->nodeInfos[curStep_ + 1];
     std::vector<VertexProp> props;
@@ -301,15 +371,29 @@ Status MatchVertexIndexSeekPlanner::buildGetTailVertices() {
     if (thisStepRoot_ != nullptr) {
         gv->setInputVar(thisStepRoot_->outputVar());
     }
+    PlanNode *current = gv;
+
+    // The props of a labeled node could be evaluated on the tag props directly,
+    // so the filter is placed right after GetVertices and pushed into storage by optimizer.
+    bool filterOnTag = nodeInfo.label != nullptr &&
+                       nodeInfo.props != nullptr &&
+                       !nodeInfo.props->items().empty();
+    if (filterOnTag) {
+        auto *tagFilter = makeIndexFilter(*nodeInfo.label, nodeInfo.props, matchCtx_->qctx);
+        auto *filter = Filter::make(matchCtx_->qctx, current, tagFilter);
+        filter->setInputVar(current->outputVar());
+        filter->setColNames(current->colNames());
+        current = filter;
+    }
 
     auto *yields = saveObject(new YieldColumns());
     yields->addColumn(new YieldColumn(new VertexExpression()));
-    auto *project = Project::make(matchCtx_->qctx, gv, yields);
-    project->setInputVar(gv->outputVar());
+    auto *project = Project::make(matchCtx_->qctx, current, yields);
+    project->setInputVar(current->outputVar());
     project->setColNames({*nodeInfo.alias});
     subPlan_.root = project;
 
-    if (nodeInfo.filter != nullptr) {
+    if (!filterOnTag && nodeInfo.filter != nullptr) {
         auto newFilter = nodeInfo.filter->clone();
         RewriteMatchLabelVisitor visitor([](auto *expr) {
                 DCHECK(expr->kind() == Expression::Kind::kLabelAttribute);
@@ -334,11 +418,7 @@ Status MatchVertexIndexSeekPlanner::buildGetTailVertices() {
 
 Status MatchVertexIndexSeekPlanner::buildStepJoin() {
     auto prevStep = curStep_ - 1;
-    auto key = new AttributeExpression(
-            new VariablePropertyExpression(
-                new std::string(prevStepRoot_->outputVar()),
-                new std::string(*matchCtx_->edgeInfos[prevStep].alias)),
-            new LabelExpression("_dst"));
+    auto key = dstOf(prevStep, prevStepRoot_->outputVar());
     auto probe = new AttributeExpression(
             new VariablePropertyExpression(
                 new std::string(thisStepRoot_->outputVar()),
@@ -369,11 +449,7 @@ Status MatchVertexIndexSeekPlanner::buildStepJoin() {
 
 
 Status MatchVertexIndexSeekPlanner::buildTailJoin() {
-    auto key = new AttributeExpression(
-            new VariablePropertyExpression(
-                new std::string(thisStepRoot_->outputVar()),
-                new std::string(*matchCtx_->edgeInfos[curStep_].alias)),
-            new LabelExpression("_dst"));
+    auto key = dstOf(curStep_, thisStepRoot_->outputVar());
     auto probe = new AttributeExpression(
             new VariablePropertyExpression(
                 new std::string(subPlan_.root->outputVar()),
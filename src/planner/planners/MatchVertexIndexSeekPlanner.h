@@ -14,7 +14,7 @@
 
 namespace nebula {
 namespace graph {
-class MatchVertexIndexSeekPlanner final : public Planner {
+class MatchVertexIndexSeekPlanner : public Planner {
 public:
     static std::unique_ptr<MatchVertexIndexSeekPlanner> make() {
         return std::unique_ptr<MatchVertexIndexSeekPlanner>(new MatchVertexIndexSeekPlanner());
@@ -24,7 +24,7 @@ public:
 
     StatusOr<SubPlan> transform(AstContext* astCtx) override;
 
-private:
+protected:
     using VertexProp = nebula::storage::cpp2::VertexProp;
     using EdgeProp = nebula::storage::cpp2::EdgeProp;
 
@@ -37,14 +37,25 @@ private:
                                        const Expression* filter,
                                        QueryContext* qctx);
 
+    // Whether there is an index on the tag to seek the head node by
+    static bool hasTagIndex(QueryContext* qctx, GraphSpaceID space, TagID tagId);
+
     MatchVertexIndexSeekPlanner() = default;
 
-    Status buildScanNode();
+    // Build the node to get the vids of the head node
+    virtual Status buildScanNode();
 
     Status buildSteps();
 
     Status buildStep();
 
+    // Expand all the steps of a variable length edge at a time
+    Status buildTraverse(std::unique_ptr<std::vector<VertexProp>> vertexProps,
+                         std::unique_ptr<std::vector<EdgeProp>> edgeProps);
+
+    // The dst vids of the edges of the step, in the result of the variable
+    Expression* dstOf(size_t step, const std::string &var) const;
+
     Status buildGetTailVertices();
 
     Status buildStepJoin();
@@ -66,6 +77,9 @@ private:
     PlanNode                                   *thisStepRoot_{nullptr};
     PlanNode                                   *prevStepRoot_{nullptr};
     Expression                                 *gnSrcExpr_{nullptr};
+    // The columns of the dst vids of the variable length steps, empty for the
+    // others whose dst vids are got from the edges
+    std::vector<std::string>                    dstColNames_;
 };
 }  // namespace graph
 }  // namespace nebula
@@ -10,7 +10,6 @@
 #include "executor/ExecutionError.h"
 #include "executor/Executor.h"
 #include "executor/logic/LoopExecutor.h"
-#include "executor/logic/PassThroughExecutor.h"
 #include "executor/logic/SelectExecutor.h"
 #include "planner/PlanNode.h"
 
@@ -19,128 +18,183 @@ namespace graph {
 
 Scheduler::Task::Task(const Executor *e) : planId(DCHECK_NOTNULL(e)->node()->id()) {}
 
-Scheduler::PassThroughData::PassThroughData(int32_t outputs)
-    : promise(std::make_unique<folly::SharedPromise<Status>>()), numOutputs(outputs) {}
+Scheduler::Run::Run(const TaskGraph *g)
+    : graph(g), pending(new std::atomic<int32_t>[g->executors.size()]) {
+    for (size_t i = 0; i < graph->executors.size(); ++i) {
+        pending[i] = graph->numDepends[i];
+    }
+}
 
 Scheduler::Scheduler(QueryContext *qctx) : qctx_(DCHECK_NOTNULL(qctx)) {}
 
 folly::Future<Status> Scheduler::schedule() {
-    auto executor = Executor::create(qctx_->plan()->root(), qctx_);
+    auto *root = qctx_->plan()->root();
+    auto executor = qctx_->executor();
+    // The executors created by the last execution of the same plan, e.g. of
+    // the prepared statement, are reused
+    bool reused = executor != nullptr && executor->node() == root;
+    if (!reused) {
+        executor = Executor::create(root, qctx_);
+        qctx_->setExecutor(executor);
+    }
+    graphs_.clear();
     analyze(executor);
-    return doSchedule(executor);
+    if (reused) {
+        recycle();
+    }
+    return runGraph(executor);
 }
 
-void Scheduler::analyze(Executor *executor) {
-    switch (executor->node()->kind()) {
-        case PlanNode::Kind::kPassThrough: {
-            const auto &name = executor->node()->outputVar();
-            auto it = passThroughPromiseMap_.find(name);
-            if (it == passThroughPromiseMap_.end()) {
-                PassThroughData data(executor->successors().size());
-                passThroughPromiseMap_.emplace(name, std::move(data));
-            }
-            break;
+void Scheduler::recycle() {
+    for (auto &kv : graphs_) {
+        for (auto executor : kv.second->executors) {
+            executor->recycle();
         }
-        case PlanNode::Kind::kSelect: {
-            auto sel = static_cast<SelectExecutor *>(executor);
-            analyze(sel->thenBody());
-            analyze(sel->elseBody());
-            break;
-        }
-        case PlanNode::Kind::kLoop: {
-            auto loop = static_cast<LoopExecutor *>(executor);
-            analyze(loop->loopBody());
-            break;
+    }
+}
+
+void Scheduler::analyze(Executor *root) {
+    if (graphs_.find(root) != graphs_.end()) {
+        return;
+    }
+    auto graph = std::make_unique<TaskGraph>();
+    std::unordered_map<Executor *, size_t> index;
+    addTask(root, graph.get(), &index);
+    auto *g = graph.get();
+    graphs_.emplace(root, std::move(graph));
+
+    for (auto executor : g->executors) {
+        switch (executor->node()->kind()) {
+            case PlanNode::Kind::kSelect: {
+                auto sel = static_cast<SelectExecutor *>(executor);
+                analyze(sel->thenBody());
+                analyze(sel->elseBody());
+                break;
+            }
+            case PlanNode::Kind::kLoop: {
+                auto loop = static_cast<LoopExecutor *>(executor);
+                analyze(loop->loopBody());
+                break;
+            }
+            default:
+                break;
         }
-        default:
-            break;
     }
+}
 
+size_t Scheduler::addTask(Executor *executor,
+                          TaskGraph *graph,
+                          std::unordered_map<Executor *, size_t> *index) const {
+    auto found = index->find(executor);
+    if (found != index->end()) {
+        return found->second;
+    }
+    std::vector<size_t> deps;
+    deps.reserve(executor->depends().size());
     for (auto dep : executor->depends()) {
-        analyze(dep);
+        deps.emplace_back(addTask(dep, graph, index));
     }
+    // After all its dependencies
+    auto i = graph->executors.size();
+    graph->executors.emplace_back(executor);
+    graph->successors.emplace_back();
+    graph->numDepends.emplace_back(static_cast<int32_t>(deps.size()));
+    for (auto dep : deps) {
+        graph->successors[dep].emplace_back(i);
+    }
+    if (deps.empty()) {
+        graph->leaves.emplace_back(i);
+    }
+    index->emplace(executor, i);
+    return i;
 }
 
-folly::Future<Status> Scheduler::doSchedule(Executor *executor) {
-    switch (executor->node()->kind()) {
-        case PlanNode::Kind::kSelect: {
-            auto sel = static_cast<SelectExecutor *>(executor);
-            return doScheduleParallel(sel->depends())
-                .then(task(sel,
-                           [sel, this](Status status) {
-                               if (!status.ok()) return sel->error(std::move(status));
-                               return execute(sel);
-                           }))
-                .then(task(sel, [sel, this](Status status) {
-                    if (!status.ok()) return sel->error(std::move(status));
-
-                    auto val = qctx_->ectx()->getValue(sel->node()->outputVar());
-                    auto cond = val.moveBool();
-                    return doSchedule(cond ? sel->thenBody() : sel->elseBody());
-                }));
+folly::Future<Status> Scheduler::runGraph(Executor *root) {
+    auto found = graphs_.find(root);
+    CHECK(found != graphs_.end());
+    auto run = std::make_shared<Run>(found->second.get());
+    auto future = run->promise.getFuture();
+    run->inflight = static_cast<int32_t>(run->graph->leaves.size());
+    dispatch(run, run->graph->leaves);
+    return future;
+}
+
+void Scheduler::dispatch(const std::shared_ptr<Run> &run, std::vector<size_t> ready) {
+    while (!ready.empty()) {
+        auto i = ready.back();
+        ready.pop_back();
+        if (run->failed.load()) {
+            settle(run);
+            continue;
         }
-        case PlanNode::Kind::kLoop: {
-            auto loop = static_cast<LoopExecutor *>(executor);
-            return doScheduleParallel(loop->depends()).then(task(loop, [loop, this](Status status) {
-                if (!status.ok()) return loop->error(std::move(status));
-                return iterate(loop);
-            }));
+        auto executor = run->graph->executors[i];
+        auto future = runTask(executor);
+        if (future.isReady()) {
+            finish(run, i, future.getTry(), &ready);
+            continue;
         }
-        case PlanNode::Kind::kPassThrough: {
-            auto mout = static_cast<PassThroughExecutor *>(executor);
-            auto it = passThroughPromiseMap_.find(mout->node()->outputVar());
-            CHECK(it != passThroughPromiseMap_.end());
-
-            auto &data = it->second;
-
-            folly::SpinLockGuard g(data.lock);
-            if (data.numOutputs == 0) {
-                // Reset promise of output executors when it's in loop
-                data.numOutputs = static_cast<int32_t>(mout->successors().size());
-                data.promise = std::make_unique<folly::SharedPromise<Status>>();
-            }
+        std::move(future).then(task(executor, [run, i, this](folly::Try<Status> &result) {
+            std::vector<size_t> next;
+            finish(run, i, result, &next);
+            dispatch(run, std::move(next));
+        }));
+    }
+}
 
-            data.numOutputs--;
-            if (data.numOutputs > 0) {
-                return data.promise->getFuture();
+void Scheduler::finish(const std::shared_ptr<Run> &run,
+                       size_t index,
+                       folly::Try<Status> &result,
+                       std::vector<size_t> *ready) {
+    const auto *graph = run->graph;
+    if (result.hasException() || !result.value().ok()) {
+        if (!run->failed.exchange(true)) {
+            if (result.hasException()) {
+                run->error = std::move(result);
+            } else {
+                // Stop the whole execution early like the executors do
+                run->error = folly::Try<Status>(
+                    folly::make_exception_wrapper<ExecutionError>(std::move(result).value()));
             }
-
-            return doScheduleParallel(mout->depends())
-                .then(task(mout, [&data, mout, this](Status status) {
-                    // Notify and wake up all waited tasks
-                    data.promise->setValue(status);
-
-                    if (!status.ok()) return mout->error(std::move(status));
-                    return execute(mout);
-                }));
         }
-        default: {
-            auto deps = executor->depends();
-            if (deps.empty()) {
-                return execute(executor);
+    } else if (index + 1 == graph->executors.size()) {
+        run->promise.setValue(Status::OK());
+    } else {
+        for (auto succ : graph->successors[index]) {
+            if (run->pending[succ].fetch_sub(1) == 1) {
+                // Counted before this one is settled, so the run could not be
+                // finished by a failure in between
+                ++run->inflight;
+                ready->emplace_back(succ);
             }
-
-            return doScheduleParallel(deps).then(task(executor, [executor, this](Status stats) {
-                if (!stats.ok()) return executor->error(std::move(stats));
-                return execute(executor);
-            }));
         }
     }
+    settle(run);
 }
 
-folly::Future<Status> Scheduler::doScheduleParallel(const std::set<Executor *> &dependents) {
-    CHECK(!dependents.empty());
-
-    std::vector<folly::Future<Status>> futures;
-    for (auto dep : dependents) {
-        futures.emplace_back(doSchedule(dep));
+void Scheduler::settle(const std::shared_ptr<Run> &run) {
+    if (--run->inflight == 0 && run->failed.load()) {
+        run->promise.setTry(std::move(run->error));
     }
-    return folly::collect(futures).then([](std::vector<Status> stats) {
-        for (auto &s : stats) {
-            if (!s.ok()) return s;
+}
+
+folly::Future<Status> Scheduler::runTask(Executor *executor) {
+    switch (executor->node()->kind()) {
+        case PlanNode::Kind::kSelect: {
+            auto sel = static_cast<SelectExecutor *>(executor);
+            return execute(sel).then(task(sel, [sel, this](Status status) {
+                if (!status.ok()) return sel->error(std::move(status));
+
+                auto val = qctx_->ectx()->getValue(sel->node()->outputVar());
+                auto cond = val.moveBool();
+                return runGraph(cond ? sel->thenBody() : sel->elseBody());
+            }));
         }
-        return Status::OK();
-    });
+        case PlanNode::Kind::kLoop: {
+            return iterate(static_cast<LoopExecutor *>(executor));
+        }
+        default:
+            return execute(executor);
+    }
 }
 
 folly::Future<Status> Scheduler::iterate(LoopExecutor *loop) {
@@ -155,7 +209,7 @@ folly::Future<Status> Scheduler::iterate(LoopExecutor *loop) {
         }
         auto cond = val.moveBool();
         if (!cond) return folly::makeFuture(Status::OK());
-        return doSchedule(loop->loopBody()).then(task(loop, [loop, this](Status s) {
+        return runGraph(loop->loopBody()).then(task(loop, [loop, this](Status s) {
             if (!s.ok()) return loop->error(std::move(s));
             return iterate(loop);
         }));
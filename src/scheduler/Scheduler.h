@@ -7,14 +7,14 @@
 #ifndef SCHEDULER_SCHEDULER_H_
 #define SCHEDULER_SCHEDULER_H_
 
+#include <atomic>
 #include <memory>
-#include <set>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
-#include <folly/SpinLock.h>
 #include <folly/futures/Future.h>
-#include <folly/futures/SharedPromise.h>
+#include <folly/futures/Promise.h>
 
 #include "common/base/Status.h"
 #include "common/cpp/helpers.h"
@@ -62,22 +62,52 @@ private:
         return ExecTask<Fn>(e, std::forward<Fn>(f));
     }
 
-    void analyze(Executor *executor);
-    folly::Future<Status> doSchedule(Executor *executor);
-    folly::Future<Status> doScheduleParallel(const std::set<Executor *> &dependents);
-    folly::Future<Status> iterate(LoopExecutor *loop);
-    folly::Future<Status> execute(Executor *executor);
-
-    struct PassThroughData {
-        folly::SpinLock lock;
-        std::unique_ptr<folly::SharedPromise<Status>> promise;
-        int32_t numOutputs;
+    // The executors of a plan and the dependencies between them, analyzed once
+    // for each of the plan, the branches of the selects and the loop bodies.
+    // The executors are in the topological order, and the root is the last one.
+    struct TaskGraph {
+        std::vector<Executor *> executors;
+        std::vector<std::vector<size_t>> successors;
+        std::vector<int32_t> numDepends;
+        std::vector<size_t> leaves;
+    };
 
-        explicit PassThroughData(int32_t outputs);
+    // An execution of the task graph, an executor is dispatched once all its
+    // dependencies are finished.
+    struct Run {
+        const TaskGraph *graph;
+        std::unique_ptr<std::atomic<int32_t>[]> pending;
+        // The dispatched and the ready executors not finished yet
+        std::atomic<int32_t> inflight{0};
+        std::atomic<bool> failed{false};
+        folly::Try<Status> error;
+        folly::Promise<Status> promise;
+
+        explicit Run(const TaskGraph *g);
     };
 
+    void analyze(Executor *root);
+    // Drop the states of the reused executors
+    void recycle();
+    size_t addTask(Executor *executor,
+                   TaskGraph *graph,
+                   std::unordered_map<Executor *, size_t> *index) const;
+
+    folly::Future<Status> runGraph(Executor *root);
+    // Run the ready executors inline as long as they finish synchronously
+    void dispatch(const std::shared_ptr<Run> &run, std::vector<size_t> ready);
+    void finish(const std::shared_ptr<Run> &run,
+                size_t index,
+                folly::Try<Status> &result,
+                std::vector<size_t> *ready);
+    void settle(const std::shared_ptr<Run> &run);
+
+    folly::Future<Status> runTask(Executor *executor);
+    folly::Future<Status> iterate(LoopExecutor *loop);
+    folly::Future<Status> execute(Executor *executor);
+
     QueryContext *qctx_{nullptr};
-    std::unordered_map<std::string, PassThroughData> passThroughPromiseMap_;
+    std::unordered_map<Executor *, std::unique_ptr<TaskGraph>> graphs_;
 };
 
 }   // namespace graph
@@ -46,5 +46,37 @@ DEFINE_string(auth_type, "password", "User login authentication type,"
 
 DEFINE_string(cloud_http_url, "", "cloud http url including ip, port, url path");
 DEFINE_uint32(max_allowed_statements, 512, "Max allowed sequential statements");
+DEFINE_uint32(max_prepared_statements_per_session, 128,
+              "Max prepared statements kept by a session");
 
 DEFINE_bool(enable_optimizer, false, "Whether to enable optimizer");
+
+DEFINE_int32(scan_parts_concurrency, 8,
+             "Max partitions scanned at the same time by a full scan of a tag");
+DEFINE_int64(scan_batch_size, 1024, "Max vertices returned by a scan request of a partition");
+
+DEFINE_bool(enable_lightweight_profiling, true,
+            "Whether to collect the per-operator stats of all queries, not only PROFILE");
+DEFINE_int64(slow_query_threshold_us, 1000000,
+             "Queries whose latency reaches the threshold are logged as slow, -1 to disable");
+DEFINE_int32(slow_query_log_capacity, 100, "Max number of slow queries kept in memory");
+
+DEFINE_bool(enable_neighbor_cache, false,
+            "Whether to cache the neighbors of the vertices got from the storage");
+DEFINE_int64(neighbor_cache_capacity_mb, 256, "Approximate memory limit of the neighbor cache");
+DEFINE_int32(neighbor_cache_ttl_secs, 60,
+             "How long a cached neighbor is valid, which bounds the staleness of the writes "
+             "not issued through this graphd");
+DEFINE_bool(enable_vertex_cache, false,
+            "Whether to cache the props of the vertices got from the storage");
+DEFINE_int64(vertex_cache_capacity_mb, 256, "Approximate memory limit of the vertex cache");
+DEFINE_int32(vertex_cache_ttl_secs, 60,
+             "How long a cached vertex is valid, which bounds the staleness of the writes "
+             "not issued through this graphd");
+DEFINE_bool(enable_query_result_cache, false,
+            "Whether to cache the results of the read-only queries");
+DEFINE_int64(query_result_cache_capacity_mb, 64,
+             "Approximate memory limit of the query result cache");
+DEFINE_int32(query_result_cache_ttl_secs, 10,
+             "How long a cached query result is valid, which bounds the staleness of the writes "
+             "not issued through this graphd");
@@ -34,8 +34,29 @@ DECLARE_bool(enable_authorize);
 DECLARE_string(auth_type);
 DECLARE_string(cloud_http_url);
 DECLARE_uint32(max_allowed_statements);
+DECLARE_uint32(max_prepared_statements_per_session);
 
 // optimizer
 DECLARE_bool(enable_optimizer);
 
+// full scan
+DECLARE_int32(scan_parts_concurrency);
+DECLARE_int64(scan_batch_size);
+
+// profiling
+DECLARE_bool(enable_lightweight_profiling);
+DECLARE_int64(slow_query_threshold_us);
+DECLARE_int32(slow_query_log_capacity);
+
+// cache
+DECLARE_bool(enable_neighbor_cache);
+DECLARE_int64(neighbor_cache_capacity_mb);
+DECLARE_int32(neighbor_cache_ttl_secs);
+DECLARE_bool(enable_vertex_cache);
+DECLARE_int64(vertex_cache_capacity_mb);
+DECLARE_int32(vertex_cache_ttl_secs);
+DECLARE_bool(enable_query_result_cache);
+DECLARE_int64(query_result_cache_capacity_mb);
+DECLARE_int32(query_result_cache_ttl_secs);
+
 #endif   // GRAPH_GRAPHFLAGS_H_
@@ -20,6 +20,7 @@ namespace graph {
 Status GraphService::init(std::shared_ptr<folly::IOThreadPoolExecutor> ioExecutor) {
     sessionManager_ = std::make_unique<SessionManager>();
     queryEngine_ = std::make_unique<QueryEngine>();
+    GraphStats::init();
 
     return queryEngine_->init(std::move(ioExecutor));
 }
@@ -63,25 +64,72 @@ folly::Future<cpp2::ExecutionResponse>
 GraphService::future_execute(int64_t sessionId, const std::string& query) {
     auto ctx = std::make_unique<RequestContext<cpp2::ExecutionResponse>>();
     ctx->setQuery(query);
-    ctx->setRunner(getThreadManager());
     auto future = ctx->future();
-    {
-        auto result = sessionManager_->findSession(sessionId);
-        if (!result.ok()) {
-            FLOG_ERROR("Session not found, id[%ld]", sessionId);
-            ctx->resp().set_error_code(cpp2::ErrorCode::E_SESSION_INVALID);
-            // ctx->resp().set_error_msg(result.status().toString());
-            ctx->finish();
-            return future;
-        }
-        ctx->setSession(std::move(result).value());
+    if (initRequest(sessionId, ctx.get())) {
+        queryEngine_->execute(std::move(ctx));
     }
-    queryEngine_->execute(std::move(ctx));
 
     return future;
 }
 
 
+folly::Future<cpp2::ExecutionResponse>
+GraphService::future_prepare(int64_t sessionId, const std::string& query) {
+    auto ctx = std::make_unique<RequestContext<cpp2::ExecutionResponse>>();
+    ctx->setQuery(query);
+    auto future = ctx->future();
+    if (initRequest(sessionId, ctx.get())) {
+        queryEngine_->prepare(std::move(ctx));
+    }
+
+    return future;
+}
+
+
+folly::Future<cpp2::ExecutionResponse>
+GraphService::future_executePrepared(int64_t sessionId,
+                                     int64_t stmtId,
+                                     const std::unordered_map<std::string, Value>& params) {
+    auto ctx = std::make_unique<RequestContext<cpp2::ExecutionResponse>>();
+    auto future = ctx->future();
+    if (!initRequest(sessionId, ctx.get())) {
+        return future;
+    }
+    auto stmt = ctx->session()->findPreparedStatement(stmtId);
+    if (stmt == nullptr) {
+        ctx->resp().set_error_code(cpp2::ErrorCode::E_EXECUTION_ERROR);
+        ctx->resp().set_error_msg(
+            folly::stringPrintf("Prepared statement not found, id[%ld]", stmtId));
+        ctx->finish();
+        return future;
+    }
+    // For the query log
+    ctx->setQuery(stmt->stmt());
+    queryEngine_->executePrepared(std::move(ctx), std::move(stmt), params);
+
+    return future;
+}
+
+
+bool GraphService::initRequest(int64_t sessionId, RequestContext<cpp2::ExecutionResponse>* ctx) {
+    // The thread manager is only available once the server is running
+    std::call_once(runnerFlag_, [this]() {
+        runner_ = std::make_unique<QueueWaitRecorder>(getThreadManager());
+    });
+    ctx->setRunner(runner_.get());
+    auto result = sessionManager_->findSession(sessionId);
+    if (!result.ok()) {
+        FLOG_ERROR("Session not found, id[%ld]", sessionId);
+        ctx->resp().set_error_code(cpp2::ErrorCode::E_SESSION_INVALID);
+        // ctx->resp().set_error_msg(result.status().toString());
+        ctx->finish();
+        return false;
+    }
+    ctx->setSession(std::move(result).value());
+    return true;
+}
+
+
 const char* GraphService::getErrorStr(cpp2::ErrorCode result) {
     switch (result) {
     case cpp2::ErrorCode::SUCCEEDED:
@@ -12,6 +12,7 @@
 #include "service/Authenticator.h"
 #include "service/QueryEngine.h"
 #include "service/SessionManager.h"
+#include "util/GraphStats.h"
 
 namespace folly {
 class IOThreadPoolExecutor;
@@ -36,6 +37,19 @@ public:
     folly::Future<cpp2::ExecutionResponse>
     future_execute(int64_t sessionId, const std::string& stmt) override;
 
+    // The vids of the statement could be the parameters, e.g. `$id'. Responds
+    // the id of the statement and the types of the parameters.
+    // TODO: expose them in the IDL
+    folly::Future<cpp2::ExecutionResponse>
+    future_prepare(int64_t sessionId, const std::string& stmt);
+
+    // Run the plan of the prepared statement without parsing or validating,
+    // the parameters are the names without `$' to the values
+    folly::Future<cpp2::ExecutionResponse>
+    future_executePrepared(int64_t sessionId,
+                           int64_t stmtId,
+                           const std::unordered_map<std::string, Value>& params);
+
     const char* getErrorStr(cpp2::ErrorCode result);
 
 private:
@@ -43,8 +57,14 @@ private:
 
     bool auth(const std::string& username, const std::string& password);
 
+    // Attach the session to the request, or finish it if the session is invalid
+    bool initRequest(int64_t sessionId, RequestContext<cpp2::ExecutionResponse>* ctx);
+
     std::unique_ptr<SessionManager>             sessionManager_;
     std::unique_ptr<QueryEngine>                queryEngine_;
+    // Wraps the worker thread pool to collect the queue wait time
+    std::unique_ptr<QueueWaitRecorder>          runner_;
+    std::once_flag                              runnerFlag_;
 };
 
 }   // namespace graph
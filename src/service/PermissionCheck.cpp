@@ -157,14 +157,15 @@ Status PermissionCheck::permissionCheck(Session *session,
             return PermissionManager::canReadSpace(session, targetSpace);
         }
         case Sentence::Kind::kShowUsers:
-        case Sentence::Kind::kShowSnapshots: {
+        case Sentence::Kind::kShowSnapshots:
+        case Sentence::Kind::kShowQueries: {
             /**
              * Only GOD role can be show.
              */
             if (session->isGod()) {
                 return Status::OK();
             } else {
-                return Status::PermissionError("No permission to show users/snapshots");
+                return Status::PermissionError("No permission to show users/snapshots/queries");
             }
         }
         case Sentence::Kind::kChangePassword : {
@@ -70,5 +70,36 @@ void QueryEngine::execute(RequestContextPtr rctx) {
     instance->execute();
 }
 
+void QueryEngine::prepare(RequestContextPtr rctx) {
+    auto qctx = std::make_unique<QueryContext>(std::move(rctx),
+                                               schemaManager_.get(),
+                                               indexManager_.get(),
+                                               storage_.get(),
+                                               metaClient_.get(),
+                                               charsetInfo_);
+    auto* instance = new QueryInstance(std::move(qctx), optimizer_.get());
+    instance->prepare();
+}
+
+void QueryEngine::executePrepared(RequestContextPtr rctx,
+                                  std::shared_ptr<PreparedStatement> stmt,
+                                  const std::unordered_map<std::string, Value>& params) {
+    if (!stmt->acquire()) {
+        // Its plan is running, so plan the statement again just for this execution
+        auto qctx = std::make_unique<QueryContext>(std::move(rctx),
+                                                   schemaManager_.get(),
+                                                   indexManager_.get(),
+                                                   storage_.get(),
+                                                   metaClient_.get(),
+                                                   charsetInfo_);
+        auto* instance = new QueryInstance(std::move(qctx), optimizer_.get());
+        instance->executeWithParams(stmt->space(), params);
+        return;
+    }
+    stmt->qctx()->setRCtx(std::move(rctx));
+    auto* instance = new QueryInstance(std::move(stmt), optimizer_.get());
+    instance->executePrepared(params);
+}
+
 }   // namespace graph
 }   // namespace nebula
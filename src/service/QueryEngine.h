@@ -18,13 +18,14 @@
 #include "common/clients/storage/GraphStorageClient.h"
 #include "common/network/NetworkUtils.h"
 #include "common/charset/Charset.h"
+#include "context/PreparedStatement.h"
 #include "optimizer/Optimizer.h"
 #include <folly/executors/IOThreadPoolExecutor.h>
 
 /**
  * QueryEngine is responsible to create and manage ExecutionPlan.
- * For the time being, we don't have the execution plan cache support,
- * instead we create a plan for each query, and destroy it upon finish.
+ * We create a plan for each query, and destroy it upon finish, except the
+ * plans of the prepared statements, which are kept by the sessions.
  */
 
 namespace nebula {
@@ -40,6 +41,16 @@ public:
     using RequestContextPtr = std::unique_ptr<RequestContext<cpp2::ExecutionResponse>>;
     void execute(RequestContextPtr rctx);
 
+    // Prepare the query of the request, whose vids could be the parameters,
+    // e.g. `GO FROM $id OVER like'
+    void prepare(RequestContextPtr rctx);
+
+    // Run the prepared statement with the parameters, its plan is made again
+    // for this execution if it is running
+    void executePrepared(RequestContextPtr rctx,
+                         std::shared_ptr<PreparedStatement> stmt,
+                         const std::unordered_map<std::string, Value>& params);
+
     const meta::MetaClient* metaClient() const {
         return metaClient_.get();
     }
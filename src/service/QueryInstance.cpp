@@ -7,13 +7,19 @@
 #include "service/QueryInstance.h"
 
 #include "common/base/Base.h"
+#include "common/time/Duration.h"
+#include "context/QueryLog.h"
+#include "context/QueryResultCache.h"
 #include "executor/ExecutionError.h"
 #include "executor/Executor.h"
 #include "optimizer/OptRule.h"
 #include "parser/ExplainSentence.h"
+#include "parser/SequentialSentences.h"
 #include "planner/ExecutionPlan.h"
 #include "planner/PlanNode.h"
 #include "scheduler/Scheduler.h"
+#include "service/PermissionCheck.h"
+#include "util/GraphStats.h"
 #include "validator/Validator.h"
 
 using nebula::opt::Optimizer;
@@ -29,7 +35,28 @@ QueryInstance::QueryInstance(std::unique_ptr<QueryContext> qctx, Optimizer *opti
     scheduler_ = std::make_unique<Scheduler>(qctx_.get());
 }
 
+QueryInstance::QueryInstance(std::shared_ptr<PreparedStatement> stmt, Optimizer *optimizer) {
+    prepared_ = std::move(stmt);
+    optimizer_ = DCHECK_NOTNULL(optimizer);
+    scheduler_ = std::make_unique<Scheduler>(prepared_->qctx());
+}
+
+QueryInstance::~QueryInstance() {
+    if (prepared_ != nullptr) {
+        prepared_->release();
+    }
+}
+
 void QueryInstance::execute() {
+    auto *rctx = qctx()->rctx();
+    auto *session = rctx->session();
+    queryId_ = QueryLog::instance().onStart(
+        session->id(), session->user(), session->space().name, rctx->query());
+
+    if (finishFromResultCache()) {
+        return;
+    }
+
     Status status = validateAndOptimize();
     if (!status.ok()) {
         onError(std::move(status));
@@ -41,7 +68,169 @@ void QueryInstance::execute() {
         return;
     }
 
+    schedule();
+}
+
+void QueryInstance::prepare() {
+    auto *rctx = qctx()->rctx();
+    auto *session = rctx->session();
+    queryId_ = QueryLog::instance().onStart(
+        session->id(), session->user(), session->space().name, rctx->query());
+
+    auto stmt = session->findPreparedStatement(session->space().id, rctx->query());
+    if (stmt == nullptr) {
+        // Taken before planning, so the plan is never older than it
+        auto version = PreparedStatement::schemaVersion(qctx(), session->space().id);
+        if (!version.ok()) {
+            onError(std::move(version).status());
+            return;
+        }
+        qctx_->setParamSlots(std::make_unique<ParamSlots>());
+        auto status = validateAndOptimize();
+        if (!status.ok()) {
+            onError(std::move(status));
+            return;
+        }
+        stmt = std::make_shared<PreparedStatement>(rctx->query(),
+                                                   std::move(sentence_),
+                                                   std::move(qctx_),
+                                                   session->space().id,
+                                                   std::move(version).value());
+        // Held by this query until it's finished
+        stmt->acquire();
+        prepared_ = stmt;
+        auto id = session->addPreparedStatement(stmt);
+        if (!id.ok()) {
+            onError(std::move(id).status());
+            return;
+        }
+        if (id.value() != stmt->id()) {
+            // Someone else prepared it at the same time
+            stmt = session->findPreparedStatement(id.value());
+        }
+    }
+
+    DataSet result({"id", "parameters"});
+    Map params;
+    for (auto &param : stmt->params()) {
+        params.kvs.emplace(param.first,
+                           meta::cpp2::_PropertyType_VALUES_TO_NAMES.at(param.second));
+    }
+    result.emplace_back(Row({stmt->id(), Value(std::move(params))}));
+    rctx->resp().set_data(std::move(result));
+    rctx->resp().set_space_name(session->space().name);
+    auto latency = rctx->duration().elapsedInUSec();
+    rctx->resp().set_latency_in_us(latency);
+    rctx->finish();
+    addQueryLog(latency, Status::OK());
+    delete this;
+}
+
+void QueryInstance::executePrepared(const std::unordered_map<std::string, Value> &params) {
+    auto *rctx = qctx()->rctx();
+    auto *session = rctx->session();
+    queryId_ = QueryLog::instance().onStart(
+        session->id(), session->user(), session->space().name, rctx->query());
+
+    if (prepared_->space() != session->space().id) {
+        onError(Status::SemanticError("The statement is prepared in another space"));
+        return;
+    }
+    auto status = checkPreparedPermission();
+    if (!status.ok()) {
+        onError(std::move(status));
+        return;
+    }
+    auto version = PreparedStatement::schemaVersion(qctx(), prepared_->space());
+    if (!version.ok()) {
+        onError(std::move(version).status());
+        return;
+    }
+    if (version.value() != prepared_->schemaVersion()) {
+        status = replan(std::move(version).value());
+        if (!status.ok()) {
+            onError(std::move(status));
+            return;
+        }
+    }
+    status = prepared_->bind(params);
+    if (!status.ok()) {
+        onError(std::move(status));
+        return;
+    }
+    schedule();
+}
+
+void QueryInstance::executeWithParams(GraphSpaceID space,
+                                      const std::unordered_map<std::string, Value> &params) {
+    auto *rctx = qctx()->rctx();
+    auto *session = rctx->session();
+    queryId_ = QueryLog::instance().onStart(
+        session->id(), session->user(), session->space().name, rctx->query());
+
+    if (space != session->space().id) {
+        onError(Status::SemanticError("The statement is prepared in another space"));
+        return;
+    }
+    // The permission is checked by the validators
+    qctx_->setParamSlots(std::make_unique<ParamSlots>());
+    auto status = validateAndOptimize();
+    if (!status.ok()) {
+        onError(std::move(status));
+        return;
+    }
+    // Bound as PreparedStatement::bind does
+    auto values = qctx_->ectx()->latestValues();
+    status = qctx_->paramSlots()->bind(params, &values);
+    if (!status.ok()) {
+        onError(std::move(status));
+        return;
+    }
+    qctx_->resetExecution();
+    auto *ectx = qctx_->ectx();
+    for (auto &kv : values) {
+        ectx->setResult(kv.first, ResultBuilder().value(std::move(kv.second)).finish());
+    }
+    schedule();
+}
+
+Status QueryInstance::checkPreparedPermission() const {
+    auto *session = qctx()->rctx()->session();
+    auto *sentence = prepared_->sentence();
+    // Checked by each of the sentences as the validators do
+    if (sentence->kind() == Sentence::Kind::kSequential) {
+        for (auto *s : static_cast<SequentialSentences *>(sentence)->sentences()) {
+            NG_RETURN_IF_ERROR(PermissionCheck::permissionCheck(session, s, prepared_->space()));
+        }
+        return Status::OK();
+    }
+    return PermissionCheck::permissionCheck(session, sentence, prepared_->space());
+}
+
+Status QueryInstance::replan(std::string schemaVersion) {
+    VLOG(1) << "Plan the prepared statement again: " << prepared_->stmt();
+    auto *old = prepared_->qctx();
+    // Until it's replaced, the new context holds the request
+    qctx_ = std::make_unique<QueryContext>(old->moveRCtx(),
+                                           old->schemaMng(),
+                                           old->indexMng(),
+                                           old->getStorageClient(),
+                                           old->getMetaClient(),
+                                           old->getCharsetInfo());
+    qctx_->setParamSlots(std::make_unique<ParamSlots>());
+    NG_RETURN_IF_ERROR(validateAndOptimize());
+    scheduler_ = std::make_unique<Scheduler>(qctx_.get());
+    prepared_->replan(std::move(sentence_), std::move(qctx_), std::move(schemaVersion));
+    return Status::OK();
+}
+
+void QueryInstance::schedule() {
+    time::Duration executeTime;
     scheduler_->schedule()
+        .ensure([executeTime]() {
+            GraphStats::addPhaseLatency(GraphStats::Phase::kExecute,
+                                        executeTime.elapsedInUSec());
+        })
         .then([this](Status s) {
             if (s.ok()) {
                 this->onFinish();
@@ -56,16 +245,47 @@ void QueryInstance::execute() {
 Status QueryInstance::validateAndOptimize() {
     auto *rctx = qctx()->rctx();
     VLOG(1) << "Parsing query: " << rctx->query();
-    auto result = GQLParser().parse(rctx->query());
+    time::Duration phaseTime;
+    auto result = GQLParser::threadLocal().parse(rctx->query());
+    GraphStats::addPhaseLatency(GraphStats::Phase::kParse, phaseTime.elapsedInUSec());
     NG_RETURN_IF_ERROR(result);
     sentence_ = std::move(result).value();
+    if (qctx()->paramSlots() != nullptr && !QueryResultCache::isCacheable(sentence_.get())) {
+        // The same as the cacheable ones, whose plans only depend on the data
+        return Status::SemanticError("Only the read-only queries could be prepared");
+    }
+    if (QueryResultCache::enabled()) {
+        cacheable_ = !cacheRole_.empty() && QueryResultCache::isCacheable(sentence_.get()) &&
+                     QueryResultCache::isDeterministic(cacheQuery_);
+        mayModify_ = QueryResultCache::mayModify(sentence_.get());
+        if (mayModify_) {
+            // Resolved before running, e.g. the space dropped is unknown after
+            auto space = rctx->session()->space().name;
+            std::vector<std::string> spaces;
+            if (QueryResultCache::modifiedSpaces(sentence_.get(), &space, &spaces)) {
+                for (auto &name : spaces) {
+                    auto spaceId = qctx()->schemaMng()->toGraphSpaceID(name);
+                    if (!spaceId.ok()) {
+                        modifiedSpaces_.clear();
+                        break;
+                    }
+                    modifiedSpaces_.emplace_back(spaceId.value());
+                }
+            }
+        }
+    }
 
-    NG_RETURN_IF_ERROR(Validator::validate(sentence_.get(), qctx()));
+    phaseTime.reset();
+    auto validateStatus = Validator::validate(sentence_.get(), qctx());
+    GraphStats::addPhaseLatency(GraphStats::Phase::kValidate, phaseTime.elapsedInUSec());
+    NG_RETURN_IF_ERROR(validateStatus);
 
-    auto rootStatus = optimizer_->findBestPlan(qctx_.get());
+    phaseTime.reset();
+    auto rootStatus = optimizer_->findBestPlan(qctx());
+    GraphStats::addPhaseLatency(GraphStats::Phase::kOptimize, phaseTime.elapsedInUSec());
     NG_RETURN_IF_ERROR(rootStatus);
     auto newRoot = std::move(rootStatus).value();
-    qctx_->setPlan(std::make_unique<ExecutionPlan>(const_cast<PlanNode *>(newRoot)));
+    qctx()->setPlan(std::make_unique<ExecutionPlan>(const_cast<PlanNode *>(newRoot)));
 
     return Status::OK();
 }
@@ -92,6 +312,10 @@ void QueryInstance::onFinish() {
         if (value.type() == Value::Type::DATASET) {
             auto result = value.moveDataSet();
             if (!result.colNames.empty()) {
+                // The result missing some of the parts is not reused
+                if (cacheable_ && !qctx()->partialSuccess()) {
+                    updateResultCache(&result);
+                }
                 rctx->resp().set_data(std::move(result));
             } else {
                 LOG(ERROR) << "Empty column name list";
@@ -105,7 +329,12 @@ void QueryInstance::onFinish() {
         rctx->resp().set_plan_desc(std::move(*qctx()->planDescription()));
     }
 
+    if (mayModify_) {
+        updateResultCache(nullptr);
+    }
+
     rctx->finish();
+    addQueryLog(latency, Status::OK());
 
     // The `QueryInstance' is the root node holding all resources during the execution.
     // When the whole query process is done, it's safe to release this object, as long as
@@ -158,9 +387,82 @@ void QueryInstance::onError(Status status) {
     rctx->resp().set_error_msg(status.toString());
     auto latency = rctx->duration().elapsedInUSec();
     rctx->resp().set_latency_in_us(latency);
+    // The failed mutation may be applied partially
+    if (mayModify_) {
+        updateResultCache(nullptr);
+    }
     rctx->finish();
+    addQueryLog(latency, status);
     delete this;
 }
 
+void QueryInstance::addQueryLog(int64_t latency, const Status &status) {
+    // Only described for the slow ones, it's not cheap
+    std::shared_ptr<cpp2::PlanDescription> plan;
+    auto *ep = qctx()->plan();
+    if (QueryLog::isSlow(latency) && ep != nullptr && ep->root() != nullptr) {
+        plan = std::make_shared<cpp2::PlanDescription>();
+        ep->fillPlanDescription(plan.get());
+    }
+    QueryLog::instance().onFinish(
+        queryId_, latency, status, qctx()->moveOperatorStats(), std::move(plan));
+}
+
+bool QueryInstance::finishFromResultCache() {
+    if (!QueryResultCache::enabled()) {
+        return false;
+    }
+    auto *rctx = qctx()->rctx();
+    auto *session = rctx->session();
+    auto &space = session->space();
+    if (space.id == kInvalidSpaceID) {
+        return false;
+    }
+    // The users without a role in the space are left to the permission check
+    if (session->isGod()) {
+        cacheRole_ = "GOD";
+    } else {
+        auto role = session->roleWithSpace(space.id);
+        if (!role.ok()) {
+            return false;
+        }
+        cacheRole_ = meta::cpp2::_RoleType_VALUES_TO_NAMES.at(role.value());
+    }
+    cacheQuery_ = QueryResultCache::normalize(rctx->query());
+    auto &cache = QueryResultCache::instance();
+    cacheVersion_ = cache.version();
+    auto result = cache.get(space.id, cacheRole_, cacheQuery_);
+    if (result == nullptr) {
+        return false;
+    }
+
+    VLOG(1) << "Finish query from the result cache: " << rctx->query();
+    rctx->resp().set_data(*result);
+    rctx->resp().set_space_name(space.name);
+    auto latency = rctx->duration().elapsedInUSec();
+    rctx->resp().set_latency_in_us(latency);
+    rctx->finish();
+    addQueryLog(latency, Status::OK());
+    delete this;
+    return true;
+}
+
+void QueryInstance::updateResultCache(const DataSet *result) {
+    auto *session = qctx()->rctx()->session();
+    auto &cache = QueryResultCache::instance();
+    if (mayModify_) {
+        if (modifiedSpaces_.empty()) {
+            cache.clear();
+        }
+        for (auto space : modifiedSpaces_) {
+            cache.invalidate(space);
+        }
+        return;
+    }
+    if (cacheable_ && result != nullptr) {
+        cache.put(session->space().id, cacheRole_, cacheQuery_, cacheVersion_, *result);
+    }
+}
+
 }   // namespace graph
 }   // namespace nebula
@@ -10,6 +10,7 @@
 #include "common/base/Base.h"
 #include "common/base/Status.h"
 #include "common/cpp/helpers.h"
+#include "context/PreparedStatement.h"
 #include "context/QueryContext.h"
 #include "optimizer/Optimizer.h"
 #include "parser/GQLParser.h"
@@ -27,10 +28,22 @@ namespace graph {
 class QueryInstance final : public cpp::NonCopyable, public cpp::NonMovable {
 public:
     explicit QueryInstance(std::unique_ptr<QueryContext> qctx, opt::Optimizer* optimizer);
-    ~QueryInstance() = default;
+    // Run the prepared statement, which has been acquired
+    QueryInstance(std::shared_ptr<PreparedStatement> stmt, opt::Optimizer* optimizer);
+    ~QueryInstance();
 
     void execute();
 
+    // Validate and optimize the query with parameters, and keep it in the session
+    void prepare();
+
+    void executePrepared(const std::unordered_map<std::string, Value>& params);
+
+    // Plan the query of a prepared statement, which is running, and run it
+    // once with the parameters
+    void executeWithParams(GraphSpaceID space,
+                           const std::unordered_map<std::string, Value>& params);
+
     /**
      * If the whole execution was done, `onFinish' would be invoked.
      * All `onFinish' should do is to ask `executor_' to fill the `qctx()->rctx()->resp()',
@@ -45,18 +58,47 @@ public:
     void onError(Status);
 
     QueryContext* qctx() const {
-        return qctx_.get();
+        return qctx_ != nullptr ? qctx_.get() : prepared_->qctx();
     }
 
 private:
     Status validateAndOptimize();
+    // The role of the user may be changed since the statement is prepared
+    Status checkPreparedPermission() const;
+    // Plan the prepared statement again for the changed schema
+    Status replan(std::string schemaVersion);
+    // Run the plan
+    void schedule();
     // return true if continue to execute
     bool explainOrContinue();
 
+    // Report the finished query to the query log
+    void addQueryLog(int64_t latency, const Status& status);
+
+    // Answer the query by the cached result, returns false if missed
+    bool finishFromResultCache();
+
+    // Cache the result of the read-only query, or drop the cached results
+    // which the query may have changed
+    void updateResultCache(const DataSet* result);
+
     std::unique_ptr<Sentence>                   sentence_;
     std::unique_ptr<QueryContext>               qctx_;
+    // Holds the qctx instead if preparing or running a prepared statement,
+    // unless it's planned again
+    std::shared_ptr<PreparedStatement>          prepared_;
     std::unique_ptr<Scheduler>                  scheduler_;
     opt::Optimizer*                             optimizer_{nullptr};
+    int64_t                                     queryId_{0};
+    // The normalized query and the role of the user, empty if not cacheable
+    std::string                                 cacheQuery_;
+    std::string                                 cacheRole_;
+    int64_t                                     cacheVersion_{0};
+    bool                                        cacheable_{false};
+    bool                                        mayModify_{false};
+    // The spaces whose results are dropped after the modification, all the
+    // spaces if empty
+    std::vector<GraphSpaceID>                   modifiedSpaces_;
 };
 
 }   // namespace graph
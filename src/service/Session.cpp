@@ -6,11 +6,15 @@
 
 #include "service/Session.h"
 
+#include "context/PreparedStatement.h"
+#include "service/GraphFlags.h"
+
 namespace nebula {
 namespace graph {
 
 Session::Session(int64_t id) {
     id_ = id;
+    charge();
 }
 
 std::shared_ptr<Session> Session::create(int64_t id) {
@@ -18,11 +22,44 @@ std::shared_ptr<Session> Session::create(int64_t id) {
 }
 
 void Session::charge() {
-    idleDuration_.reset();
+    lastActiveTime_.store(time::WallClock::fastNowInMilliSec(), std::memory_order_relaxed);
 }
 
 uint64_t Session::idleSeconds() const {
-    return idleDuration_.elapsedInSec();
+    auto idle = time::WallClock::fastNowInMilliSec() - lastActiveTime();
+    return idle > 0 ? idle / 1000 : 0;
+}
+
+StatusOr<int64_t> Session::addPreparedStatement(std::shared_ptr<PreparedStatement> stmt) {
+    folly::SpinLockGuard g(preparedLock_);
+    auto key = std::make_pair(stmt->space(), stmt->stmt());
+    auto found = preparedIds_.find(key);
+    if (found != preparedIds_.end()) {
+        return found->second;
+    }
+    if (prepared_.size() >= FLAGS_max_prepared_statements_per_session) {
+        return Status::Error("Too many prepared statements in the session, at most %u",
+                             FLAGS_max_prepared_statements_per_session);
+    }
+    auto id = ++lastPreparedId_;
+    stmt->setId(id);
+    preparedIds_.emplace(std::move(key), id);
+    prepared_.emplace(id, std::move(stmt));
+    return id;
+}
+
+std::shared_ptr<PreparedStatement> Session::findPreparedStatement(int64_t id) const {
+    folly::SpinLockGuard g(preparedLock_);
+    auto found = prepared_.find(id);
+    return found == prepared_.end() ? nullptr : found->second;
+}
+
+std::shared_ptr<PreparedStatement> Session::findPreparedStatement(GraphSpaceID space,
+                                                                  const std::string& stmt) const {
+    folly::SpinLockGuard g(preparedLock_);
+    auto found = preparedIds_.find(std::make_pair(space, stmt));
+    return found == preparedIds_.end() ? nullptr : prepared_.at(found->second);
 }
+
 }  // namespace graph
 }  // namespace nebula
@@ -6,14 +6,18 @@
 #ifndef COMMON_SESSION_H_
 #define COMMON_SESSION_H_
 
+#include <folly/SpinLock.h>
+
 #include "common/base/Base.h"
 #include "common/clients/meta/MetaClient.h"
 #include "common/interface/gen-cpp2/meta_types.h"
-#include "common/time/Duration.h"
+#include "common/time/WallClock.h"
 
 namespace nebula {
 namespace graph {
 
+class PreparedStatement;
+
 constexpr int64_t kInvalidSpaceID = -1;
 constexpr int64_t kInvalidSessionID = 0;
 
@@ -76,8 +80,24 @@ public:
 
     uint64_t idleSeconds() const;
 
+    // In milliseconds of the WallClock
+    int64_t lastActiveTime() const {
+        return lastActiveTime_.load(std::memory_order_relaxed);
+    }
+
+    // Thread safe, called by every request of the session
     void charge();
 
+    // Returns the id of the statement, or of the one prepared before with the
+    // same text in the same space. At most FLAGS_max_prepared_statements_per_session of them.
+    StatusOr<int64_t> addPreparedStatement(std::shared_ptr<PreparedStatement> stmt);
+
+    // Returns nullptr if not found
+    std::shared_ptr<PreparedStatement> findPreparedStatement(int64_t id) const;
+
+    std::shared_ptr<PreparedStatement> findPreparedStatement(GraphSpaceID space,
+                                                             const std::string& stmt) const;
+
 private:
     Session() = default;
     explicit Session(int64_t id);
@@ -87,13 +107,19 @@ private:
     int64_t           id_{kInvalidSessionID};
     SpaceInfo         space_;
     std::string       account_;
-    time::Duration    idleDuration_;
+    std::atomic<int64_t>    lastActiveTime_{0};
     /*
      * map<spaceId, role>
      * One user can have roles in multiple spaces
      * But a user has only one role in one space
      */
     std::unordered_map<GraphSpaceID, meta::cpp2::RoleType> roles_;
+
+    mutable folly::SpinLock                                             preparedLock_;
+    int64_t                                                             lastPreparedId_{0};
+    std::unordered_map<int64_t, std::shared_ptr<PreparedStatement>>     prepared_;
+    // (space, statement) -> id
+    std::map<std::pair<GraphSpaceID, std::string>, int64_t>             preparedIds_;
 };
 
 }  // namespace graph
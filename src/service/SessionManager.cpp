@@ -5,13 +5,19 @@
  */
 
 #include "common/base/Base.h"
+#include "common/time/WallClock.h"
 #include "service/SessionManager.h"
 #include "service/GraphFlags.h"
 
 namespace nebula {
 namespace graph {
 
+constexpr size_t SessionManager::kShards;
+constexpr int64_t SessionManager::kWheelSlots;
+
 SessionManager::SessionManager() {
+    startTime_ = time::WallClock::fastNowInMilliSec();
+    tickInMs_ = std::max<int64_t>(FLAGS_session_reclaim_interval_secs * 1000L, 1L);
     scavenger_ = std::make_unique<thread::GenericWorker>();
     auto ok = scavenger_->start("session-manager");
     DCHECK(ok);
@@ -31,9 +37,10 @@ SessionManager::~SessionManager() {
 
 StatusOr<std::shared_ptr<Session>>
 SessionManager::findSession(int64_t id) {
-    folly::RWSpinLock::ReadHolder holder(rwlock_);
-    auto iter = activeSessions_.find(id);
-    if (iter == activeSessions_.end()) {
+    auto &s = shard(id);
+    folly::RWSpinLock::ReadHolder holder(s.lock);
+    auto iter = s.sessions.find(id);
+    if (iter == s.sessions.end()) {
         return Status::Error("Session `%ld' has expired", id);
     }
     return iter->second;
@@ -41,31 +48,39 @@ SessionManager::findSession(int64_t id) {
 
 
 std::shared_ptr<Session> SessionManager::createSession() {
-    folly::RWSpinLock::WriteHolder holder(rwlock_);
-    auto sid = newSessionId();
+    std::shared_ptr<Session> session;
     while (true) {
-        if (activeSessions_.count(sid) == 0UL) {
+        auto sid = newSessionId();
+        auto &s = shard(sid);
+        folly::RWSpinLock::WriteHolder holder(s.lock);
+        if (s.sessions.count(sid) == 0UL) {
+            DCHECK_NE(sid, 0L);
+            session = Session::create(sid);
+            s.sessions[sid] = session;
             break;
         }
         // This ID is in use already, try another one
-        sid = newSessionId();
     }
-    DCHECK_NE(sid, 0L);
-    auto session = Session::create(sid);
-    activeSessions_[sid] = session;
     session->charge();
+    auto expireAt = nextCheckTime(*session,
+                                  FLAGS_session_idle_timeout_secs * 1000L,
+                                  session->lastActiveTime());
+    folly::SpinLockGuard guard(wheelLock_);
+    schedule(session->id(), expireAt);
     return session;
 }
 
 
 std::shared_ptr<Session> SessionManager::removeSession(int64_t id) {
-    folly::RWSpinLock::WriteHolder holder(rwlock_);
-    auto iter = activeSessions_.find(id);
-    if (iter == activeSessions_.end()) {
+    // It's left in the wheel, and skipped when due
+    auto &s = shard(id);
+    folly::RWSpinLock::WriteHolder holder(s.lock);
+    auto iter = s.sessions.find(id);
+    if (iter == s.sessions.end()) {
         return nullptr;
     }
     auto session = std::move(iter->second);
-    activeSessions_.erase(iter);
+    s.sessions.erase(iter);
     return session;
 }
 
@@ -79,28 +94,89 @@ int64_t SessionManager::newSessionId() {
 }
 
 
-// TODO(dutor) Now we do a brute-force scanning, of course we could make it more efficient.
+void SessionManager::schedule(int64_t id, int64_t expireAt) {
+    // Round up, so it's never checked before expiring
+    auto tick = (expireAt - startTime_ + tickInMs_ - 1) / tickInMs_;
+    tick = std::min(std::max(tick, tick_ + 1), tick_ + kWheelSlots);
+    wheel_[tick % kWheelSlots].emplace_back(id);
+}
+
+
+int64_t SessionManager::nextCheckTime(const Session &session,
+                                      int64_t timeout,
+                                      int64_t now) const {
+    if (timeout > 0) {
+        return session.lastActiveTime() + timeout;
+    }
+    // Never expires, but it's still in the wheel in case the timeout is set later
+    return now + kWheelSlots * tickInMs_;
+}
+
+
 void SessionManager::reclaimExpiredSessions() {
-    if (FLAGS_session_idle_timeout_secs == 0) {
-        return;
+    auto now = time::WallClock::fastNowInMilliSec();
+    auto timeout = FLAGS_session_idle_timeout_secs * 1000L;
+
+    // Take the sessions of the slots due out of the wheel
+    std::vector<int64_t> due;
+    {
+        folly::SpinLockGuard guard(wheelLock_);
+        auto tick = (now - startTime_) / tickInMs_;
+        // All the slots are checked if the scavenger falls behind a whole round
+        auto from = std::max(tick_ + 1, tick - kWheelSlots + 1);
+        for (auto i = from; i <= tick; ++i) {
+            auto &slot = wheel_[i % kWheelSlots];
+            due.insert(due.end(), slot.begin(), slot.end());
+            slot.clear();
+        }
+        tick_ = std::max(tick_, tick);
     }
-    folly::RWSpinLock::WriteHolder holder(rwlock_);
-    if (activeSessions_.empty()) {
+    if (due.empty()) {
         return;
     }
 
-    FVLOG3("Try to reclaim expired sessions out of %lu ones", activeSessions_.size());
-    auto iter = activeSessions_.begin();
-    auto end = activeSessions_.end();
-    while (iter != end) {
-        auto *session = iter->second.get();
-        int32_t idleSecs = session->idleSeconds();
-        if (idleSecs < FLAGS_session_idle_timeout_secs) {
-            ++iter;
+    FVLOG3("Try to reclaim expired sessions out of %lu ones", due.size());
+    std::vector<std::pair<int64_t, int64_t>> alive;
+    for (auto id : due) {
+        auto &s = shard(id);
+        int64_t expireAt = 0;
+        {
+            folly::RWSpinLock::ReadHolder holder(s.lock);
+            auto iter = s.sessions.find(id);
+            if (iter == s.sessions.end()) {
+                // Removed already
+                continue;
+            }
+            expireAt = nextCheckTime(*iter->second, timeout, now);
+        }
+        if (expireAt > now) {
+            alive.emplace_back(id, expireAt);
             continue;
         }
-        FLOG_INFO("Session %ld has expired", session->id());
-        iter = activeSessions_.erase(iter);
+
+        SessionPtr expired;
+        {
+            folly::RWSpinLock::WriteHolder holder(s.lock);
+            auto iter = s.sessions.find(id);
+            if (iter == s.sessions.end()) {
+                continue;
+            }
+            // Charged after checked
+            expireAt = nextCheckTime(*iter->second, timeout, now);
+            if (expireAt > now) {
+                alive.emplace_back(id, expireAt);
+                continue;
+            }
+            expired = std::move(iter->second);
+            s.sessions.erase(iter);
+        }
+        // Released out of the lock
+        FLOG_INFO("Session %ld has expired", expired->id());
+    }
+
+    folly::SpinLockGuard guard(wheelLock_);
+    for (auto &session : alive) {
+        schedule(session.first, session.second);
     }
 }
 
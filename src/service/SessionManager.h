@@ -7,6 +7,8 @@
 #ifndef SERVICE_SESSIONMANAGER_H_
 #define SERVICE_SESSIONMANAGER_H_
 
+#include <folly/SpinLock.h>
+
 #include "common/base/Base.h"
 #include "common/base/StatusOr.h"
 #include "common/thread/GenericWorker.h"
@@ -14,6 +16,12 @@
 
 /**
  * SessionManager manages the client sessions, e.g. create new, find existing and drop expired.
+ *
+ * The sessions are sharded by the id, so the lookups of the queries only share a reader lock
+ * with the sessions in the same shard. The idle sessions are found by a timer wheel instead
+ * of scanning all of them: each session is put into the slot of the tick it would expire at,
+ * and the scavenger only checks the slots due. A session charged meanwhile is rescheduled by
+ * its last activity, and only its shard is locked for writing to drop an expired one.
  */
 
 namespace nebula {
@@ -39,17 +47,44 @@ public:
     SessionPtr removeSession(int64_t id);
 
 private:
+    struct Shard {
+        folly::RWSpinLock                           lock;
+        std::unordered_map<int64_t, SessionPtr>     sessions;
+    };
+
+    static constexpr size_t kShards = 64;
+    // The sessions expiring beyond the wheel are put into the farthest slot,
+    // and rescheduled when it's due
+    static constexpr int64_t kWheelSlots = 64;
+
     /**
      * Generate a non-zero number
      */
     int64_t newSessionId();
 
+    Shard& shard(int64_t id) {
+        return shards_[static_cast<uint64_t>(id) % kShards];
+    }
+
+    // Put the session into the slot of the tick it expires at, with `wheelLock_' held
+    void schedule(int64_t id, int64_t expireAt);
+
+    // When the session expires by the idle timeout in milliseconds, or one round
+    // of the wheel later if the timeout is 0
+    int64_t nextCheckTime(const Session& session, int64_t timeout, int64_t now) const;
+
     void reclaimExpiredSessions();
 
 private:
     std::atomic<int64_t>                        nextId_{0};
-    folly::RWSpinLock                           rwlock_;        // TODO(dutor) writer might starve
-    std::unordered_map<int64_t, SessionPtr>     activeSessions_;
+    std::array<Shard, kShards>                  shards_;
+    folly::SpinLock                             wheelLock_;
+    std::array<std::vector<int64_t>, kWheelSlots>   wheel_;
+    // In milliseconds of the WallClock
+    int64_t                                     startTime_{0};
+    int64_t                                     tickInMs_{1000};
+    // The last tick checked
+    int64_t                                     tick_{0};
     std::unique_ptr<thread::GenericWorker>      scavenger_;
 };
 
@@ -0,0 +1,191 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "service/test/FakeMetaService.h"
+
+#include "common/time/WallClock.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+meta::cpp2::ColumnDef columnDef(const std::string& name,
+                                meta::cpp2::PropertyType type,
+                                int16_t length = 0) {
+    meta::cpp2::ColumnDef column;
+    column.set_name(name);
+    meta::cpp2::ColumnTypeDef typeDef;
+    typeDef.set_type(type);
+    if (length > 0) {
+        typeDef.set_type_length(length);
+    }
+    column.set_type(std::move(typeDef));
+    return column;
+}
+
+meta::cpp2::IndexItem tagIndex(IndexID id,
+                               const std::string& name,
+                               meta::cpp2::ColumnDef field) {
+    meta::cpp2::IndexItem item;
+    item.set_index_id(id);
+    item.set_index_name(name);
+    decltype(item.schema_id) schemaId;
+    schemaId.set_tag_id(SyntheticGraph::kPersonTag);
+    item.set_schema_id(std::move(schemaId));
+    item.set_schema_name(SyntheticGraph::kPersonTagName);
+    item.set_fields({std::move(field)});
+    return item;
+}
+
+}   // namespace
+
+FakeMetaService::FakeMetaService(HostAddr storageAddr, int32_t numParts)
+    : storageAddr_(std::move(storageAddr)),
+      numParts_(numParts),
+      lastUpdateTimeInMs_(time::WallClock::fastNowInMilliSec()) {
+    meta::cpp2::SpaceDesc desc;
+    desc.set_space_name(SyntheticGraph::kSpaceName);
+    desc.set_partition_num(numParts_);
+    desc.set_replica_factor(1);
+    desc.set_charset_name("utf8");
+    desc.set_collate_name("utf8_bin");
+    meta::cpp2::ColumnTypeDef vidType;
+    vidType.set_type(meta::cpp2::PropertyType::FIXED_STRING);
+    vidType.set_type_length(SyntheticGraph::kVidLength);
+    desc.set_vid_type(std::move(vidType));
+    space_.set_space_id(SyntheticGraph::kSpaceId);
+    space_.set_properties(std::move(desc));
+
+    meta::cpp2::Schema personSchema;
+    personSchema.columns.emplace_back(columnDef("name", meta::cpp2::PropertyType::STRING));
+    personSchema.columns.emplace_back(columnDef("age", meta::cpp2::PropertyType::INT64));
+    personTag_.set_tag_id(SyntheticGraph::kPersonTag);
+    personTag_.set_tag_name(SyntheticGraph::kPersonTagName);
+    personTag_.set_version(0);
+    personTag_.set_schema(std::move(personSchema));
+
+    meta::cpp2::Schema knowsSchema;
+    knowsSchema.columns.emplace_back(columnDef("since", meta::cpp2::PropertyType::INT64));
+    knowsEdge_.set_edge_type(SyntheticGraph::kKnowsEdge);
+    knowsEdge_.set_edge_name(SyntheticGraph::kKnowsEdgeName);
+    knowsEdge_.set_version(0);
+    knowsEdge_.set_schema(std::move(knowsSchema));
+
+    // The string field of an index is fixed length
+    tagIndexes_.emplace_back(
+        tagIndex(SyntheticGraph::kNameIndex,
+                 "person_name_index",
+                 columnDef("name", meta::cpp2::PropertyType::FIXED_STRING, 32)));
+    tagIndexes_.emplace_back(tagIndex(SyntheticGraph::kAgeIndex,
+                                      "person_age_index",
+                                      columnDef("age", meta::cpp2::PropertyType::INT64)));
+}
+
+folly::Future<meta::cpp2::HBResp>
+FakeMetaService::future_heartBeat(const meta::cpp2::HBReq&) {
+    auto resp = succeeded<meta::cpp2::HBResp>();
+    resp.set_cluster_id(0);
+    resp.set_last_update_time_in_ms(lastUpdateTimeInMs_);
+    return resp;
+}
+
+folly::Future<meta::cpp2::ListSpacesResp>
+FakeMetaService::future_listSpaces(const meta::cpp2::ListSpacesReq&) {
+    meta::cpp2::IdName space;
+    meta::cpp2::ID id;
+    id.set_space_id(SyntheticGraph::kSpaceId);
+    space.set_id(std::move(id));
+    space.set_name(SyntheticGraph::kSpaceName);
+    auto resp = succeeded<meta::cpp2::ListSpacesResp>();
+    resp.set_spaces({std::move(space)});
+    return resp;
+}
+
+folly::Future<meta::cpp2::GetSpaceResp>
+FakeMetaService::future_getSpace(const meta::cpp2::GetSpaceReq& req) {
+    if (req.get_space_name() != SyntheticGraph::kSpaceName) {
+        return notFound<meta::cpp2::GetSpaceResp>();
+    }
+    auto resp = succeeded<meta::cpp2::GetSpaceResp>();
+    resp.set_item(space_);
+    return resp;
+}
+
+folly::Future<meta::cpp2::GetPartsAllocResp>
+FakeMetaService::future_getPartsAlloc(const meta::cpp2::GetPartsAllocReq& req) {
+    if (req.get_space_id() != SyntheticGraph::kSpaceId) {
+        return notFound<meta::cpp2::GetPartsAllocResp>();
+    }
+    auto resp = succeeded<meta::cpp2::GetPartsAllocResp>();
+    decltype(resp.parts) parts;
+    // The partition id starts from 1
+    for (PartitionID part = 1; part <= numParts_; ++part) {
+        parts[part] = {storageAddr_};
+    }
+    resp.set_parts(std::move(parts));
+    return resp;
+}
+
+folly::Future<meta::cpp2::ListTagsResp>
+FakeMetaService::future_listTags(const meta::cpp2::ListTagsReq& req) {
+    if (req.get_space_id() != SyntheticGraph::kSpaceId) {
+        return notFound<meta::cpp2::ListTagsResp>();
+    }
+    auto resp = succeeded<meta::cpp2::ListTagsResp>();
+    resp.set_tags({personTag_});
+    return resp;
+}
+
+folly::Future<meta::cpp2::ListEdgesResp>
+FakeMetaService::future_listEdges(const meta::cpp2::ListEdgesReq& req) {
+    if (req.get_space_id() != SyntheticGraph::kSpaceId) {
+        return notFound<meta::cpp2::ListEdgesResp>();
+    }
+    auto resp = succeeded<meta::cpp2::ListEdgesResp>();
+    resp.set_edges({knowsEdge_});
+    return resp;
+}
+
+folly::Future<meta::cpp2::ListTagIndexesResp>
+FakeMetaService::future_listTagIndexes(const meta::cpp2::ListTagIndexesReq& req) {
+    if (req.get_space_id() != SyntheticGraph::kSpaceId) {
+        return notFound<meta::cpp2::ListTagIndexesResp>();
+    }
+    auto resp = succeeded<meta::cpp2::ListTagIndexesResp>();
+    resp.set_items(tagIndexes_);
+    return resp;
+}
+
+folly::Future<meta::cpp2::ListEdgeIndexesResp>
+FakeMetaService::future_listEdgeIndexes(const meta::cpp2::ListEdgeIndexesReq& req) {
+    if (req.get_space_id() != SyntheticGraph::kSpaceId) {
+        return notFound<meta::cpp2::ListEdgeIndexesResp>();
+    }
+    return succeeded<meta::cpp2::ListEdgeIndexesResp>();
+}
+
+folly::Future<meta::cpp2::ListUsersResp>
+FakeMetaService::future_listUsers(const meta::cpp2::ListUsersReq&) {
+    auto resp = succeeded<meta::cpp2::ListUsersResp>();
+    decltype(resp.users) users;
+    users.emplace("root", "");
+    resp.set_users(std::move(users));
+    return resp;
+}
+
+folly::Future<meta::cpp2::ListRolesResp>
+FakeMetaService::future_listRoles(const meta::cpp2::ListRolesReq&) {
+    return succeeded<meta::cpp2::ListRolesResp>();
+}
+
+folly::Future<meta::cpp2::ListRolesResp>
+FakeMetaService::future_getUserRoles(const meta::cpp2::GetUserRolesReq&) {
+    return succeeded<meta::cpp2::ListRolesResp>();
+}
+
+}   // namespace graph
+}   // namespace nebula
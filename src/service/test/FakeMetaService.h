@@ -0,0 +1,90 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef SERVICE_TEST_FAKEMETASERVICE_H_
+#define SERVICE_TEST_FAKEMETASERVICE_H_
+
+#include "common/base/Base.h"
+#include "common/interface/gen-cpp2/MetaService.h"
+#include "service/test/SyntheticGraph.h"
+
+namespace nebula {
+namespace graph {
+
+/***************************************************************************
+ *
+ * A read-only metad serving the schema of the SyntheticGraph, with all the
+ * partitions allocated to a single storage host.
+ *
+ * Only the interfaces which the MetaClient of graphd uses to load its cache
+ * and to switch space are implemented, the others fail as unimplemented.
+ *
+ **************************************************************************/
+class FakeMetaService final : public meta::cpp2::MetaServiceSvIf {
+public:
+    FakeMetaService(HostAddr storageAddr, int32_t numParts);
+
+    folly::Future<meta::cpp2::HBResp>
+    future_heartBeat(const meta::cpp2::HBReq& req) override;
+
+    folly::Future<meta::cpp2::ListSpacesResp>
+    future_listSpaces(const meta::cpp2::ListSpacesReq& req) override;
+
+    folly::Future<meta::cpp2::GetSpaceResp>
+    future_getSpace(const meta::cpp2::GetSpaceReq& req) override;
+
+    folly::Future<meta::cpp2::GetPartsAllocResp>
+    future_getPartsAlloc(const meta::cpp2::GetPartsAllocReq& req) override;
+
+    folly::Future<meta::cpp2::ListTagsResp>
+    future_listTags(const meta::cpp2::ListTagsReq& req) override;
+
+    folly::Future<meta::cpp2::ListEdgesResp>
+    future_listEdges(const meta::cpp2::ListEdgesReq& req) override;
+
+    folly::Future<meta::cpp2::ListTagIndexesResp>
+    future_listTagIndexes(const meta::cpp2::ListTagIndexesReq& req) override;
+
+    folly::Future<meta::cpp2::ListEdgeIndexesResp>
+    future_listEdgeIndexes(const meta::cpp2::ListEdgeIndexesReq& req) override;
+
+    folly::Future<meta::cpp2::ListUsersResp>
+    future_listUsers(const meta::cpp2::ListUsersReq& req) override;
+
+    folly::Future<meta::cpp2::ListRolesResp>
+    future_listRoles(const meta::cpp2::ListRolesReq& req) override;
+
+    folly::Future<meta::cpp2::ListRolesResp>
+    future_getUserRoles(const meta::cpp2::GetUserRolesReq& req) override;
+
+private:
+    template <typename Resp>
+    Resp succeeded() const {
+        Resp resp;
+        resp.set_code(meta::cpp2::ErrorCode::SUCCEEDED);
+        return resp;
+    }
+
+    template <typename Resp>
+    Resp notFound() const {
+        Resp resp;
+        resp.set_code(meta::cpp2::ErrorCode::E_NOT_FOUND);
+        return resp;
+    }
+
+    HostAddr                            storageAddr_;
+    int32_t                             numParts_;
+    int64_t                             lastUpdateTimeInMs_;
+    meta::cpp2::SpaceItem               space_;
+    meta::cpp2::TagItem                 personTag_;
+    meta::cpp2::EdgeItem                knowsEdge_;
+    std::vector<meta::cpp2::IndexItem>  tagIndexes_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // SERVICE_TEST_FAKEMETASERVICE_H_
@@ -0,0 +1,455 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "service/test/FakeStorageService.h"
+
+#include "common/datatypes/DataSet.h"
+#include "common/datatypes/List.h"
+#include "common/time/Duration.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+const std::vector<std::string> kPersonProps = {"name", "age"};
+const std::vector<std::string> kKnowsProps = {kSrc, kType, kRank, kDst, "since"};
+
+Value vertexProp(const SyntheticGraph::Vertex& v, const std::string& prop) {
+    if (prop == "name") {
+        return v.name;
+    }
+    if (prop == "age") {
+        return v.age;
+    }
+    if (prop == kVid) {
+        return v.vid;
+    }
+    if (prop == "_tag") {
+        return static_cast<int64_t>(SyntheticGraph::kPersonTag);
+    }
+    return Value(NullType::UNKNOWN_PROP);
+}
+
+Value edgeProp(const SyntheticGraph& graph,
+               const SyntheticGraph::Vertex& src,
+               const SyntheticGraph::Edge& edge,
+               EdgeType type,
+               const std::string& prop) {
+    if (prop == kDst) {
+        return graph.vertex(edge.other).vid;
+    }
+    if (prop == "since") {
+        return edge.since;
+    }
+    if (prop == kRank) {
+        return edge.rank;
+    }
+    if (prop == kSrc) {
+        return src.vid;
+    }
+    if (prop == kType) {
+        return static_cast<int64_t>(type);
+    }
+    return Value(NullType::UNKNOWN_PROP);
+}
+
+const std::vector<std::string>& propsOrAll(const std::vector<std::string>& props,
+                                           const std::vector<std::string>& all) {
+    return props.empty() ? all : props;
+}
+
+// For a reverse edge, its src is the vertex itself and its dst is the other end
+const std::vector<SyntheticGraph::Edge>& edgesOf(const SyntheticGraph::Vertex& v,
+                                                 EdgeType type) {
+    return type > 0 ? v.outEdges : v.inEdges;
+}
+
+storage::cpp2::ResponseCommon succeeded(const time::Duration& duration) {
+    storage::cpp2::ResponseCommon result;
+    result.set_latency_in_us(duration.elapsedInUSec());
+    return result;
+}
+
+template <typename Parts>
+storage::cpp2::ResponseCommon spaceNotFound(const Parts& parts) {
+    storage::cpp2::ResponseCommon result;
+    std::vector<storage::cpp2::PartitionResult> failedParts;
+    for (const auto& part : parts) {
+        storage::cpp2::PartitionResult partResult;
+        partResult.set_code(storage::cpp2::ErrorCode::E_SPACE_NOT_FOUND);
+        partResult.set_part_id(part.first);
+        failedParts.emplace_back(std::move(partResult));
+    }
+    result.set_failed_parts(std::move(failedParts));
+    return result;
+}
+
+}   // namespace
+
+folly::Future<storage::cpp2::GetNeighborsResponse>
+FakeStorageService::future_getNeighbors(const storage::cpp2::GetNeighborsRequest& req) {
+    time::Duration duration;
+    storage::cpp2::GetNeighborsResponse resp;
+    if (req.get_space_id() != SyntheticGraph::kSpaceId) {
+        resp.set_result(spaceNotFound(req.get_parts()));
+        return resp;
+    }
+
+    const auto& spec = req.get_traverse_spec();
+    std::vector<EdgeType> edgeTypes = spec.get_edge_types();
+    if (edgeTypes.empty()) {
+        auto direction = spec.get_edge_direction();
+        if (direction != storage::cpp2::EdgeDirection::IN_EDGE) {
+            edgeTypes.emplace_back(SyntheticGraph::kKnowsEdge);
+        }
+        if (direction != storage::cpp2::EdgeDirection::OUT_EDGE) {
+            edgeTypes.emplace_back(-SyntheticGraph::kKnowsEdge);
+        }
+    }
+
+    DataSet ds;
+    ds.colNames = {kVid, "_stats"};
+    std::vector<const std::vector<std::string>*> tagProps;
+    if (spec.get_vertex_props() != nullptr) {
+        for (const auto& vp : *spec.get_vertex_props()) {
+            if (vp.get_tag() != SyntheticGraph::kPersonTag) {
+                continue;
+            }
+            auto& props = propsOrAll(vp.get_props(), kPersonProps);
+            ds.colNames.emplace_back(folly::stringPrintf("_tag:%s:%s",
+                                                         SyntheticGraph::kPersonTagName,
+                                                         folly::join(":", props).c_str()));
+            tagProps.emplace_back(&props);
+        }
+    }
+    std::vector<std::pair<EdgeType, const std::vector<std::string>*>> edgeProps;
+    if (spec.get_edge_props() != nullptr) {
+        for (const auto& ep : *spec.get_edge_props()) {
+            edgeProps.emplace_back(ep.get_type(), &propsOrAll(ep.get_props(), kKnowsProps));
+        }
+    } else {
+        for (auto type : edgeTypes) {
+            edgeProps.emplace_back(type, &kKnowsProps);
+        }
+    }
+    for (const auto& ep : edgeProps) {
+        ds.colNames.emplace_back(folly::stringPrintf("_edge:%c%s:%s",
+                                                     ep.first > 0 ? '+' : '-',
+                                                     SyntheticGraph::kKnowsEdgeName,
+                                                     folly::join(":", *ep.second).c_str()));
+    }
+    ds.colNames.emplace_back("_expr");
+
+    auto limit = spec.get_limit() == nullptr ? std::numeric_limits<int64_t>::max()
+                                             : *spec.get_limit();
+    for (const auto& part : req.get_parts()) {
+        for (const auto& input : part.second) {
+            if (input.values.empty() || !input.values[0].isStr()) {
+                continue;
+            }
+            const auto* v = graph_->findVertex(input.values[0].getStr());
+            if (v == nullptr) {
+                continue;
+            }
+            Row row;
+            row.values.reserve(ds.colNames.size());
+            row.values.emplace_back(v->vid);
+            row.values.emplace_back(Value());
+            for (const auto* props : tagProps) {
+                List values;
+                values.values.reserve(props->size());
+                for (const auto& prop : *props) {
+                    values.values.emplace_back(vertexProp(*v, prop));
+                }
+                row.values.emplace_back(std::move(values));
+            }
+            int64_t count = 0;
+            for (const auto& ep : edgeProps) {
+                if (std::abs(ep.first) != SyntheticGraph::kKnowsEdge || count >= limit) {
+                    row.values.emplace_back(Value());
+                    continue;
+                }
+                List edges;
+                for (const auto& edge : edgesOf(*v, ep.first)) {
+                    if (count++ >= limit) {
+                        break;
+                    }
+                    List values;
+                    values.values.reserve(ep.second->size());
+                    for (const auto& prop : *ep.second) {
+                        values.values.emplace_back(edgeProp(*graph_, *v, edge, ep.first, prop));
+                    }
+                    edges.values.emplace_back(std::move(values));
+                }
+                if (edges.values.empty()) {
+                    row.values.emplace_back(Value());
+                } else {
+                    row.values.emplace_back(std::move(edges));
+                }
+            }
+            row.values.emplace_back(Value());
+            ds.rows.emplace_back(std::move(row));
+        }
+    }
+
+    resp.set_vertices(std::move(ds));
+    resp.set_result(succeeded(duration));
+    return resp;
+}
+
+folly::Future<storage::cpp2::GetPropResponse>
+FakeStorageService::future_getProps(const storage::cpp2::GetPropRequest& req) {
+    time::Duration duration;
+    storage::cpp2::GetPropResponse resp;
+    if (req.get_space_id() != SyntheticGraph::kSpaceId) {
+        resp.set_result(spaceNotFound(req.get_parts()));
+        return resp;
+    }
+    if (req.get_edge_props() != nullptr) {
+        resp.set_props(getEdgeProps(req));
+    } else {
+        resp.set_props(getVertexProps(req));
+    }
+    resp.set_result(succeeded(duration));
+    return resp;
+}
+
+DataSet FakeStorageService::getVertexProps(const storage::cpp2::GetPropRequest& req) const {
+    DataSet ds;
+    ds.colNames = {kVid};
+    std::vector<const std::vector<std::string>*> tagProps;
+    if (req.get_vertex_props() == nullptr || req.get_vertex_props()->empty()) {
+        tagProps.emplace_back(&kPersonProps);
+    } else {
+        for (const auto& vp : *req.get_vertex_props()) {
+            if (vp.get_tag() == SyntheticGraph::kPersonTag) {
+                tagProps.emplace_back(&propsOrAll(vp.get_props(), kPersonProps));
+            }
+        }
+    }
+    for (const auto* props : tagProps) {
+        for (const auto& prop : *props) {
+            ds.colNames.emplace_back(
+                folly::stringPrintf("%s.%s", SyntheticGraph::kPersonTagName, prop.c_str()));
+        }
+    }
+
+    for (const auto& part : req.get_parts()) {
+        for (const auto& input : part.second) {
+            if (input.values.empty() || !input.values[0].isStr()) {
+                continue;
+            }
+            const auto* v = graph_->findVertex(input.values[0].getStr());
+            if (v == nullptr) {
+                continue;
+            }
+            Row row;
+            row.values.reserve(ds.colNames.size());
+            row.values.emplace_back(v->vid);
+            for (const auto* props : tagProps) {
+                for (const auto& prop : *props) {
+                    row.values.emplace_back(vertexProp(*v, prop));
+                }
+            }
+            ds.rows.emplace_back(std::move(row));
+        }
+    }
+    return ds;
+}
+
+DataSet FakeStorageService::getEdgeProps(const storage::cpp2::GetPropRequest& req) const {
+    DataSet ds;
+    std::vector<std::pair<EdgeType, const std::vector<std::string>*>> edgeProps;
+    for (const auto& ep : *req.get_edge_props()) {
+        if (std::abs(ep.get_type()) != SyntheticGraph::kKnowsEdge) {
+            continue;
+        }
+        auto& props = propsOrAll(ep.get_props(), kKnowsProps);
+        for (const auto& prop : props) {
+            ds.colNames.emplace_back(
+                folly::stringPrintf("%s.%s", SyntheticGraph::kKnowsEdgeName, prop.c_str()));
+        }
+        edgeProps.emplace_back(ep.get_type(), &props);
+    }
+
+    // The input rows are (src, type, rank, dst)
+    for (const auto& part : req.get_parts()) {
+        for (const auto& input : part.second) {
+            if (input.values.size() != 4 || !input.values[0].isStr() ||
+                !input.values[1].isInt() || !input.values[2].isInt() ||
+                !input.values[3].isStr()) {
+                continue;
+            }
+            const auto* src = graph_->findVertex(input.values[0].getStr());
+            auto type = static_cast<EdgeType>(input.values[1].getInt());
+            auto rank = input.values[2].getInt();
+            const auto& dst = input.values[3].getStr();
+            if (src == nullptr || std::abs(type) != SyntheticGraph::kKnowsEdge) {
+                continue;
+            }
+            for (const auto& edge : edgesOf(*src, type)) {
+                if (edge.rank != rank || graph_->vertex(edge.other).vid != dst) {
+                    continue;
+                }
+                Row row;
+                row.values.reserve(ds.colNames.size());
+                for (const auto& ep : edgeProps) {
+                    for (const auto& prop : *ep.second) {
+                        row.values.emplace_back(edgeProp(*graph_, *src, edge, type, prop));
+                    }
+                }
+                ds.rows.emplace_back(std::move(row));
+                break;
+            }
+        }
+    }
+    return ds;
+}
+
+folly::Future<storage::cpp2::LookupIndexResp>
+FakeStorageService::future_lookupIndex(const storage::cpp2::LookupIndexRequest& req) {
+    time::Duration duration;
+    storage::cpp2::LookupIndexResp resp;
+    if (req.get_space_id() != SyntheticGraph::kSpaceId) {
+        storage::cpp2::ResponseCommon result;
+        std::vector<storage::cpp2::PartitionResult> failedParts;
+        for (auto part : req.get_parts()) {
+            storage::cpp2::PartitionResult partResult;
+            partResult.set_code(storage::cpp2::ErrorCode::E_SPACE_NOT_FOUND);
+            partResult.set_part_id(part);
+            failedParts.emplace_back(std::move(partResult));
+        }
+        result.set_failed_parts(std::move(failedParts));
+        resp.set_result(std::move(result));
+        return resp;
+    }
+
+    DataSet ds;
+    ds.colNames = {kVid};
+    std::vector<std::string> returnCols;
+    if (req.get_return_columns() != nullptr) {
+        returnCols = *req.get_return_columns();
+    }
+    for (const auto& col : returnCols) {
+        ds.colNames.emplace_back(
+            folly::stringPrintf("%s.%s", SyntheticGraph::kPersonTagName, col.c_str()));
+    }
+
+    const auto& spec = req.get_indices();
+    if (!spec.get_is_edge() && spec.get_tag_or_edge_id() == SyntheticGraph::kPersonTag) {
+        std::unordered_set<size_t> hit;
+        for (const auto& ctx : spec.get_contexts()) {
+            for (auto idx : scanIndex(ctx)) {
+                if (!hit.emplace(idx).second) {
+                    continue;
+                }
+                const auto& v = graph_->vertex(idx);
+                Row row;
+                row.values.reserve(ds.colNames.size());
+                row.values.emplace_back(v.vid);
+                for (const auto& col : returnCols) {
+                    row.values.emplace_back(vertexProp(v, col));
+                }
+                ds.rows.emplace_back(std::move(row));
+            }
+        }
+    }
+
+    resp.set_data(std::move(ds));
+    resp.set_result(succeeded(duration));
+    return resp;
+}
+
+folly::Future<storage::cpp2::ScanVertexResponse>
+FakeStorageService::future_scanVertex(const storage::cpp2::ScanVertexRequest& req) {
+    time::Duration duration;
+    storage::cpp2::ScanVertexResponse resp;
+    auto part = req.get_part_id();
+    if (req.get_space_id() != SyntheticGraph::kSpaceId || part < 1 || part > numParts_) {
+        storage::cpp2::ResponseCommon result;
+        storage::cpp2::PartitionResult partResult;
+        partResult.set_code(req.get_space_id() != SyntheticGraph::kSpaceId
+                                ? storage::cpp2::ErrorCode::E_SPACE_NOT_FOUND
+                                : storage::cpp2::ErrorCode::E_PART_NOT_FOUND);
+        partResult.set_part_id(part);
+        result.set_failed_parts({std::move(partResult)});
+        resp.set_result(std::move(result));
+        resp.set_has_next(false);
+        return resp;
+    }
+
+    const auto& vp = req.get_return_columns();
+    std::vector<std::string> props;
+    if (vp.get_tag() == SyntheticGraph::kPersonTag) {
+        props = propsOrAll(vp.get_props(), kPersonProps);
+    }
+    DataSet ds;
+    for (const auto& prop : props) {
+        ds.colNames.emplace_back(
+            folly::stringPrintf("%s.%s", SyntheticGraph::kPersonTagName, prop.c_str()));
+    }
+
+    // The cursor is the index of the next vertex in the partition
+    size_t idx = part - 1;
+    if (req.get_cursor() != nullptr) {
+        auto next = folly::tryTo<size_t>(*req.get_cursor());
+        if (next.hasValue()) {
+            idx = next.value();
+        }
+    }
+    auto limit = req.get_limit();
+    for (; !props.empty() && idx < graph_->numVertices() &&
+           static_cast<int64_t>(ds.rows.size()) < limit;
+         idx += numParts_) {
+        const auto& v = graph_->vertex(idx);
+        Row row;
+        row.values.reserve(props.size());
+        for (const auto& prop : props) {
+            row.values.emplace_back(vertexProp(v, prop));
+        }
+        ds.rows.emplace_back(std::move(row));
+    }
+
+    bool hasNext = !props.empty() && idx < graph_->numVertices();
+    resp.set_has_next(hasNext);
+    if (hasNext) {
+        resp.set_next_cursor(folly::to<std::string>(idx));
+    }
+    resp.set_vertex_data(std::move(ds));
+    resp.set_result(succeeded(duration));
+    return resp;
+}
+
+std::vector<size_t>
+FakeStorageService::scanIndex(const storage::cpp2::IndexQueryContext& ctx) const {
+    const auto& hints = ctx.get_column_hints();
+    if (hints.empty()) {
+        std::vector<size_t> all(graph_->numVertices());
+        std::iota(all.begin(), all.end(), 0);
+        return all;
+    }
+    // The indexes of the SyntheticGraph have only one field
+    const auto& hint = hints.front();
+    const auto& begin = hint.begin_value;
+    const auto& end = hint.end_value;
+    bool isPrefix = hint.get_scan_type() == storage::cpp2::ScanType::PREFIX;
+    if (hint.get_column_name() == "name" && isPrefix && begin.isStr()) {
+        return graph_->scanName(begin.getStr());
+    }
+    if (hint.get_column_name() == "age" && begin.isInt()) {
+        if (isPrefix) {
+            return graph_->scanAge(begin.getInt(), begin.getInt() + 1);
+        }
+        if (end.isInt()) {
+            return graph_->scanAge(begin.getInt(), end.getInt());
+        }
+    }
+    return {};
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,62 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef SERVICE_TEST_FAKESTORAGESERVICE_H_
+#define SERVICE_TEST_FAKESTORAGESERVICE_H_
+
+#include "common/base/Base.h"
+#include "common/interface/gen-cpp2/GraphStorageService.h"
+#include "service/test/SyntheticGraph.h"
+
+namespace nebula {
+namespace graph {
+
+/***************************************************************************
+ *
+ * A read-only storaged serving all the partitions of the SyntheticGraph.
+ *
+ * The responses have the same layout as the ones of the real storaged, but
+ * the pushed down filters, expressions and stat props are not evaluated,
+ * so run the queries without the filter push down rules to get the exact
+ * results. Mutations fail as unimplemented.
+ *
+ * The vertex of the index i is in the partition i % numParts + 1 for the
+ * scans, the other requests are served whatever the partitions are.
+ *
+ **************************************************************************/
+class FakeStorageService final : public storage::cpp2::GraphStorageServiceSvIf {
+public:
+    FakeStorageService(const SyntheticGraph* graph, int32_t numParts)
+        : graph_(graph), numParts_(numParts) {}
+
+    folly::Future<storage::cpp2::GetNeighborsResponse>
+    future_getNeighbors(const storage::cpp2::GetNeighborsRequest& req) override;
+
+    folly::Future<storage::cpp2::GetPropResponse>
+    future_getProps(const storage::cpp2::GetPropRequest& req) override;
+
+    folly::Future<storage::cpp2::LookupIndexResp>
+    future_lookupIndex(const storage::cpp2::LookupIndexRequest& req) override;
+
+    folly::Future<storage::cpp2::ScanVertexResponse>
+    future_scanVertex(const storage::cpp2::ScanVertexRequest& req) override;
+
+private:
+    DataSet getVertexProps(const storage::cpp2::GetPropRequest& req) const;
+
+    DataSet getEdgeProps(const storage::cpp2::GetPropRequest& req) const;
+
+    // Indices of the vertices hit by the index query context
+    std::vector<size_t> scanIndex(const storage::cpp2::IndexQueryContext& ctx) const;
+
+    const SyntheticGraph*           graph_{nullptr};
+    int32_t                         numParts_{1};
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // SERVICE_TEST_FAKESTORAGESERVICE_H_
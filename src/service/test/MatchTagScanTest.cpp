@@ -0,0 +1,213 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "common/base/Base.h"
+
+#include <folly/executors/CPUThreadPoolExecutor.h>
+#include <folly/executors/IOThreadPoolExecutor.h>
+#include <folly/init/Init.h>
+#include <gtest/gtest.h>
+#include <thrift/lib/cpp2/util/ScopedServerInterfaceThread.h>
+
+#include "service/GraphFlags.h"
+#include "service/QueryEngine.h"
+#include "service/test/FakeMetaService.h"
+#include "service/test/FakeStorageService.h"
+#include "service/test/SyntheticGraph.h"
+
+namespace nebula {
+namespace graph {
+
+// MATCH (v:person) is planned as the tag scan, since there is no filter for
+// the index seek, and served by the fake storaged from the synthetic graph.
+class MatchTagScanTest : public ::testing::Test {
+protected:
+    static constexpr size_t kVertices = 50;
+    static constexpr int32_t kParts = 4;
+
+    static void SetUpTestCase() {
+        SyntheticGraph::Options options;
+        options.numVertices = kVertices;
+        options.avgDegree = 2;
+        graph_ = new SyntheticGraph(options);
+
+        storageServer_ = new apache::thrift::ScopedServerInterfaceThread(
+            std::make_shared<FakeStorageService>(graph_, kParts), "127.0.0.1", 0);
+        HostAddr storageAddr("127.0.0.1", storageServer_->getPort());
+        metaServer_ = new apache::thrift::ScopedServerInterfaceThread(
+            std::make_shared<FakeMetaService>(storageAddr, kParts), "127.0.0.1", 0);
+        FLAGS_meta_server_addrs = folly::stringPrintf("127.0.0.1:%d", metaServer_->getPort());
+        FLAGS_local_config = true;
+
+        workers_ = new folly::CPUThreadPoolExecutor(2);
+        engine_ = new QueryEngine();
+        auto status = engine_->init(std::make_shared<folly::IOThreadPoolExecutor>(2));
+        ASSERT_TRUE(status.ok()) << status;
+    }
+
+    static void TearDownTestCase() {
+        delete engine_;
+        delete workers_;
+        delete metaServer_;
+        delete storageServer_;
+        delete graph_;
+    }
+
+    void SetUp() override {
+        concurrency_ = FLAGS_scan_parts_concurrency;
+        batchSize_ = FLAGS_scan_batch_size;
+        session_ = Session::create(1);
+        session_->setAccount("root");
+        auto resp = execute(folly::stringPrintf("USE %s", SyntheticGraph::kSpaceName));
+        ASSERT_EQ(cpp2::ErrorCode::SUCCEEDED, resp.get_error_code());
+    }
+
+    void TearDown() override {
+        FLAGS_scan_parts_concurrency = concurrency_;
+        FLAGS_scan_batch_size = batchSize_;
+    }
+
+    cpp2::ExecutionResponse execute(std::string query) {
+        auto ctx = std::make_unique<RequestContext<cpp2::ExecutionResponse>>();
+        ctx->setQuery(std::move(query));
+        ctx->setRunner(workers_);
+        ctx->setSession(session_);
+        auto future = ctx->future();
+        engine_->execute(std::move(ctx));
+        return std::move(future).get();
+    }
+
+    // The names returned by the query, sorted
+    std::vector<std::string> names(std::string query) {
+        auto resp = execute(query);
+        EXPECT_EQ(cpp2::ErrorCode::SUCCEEDED, resp.get_error_code())
+            << query << ": " << (resp.get_error_msg() == nullptr ? "" : *resp.get_error_msg());
+        std::vector<std::string> result;
+        if (resp.get_data() == nullptr) {
+            return result;
+        }
+        for (auto& row : resp.get_data()->rows) {
+            result.emplace_back(row.values.front().getStr());
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    // The description of the only ScanVertices of the plan explained
+    std::unordered_map<std::string, std::string> explainScan(const std::string& query) {
+        auto resp = execute("EXPLAIN " + query);
+        EXPECT_EQ(cpp2::ErrorCode::SUCCEEDED, resp.get_error_code()) << query;
+        std::unordered_map<std::string, std::string> desc;
+        if (resp.get_plan_desc() == nullptr) {
+            return desc;
+        }
+        for (auto& node : resp.get_plan_desc()->get_plan_node_descs()) {
+            if (node.get_name() != "ScanVertices") {
+                continue;
+            }
+            EXPECT_TRUE(desc.empty()) << query;
+            if (node.get_description() != nullptr) {
+                for (auto& pair : *node.get_description()) {
+                    desc.emplace(pair.get_key(), pair.get_value());
+                }
+            }
+        }
+        EXPECT_FALSE(desc.empty()) << query;
+        return desc;
+    }
+
+    static std::vector<std::string> allNames() {
+        std::vector<std::string> result;
+        for (size_t i = 0; i < graph_->numVertices(); ++i) {
+            result.emplace_back(graph_->vertex(i).name);
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    static SyntheticGraph*                                  graph_;
+    static apache::thrift::ScopedServerInterfaceThread*     storageServer_;
+    static apache::thrift::ScopedServerInterfaceThread*     metaServer_;
+    static folly::CPUThreadPoolExecutor*                    workers_;
+    static QueryEngine*                                     engine_;
+
+    std::shared_ptr<Session>                                session_;
+    int32_t                                                 concurrency_;
+    int64_t                                                 batchSize_;
+};
+
+SyntheticGraph* MatchTagScanTest::graph_ = nullptr;
+apache::thrift::ScopedServerInterfaceThread* MatchTagScanTest::storageServer_ = nullptr;
+apache::thrift::ScopedServerInterfaceThread* MatchTagScanTest::metaServer_ = nullptr;
+folly::CPUThreadPoolExecutor* MatchTagScanTest::workers_ = nullptr;
+QueryEngine* MatchTagScanTest::engine_ = nullptr;
+
+TEST_F(MatchTagScanTest, ScanAll) {
+    // Each partition is scanned in several batches through the cursor
+    FLAGS_scan_batch_size = 3;
+    for (auto concurrency : {1, 2, kParts, 2 * kParts}) {
+        FLAGS_scan_parts_concurrency = concurrency;
+        EXPECT_EQ(allNames(), names("MATCH (v:person) RETURN v.name AS name"))
+            << "concurrency " << concurrency;
+    }
+}
+
+TEST_F(MatchTagScanTest, Limit) {
+    FLAGS_scan_batch_size = 3;
+    FLAGS_scan_parts_concurrency = 2;
+    auto all = allNames();
+    {
+        auto result = names("MATCH (v:person) RETURN v.name AS name LIMIT 5");
+        ASSERT_EQ(5, result.size());
+        for (auto& name : result) {
+            EXPECT_TRUE(std::binary_search(all.begin(), all.end(), name)) << name;
+        }
+        // No duplicates across the partitions
+        EXPECT_EQ(result.end(), std::unique(result.begin(), result.end()));
+    }
+    {
+        auto result = names("MATCH (v:person) RETURN v.name AS name SKIP 3 LIMIT 5");
+        EXPECT_EQ(5, result.size());
+    }
+    {
+        // Fewer than the limit
+        auto result = names("MATCH (v:person) RETURN v.name AS name LIMIT 1000");
+        EXPECT_EQ(all, result);
+    }
+}
+
+TEST_F(MatchTagScanTest, Plan) {
+    constexpr auto kMax = std::numeric_limits<int64_t>::max();
+    {
+        // SKIP + LIMIT is pushed into the scan
+        auto desc = explainScan("MATCH (v:person) RETURN v.name AS name SKIP 3 LIMIT 5");
+        EXPECT_EQ("8", desc["limit"]);
+    }
+    {
+        auto desc = explainScan("MATCH (v:person) RETURN v.name AS name");
+        EXPECT_EQ(folly::to<std::string>(kMax), desc["limit"]);
+    }
+    {
+        // Not each of the scanned vertices is a row of the result
+        auto desc = explainScan("MATCH (v:person) RETURN DISTINCT v.age AS age LIMIT 5");
+        EXPECT_EQ(folly::to<std::string>(kMax), desc["limit"]);
+    }
+    {
+        auto desc = explainScan("MATCH (v:person)-[e:knows]->(v2) RETURN v2.name AS name LIMIT 5");
+        EXPECT_EQ(folly::to<std::string>(kMax), desc["limit"]);
+    }
+}
+
+}   // namespace graph
+}   // namespace nebula
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    folly::init(&argc, &argv, true);
+    google::SetStderrLogging(google::INFO);
+
+    return RUN_ALL_TESTS();
+}
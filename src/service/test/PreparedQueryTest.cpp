@@ -0,0 +1,150 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "common/base/Base.h"
+
+#include <folly/executors/CPUThreadPoolExecutor.h>
+#include <folly/executors/IOThreadPoolExecutor.h>
+#include <folly/init/Init.h>
+#include <gtest/gtest.h>
+#include <thrift/lib/cpp2/util/ScopedServerInterfaceThread.h>
+
+#include "service/GraphFlags.h"
+#include "service/QueryEngine.h"
+#include "service/test/FakeMetaService.h"
+#include "service/test/FakeStorageService.h"
+#include "service/test/SyntheticGraph.h"
+
+namespace nebula {
+namespace graph {
+
+// Prepares the statements by QueryEngine and runs them against the fake
+// storaged serving the synthetic graph.
+class PreparedQueryTest : public ::testing::Test {
+protected:
+    static constexpr int32_t kParts = 4;
+
+    static void SetUpTestCase() {
+        SyntheticGraph::Options options;
+        options.numVertices = 20;
+        options.avgDegree = 2;
+        graph_ = new SyntheticGraph(options);
+
+        storageServer_ = new apache::thrift::ScopedServerInterfaceThread(
+            std::make_shared<FakeStorageService>(graph_, kParts), "127.0.0.1", 0);
+        HostAddr storageAddr("127.0.0.1", storageServer_->getPort());
+        metaServer_ = new apache::thrift::ScopedServerInterfaceThread(
+            std::make_shared<FakeMetaService>(storageAddr, kParts), "127.0.0.1", 0);
+        FLAGS_meta_server_addrs = folly::stringPrintf("127.0.0.1:%d", metaServer_->getPort());
+        FLAGS_local_config = true;
+
+        workers_ = new folly::CPUThreadPoolExecutor(2);
+        engine_ = new QueryEngine();
+        auto status = engine_->init(std::make_shared<folly::IOThreadPoolExecutor>(2));
+        ASSERT_TRUE(status.ok()) << status;
+    }
+
+    static void TearDownTestCase() {
+        delete engine_;
+        delete workers_;
+        delete metaServer_;
+        delete storageServer_;
+        delete graph_;
+    }
+
+    void SetUp() override {
+        session_ = Session::create(1);
+        session_->setAccount("root");
+        auto ctx = makeRequest(folly::stringPrintf("USE %s", SyntheticGraph::kSpaceName));
+        auto future = ctx->future();
+        engine_->execute(std::move(ctx));
+        ASSERT_EQ(cpp2::ErrorCode::SUCCEEDED, std::move(future).get().get_error_code());
+    }
+
+    std::unique_ptr<RequestContext<cpp2::ExecutionResponse>> makeRequest(std::string query) {
+        auto ctx = std::make_unique<RequestContext<cpp2::ExecutionResponse>>();
+        ctx->setQuery(std::move(query));
+        ctx->setRunner(workers_);
+        ctx->setSession(session_);
+        return ctx;
+    }
+
+    std::shared_ptr<PreparedStatement> prepare(std::string query) {
+        auto ctx = makeRequest(std::move(query));
+        auto future = ctx->future();
+        engine_->prepare(std::move(ctx));
+        auto resp = std::move(future).get();
+        EXPECT_EQ(cpp2::ErrorCode::SUCCEEDED, resp.get_error_code());
+        if (resp.get_data() == nullptr) {
+            return nullptr;
+        }
+        auto id = resp.get_data()->rows.front().values.front().getInt();
+        return session_->findPreparedStatement(id);
+    }
+
+    // The last column of the only row of the result
+    Value executePrepared(std::shared_ptr<PreparedStatement> stmt,
+                          const std::unordered_map<std::string, Value>& params) {
+        auto ctx = makeRequest(stmt->stmt());
+        auto future = ctx->future();
+        engine_->executePrepared(std::move(ctx), std::move(stmt), params);
+        auto resp = std::move(future).get();
+        EXPECT_EQ(cpp2::ErrorCode::SUCCEEDED, resp.get_error_code())
+            << (resp.get_error_msg() == nullptr ? "" : *resp.get_error_msg());
+        if (resp.get_data() == nullptr || resp.get_data()->rows.size() != 1) {
+            return Value::kNullValue;
+        }
+        return resp.get_data()->rows.front().values.back();
+    }
+
+    static SyntheticGraph*                                  graph_;
+    static apache::thrift::ScopedServerInterfaceThread*     storageServer_;
+    static apache::thrift::ScopedServerInterfaceThread*     metaServer_;
+    static folly::CPUThreadPoolExecutor*                    workers_;
+    static QueryEngine*                                     engine_;
+
+    std::shared_ptr<Session>                                session_;
+};
+
+SyntheticGraph* PreparedQueryTest::graph_ = nullptr;
+apache::thrift::ScopedServerInterfaceThread* PreparedQueryTest::storageServer_ = nullptr;
+apache::thrift::ScopedServerInterfaceThread* PreparedQueryTest::metaServer_ = nullptr;
+folly::CPUThreadPoolExecutor* PreparedQueryTest::workers_ = nullptr;
+QueryEngine* PreparedQueryTest::engine_ = nullptr;
+
+TEST_F(PreparedQueryTest, Execute) {
+    auto stmt = prepare("FETCH PROP ON person $id YIELD person.name AS name");
+    ASSERT_NE(nullptr, stmt);
+    for (size_t i = 0; i < 3; ++i) {
+        auto& vertex = graph_->vertex(i);
+        EXPECT_EQ(Value(vertex.name), executePrepared(stmt, {{"id", vertex.vid}}));
+    }
+}
+
+TEST_F(PreparedQueryTest, Running) {
+    auto stmt = prepare("FETCH PROP ON person $id YIELD person.name AS name");
+    ASSERT_NE(nullptr, stmt);
+    // As if another query is running the plan, it's planned again for this one
+    ASSERT_TRUE(stmt->acquire());
+    auto& vertex = graph_->vertex(1);
+    EXPECT_EQ(Value(vertex.name), executePrepared(stmt, {{"id", vertex.vid}}));
+    stmt->release();
+
+    // The plan of the statement is still usable
+    auto& other = graph_->vertex(2);
+    EXPECT_EQ(Value(other.name), executePrepared(stmt, {{"id", other.vid}}));
+}
+
+}   // namespace graph
+}   // namespace nebula
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    folly::init(&argc, &argv, true);
+    google::SetStderrLogging(google::INFO);
+
+    return RUN_ALL_TESTS();
+}
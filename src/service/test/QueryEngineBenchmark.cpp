@@ -0,0 +1,448 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+/***************************************************************************
+ *
+ * In-process end-to-end throughput harness of graphd.
+ *
+ * It drives QueryEngine::execute with a mix of GO / FETCH / LOOKUP / MATCH /
+ * FIND PATH queries and the MATCH scanning all the vertices of a tag. The
+ * real MetaClient and GraphStorageClient talk to the fake metad and storaged
+ * on the loopback, which serve a synthetic power-law graph from memory. So
+ * the graphd side cost of the queries is measured on a single machine,
+ * without the cost of the real storage.
+ *
+ *   query_engine_bench --bench_vertices=100000 --bench_clients=16 \
+ *                      --bench_query_mix="go:40,fetch:20,lookup:10,match:10,path:20"
+ *
+ * The scans are not in the default mix, run them alone to compare the scan
+ * concurrency and batch size, e.g.
+ *
+ *   query_engine_bench --bench_query_mix="scan:1" --bench_scan_limit=0 \
+ *                      --scan_parts_concurrency=4 --scan_batch_size=1024
+ *
+ * It reports the QPS and the latency percentiles of each kind of query, and
+ * the average heap allocations per query made by the threads of graphd, i.e.
+ * the client, worker and IO threads, excluding the fake services.
+ *
+ **************************************************************************/
+
+#include "common/base/Base.h"
+
+#include <folly/executors/CPUThreadPoolExecutor.h>
+#include <folly/executors/IOThreadPoolExecutor.h>
+#include <folly/executors/thread_factory/NamedThreadFactory.h>
+#include <folly/init/Init.h>
+#include <thrift/lib/cpp2/util/ScopedServerInterfaceThread.h>
+
+#include <random>
+
+#include "common/time/Duration.h"
+#include "service/GraphFlags.h"
+#include "service/QueryEngine.h"
+#include "service/test/FakeMetaService.h"
+#include "service/test/FakeStorageService.h"
+#include "service/test/SyntheticGraph.h"
+
+DEFINE_uint64(bench_vertices, 100000, "Number of vertices of the synthetic graph");
+DEFINE_uint64(bench_avg_degree, 10, "Average out-degree of the synthetic graph");
+DEFINE_double(bench_degree_exponent, 2.1, "Exponent of the power-law degree distribution");
+DEFINE_uint64(bench_seed, 0, "Seed to generate the graph and the queries");
+DEFINE_int32(bench_parts, 10, "Number of partitions of the space");
+DEFINE_string(bench_query_mix,
+              "go:40,fetch:20,lookup:10,match:10,path:20",
+              "Weights of the kinds of query, in go, fetch, lookup, match, path and scan");
+DEFINE_int32(bench_go_steps, 2, "Steps of the GO queries");
+DEFINE_int32(bench_path_steps, 3, "Max steps of the FIND SHORTEST PATH queries");
+DEFINE_int32(bench_scan_limit, 100, "LIMIT of the scan queries, 0 to scan all the vertices");
+DEFINE_int32(bench_clients, 16, "Number of sessions issuing queries concurrently");
+DEFINE_int32(bench_warmup_secs, 3, "Seconds to run before measuring");
+DEFINE_int32(bench_duration_secs, 30, "Seconds to measure");
+DEFINE_int32(bench_io_threads, 4, "Number of IO threads of the storage and meta clients");
+DEFINE_int32(bench_worker_threads, 8, "Number of worker threads executing the plans");
+
+namespace {
+
+// Only the allocations on the threads of graphd are counted
+thread_local bool tCountAllocs = false;
+
+constexpr size_t kNumAllocCounters = 64;
+
+struct alignas(64) AllocCounter {
+    std::atomic<uint64_t> count{0};
+};
+
+AllocCounter gAllocCounters[kNumAllocCounters];
+std::atomic<size_t> gNextAllocCounter{0};
+
+void countAlloc() {
+    if (tCountAllocs) {
+        // Spread the threads over the counters to avoid the contention
+        static thread_local size_t idx = gNextAllocCounter++ % kNumAllocCounters;
+        gAllocCounters[idx].count.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+uint64_t totalAllocs() {
+    uint64_t total = 0;
+    for (auto& counter : gAllocCounters) {
+        total += counter.count.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+}   // namespace
+
+void* operator new(size_t size) {
+    countAlloc();
+    auto* p = std::malloc(size);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void* operator new[](size_t size) {
+    countAlloc();
+    auto* p = std::malloc(size);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+    std::free(p);
+}
+
+namespace nebula {
+namespace graph {
+namespace {
+
+enum class QueryKind : uint8_t {
+    kGo = 0,
+    kFetch,
+    kLookup,
+    kMatch,
+    kPath,
+    kScan,
+    kMax,
+};
+
+constexpr size_t kNumQueryKinds = static_cast<size_t>(QueryKind::kMax);
+
+const char* kQueryKindNames[kNumQueryKinds] = {"go", "fetch", "lookup", "match", "path", "scan"};
+
+class CountingThreadFactory final : public folly::NamedThreadFactory {
+public:
+    using folly::NamedThreadFactory::NamedThreadFactory;
+
+    std::thread newThread(folly::Func&& func) override {
+        return folly::NamedThreadFactory::newThread([func = std::move(func)]() mutable {
+            tCountAllocs = true;
+            func();
+        });
+    }
+};
+
+StatusOr<std::vector<double>> parseQueryMix(const std::string& mix) {
+    std::vector<double> weights(kNumQueryKinds, 0.0);
+    std::vector<folly::StringPiece> items;
+    folly::split(",", mix, items, true);
+    for (auto item : items) {
+        folly::StringPiece name, weight;
+        if (!folly::split(":", item, name, weight)) {
+            return Status::Error("Bad query mix item: %s", item.str().c_str());
+        }
+        auto found = std::find(kQueryKindNames, kQueryKindNames + kNumQueryKinds, name.str());
+        if (found == kQueryKindNames + kNumQueryKinds) {
+            return Status::Error("Unknown kind of query: %s", name.str().c_str());
+        }
+        auto value = folly::tryTo<double>(weight);
+        if (!value.hasValue() || value.value() < 0) {
+            return Status::Error("Bad weight of query: %s", item.str().c_str());
+        }
+        weights[found - kQueryKindNames] = value.value();
+    }
+    if (std::all_of(weights.begin(), weights.end(), [](auto w) { return w == 0.0; })) {
+        return Status::Error("Empty query mix: %s", mix.c_str());
+    }
+    return weights;
+}
+
+class QueryGenerator final {
+public:
+    QueryGenerator(const SyntheticGraph* graph, uint64_t seed)
+        : graph_(graph), rng_(seed), vertexDist_(0, graph->numVertices() - 1) {}
+
+    std::string make(QueryKind kind) {
+        switch (kind) {
+            case QueryKind::kGo:
+                return folly::stringPrintf(
+                    "GO %d STEPS FROM \"%s\" OVER knows "
+                    "YIELD knows._dst AS dst, knows.since AS since",
+                    FLAGS_bench_go_steps,
+                    randomVid().c_str());
+            case QueryKind::kFetch:
+                return folly::stringPrintf("FETCH PROP ON person \"%s\", \"%s\", \"%s\"",
+                                           randomVid().c_str(),
+                                           randomVid().c_str(),
+                                           randomVid().c_str());
+            case QueryKind::kLookup:
+                return folly::stringPrintf(
+                    "LOOKUP ON person WHERE person.age == %ld YIELD person.name AS name",
+                    randomAge());
+            case QueryKind::kMatch:
+                return folly::stringPrintf(
+                    "MATCH (v:person {name: \"%s\"})-[e:knows]->(v2) "
+                    "RETURN v2.name AS name, v2.age AS age",
+                    graph_->vertex(vertexDist_(rng_)).name.c_str());
+            case QueryKind::kPath:
+                return folly::stringPrintf(
+                    "FIND SHORTEST PATH FROM \"%s\" TO \"%s\" OVER knows UPTO %d STEPS",
+                    randomVid().c_str(),
+                    randomVid().c_str(),
+                    FLAGS_bench_path_steps);
+            case QueryKind::kScan:
+                if (FLAGS_bench_scan_limit <= 0) {
+                    return "MATCH (v:person) RETURN v.name AS name";
+                }
+                return folly::stringPrintf("MATCH (v:person) RETURN v.name AS name LIMIT %d",
+                                           FLAGS_bench_scan_limit);
+            case QueryKind::kMax:
+                break;
+        }
+        LOG(FATAL) << "Unknown kind of query " << static_cast<int32_t>(kind);
+        return "";
+    }
+
+    std::mt19937_64& rng() {
+        return rng_;
+    }
+
+private:
+    const std::string& randomVid() {
+        return graph_->vertex(vertexDist_(rng_)).vid;
+    }
+
+    int64_t randomAge() {
+        return std::uniform_int_distribution<int64_t>(SyntheticGraph::kMinAge,
+                                                       SyntheticGraph::kMaxAge - 1)(rng_);
+    }
+
+    const SyntheticGraph*                       graph_{nullptr};
+    std::mt19937_64                             rng_;
+    std::uniform_int_distribution<size_t>       vertexDist_;
+};
+
+struct ClientStats {
+    std::vector<std::vector<int64_t>> latencies{kNumQueryKinds};
+    std::vector<int64_t> errors = std::vector<int64_t>(kNumQueryKinds, 0);
+};
+
+cpp2::ExecutionResponse execute(QueryEngine* engine,
+                                folly::Executor* runner,
+                                std::shared_ptr<Session> session,
+                                std::string query) {
+    auto ctx = std::make_unique<RequestContext<cpp2::ExecutionResponse>>();
+    ctx->setQuery(std::move(query));
+    ctx->setRunner(runner);
+    ctx->setSession(std::move(session));
+    auto future = ctx->future();
+    engine->execute(std::move(ctx));
+    return std::move(future).get();
+}
+
+void runClient(int64_t sessionId,
+               QueryEngine* engine,
+               folly::Executor* runner,
+               const SyntheticGraph* graph,
+               const std::vector<double>* weights,
+               const std::atomic<bool>* measuring,
+               const std::atomic<bool>* stopped,
+               ClientStats* stats) {
+    tCountAllocs = true;
+    auto session = Session::create(sessionId);
+    session->setAccount("root");
+    auto resp = execute(engine,
+                        runner,
+                        session,
+                        folly::stringPrintf("USE %s", SyntheticGraph::kSpaceName));
+    if (resp.get_error_code() != cpp2::ErrorCode::SUCCEEDED) {
+        LOG(FATAL) << "Failed to use space " << SyntheticGraph::kSpaceName << ": "
+                   << (resp.get_error_msg() == nullptr ? "" : *resp.get_error_msg());
+    }
+
+    QueryGenerator generator(graph, FLAGS_bench_seed + sessionId);
+    std::discrete_distribution<size_t> kindDist(weights->begin(), weights->end());
+    while (!stopped->load(std::memory_order_relaxed)) {
+        auto kind = kindDist(generator.rng());
+        auto query = generator.make(static_cast<QueryKind>(kind));
+        time::Duration duration;
+        resp = execute(engine, runner, session, query);
+        auto latency = duration.elapsedInUSec();
+        if (!measuring->load(std::memory_order_relaxed)) {
+            continue;
+        }
+        if (resp.get_error_code() != cpp2::ErrorCode::SUCCEEDED) {
+            if (stats->errors[kind]++ == 0) {
+                LOG(WARNING) << "Query failed: " << query << ", "
+                             << (resp.get_error_msg() == nullptr ? "" : *resp.get_error_msg());
+            }
+            continue;
+        }
+        stats->latencies[kind].emplace_back(latency);
+    }
+}
+
+int64_t percentile(const std::vector<int64_t>& sorted, double p) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    auto idx = std::min(sorted.size() - 1, static_cast<size_t>(p * sorted.size()));
+    return sorted[idx];
+}
+
+std::string formatRow(const std::string& name,
+                      std::vector<int64_t>& latencies,
+                      int64_t errors,
+                      double seconds) {
+    std::sort(latencies.begin(), latencies.end());
+    double avg = latencies.empty()
+                     ? 0.0
+                     : std::accumulate(latencies.begin(), latencies.end(), 0.0) /
+                           latencies.size();
+    return folly::stringPrintf("%-8s %10lu %10.1f %10.0f %10ld %10ld %10ld %10ld %8ld\n",
+                               name.c_str(),
+                               latencies.size(),
+                               latencies.size() / seconds,
+                               avg,
+                               percentile(latencies, 0.5),
+                               percentile(latencies, 0.9),
+                               percentile(latencies, 0.99),
+                               percentile(latencies, 0.999),
+                               errors);
+}
+
+int run() {
+    auto weights = parseQueryMix(FLAGS_bench_query_mix);
+    if (!weights.ok()) {
+        LOG(ERROR) << weights.status();
+        return EXIT_FAILURE;
+    }
+
+    SyntheticGraph::Options options;
+    options.numVertices = FLAGS_bench_vertices;
+    options.avgDegree = FLAGS_bench_avg_degree;
+    options.exponent = FLAGS_bench_degree_exponent;
+    options.seed = FLAGS_bench_seed;
+    time::Duration genTime;
+    SyntheticGraph graph(options);
+    LOG(INFO) << "Generated " << graph.numVertices() << " vertices and " << graph.numEdges()
+              << " edges in " << genTime.elapsedInMSec() << "ms";
+
+    auto storageServer = std::make_unique<apache::thrift::ScopedServerInterfaceThread>(
+        std::make_shared<FakeStorageService>(&graph, FLAGS_bench_parts), "127.0.0.1", 0);
+    HostAddr storageAddr("127.0.0.1", storageServer->getPort());
+    auto metaServer = std::make_unique<apache::thrift::ScopedServerInterfaceThread>(
+        std::make_shared<FakeMetaService>(storageAddr, FLAGS_bench_parts), "127.0.0.1", 0);
+    FLAGS_meta_server_addrs = folly::stringPrintf("127.0.0.1:%d", metaServer->getPort());
+    FLAGS_local_config = true;
+
+    auto ioExecutor = std::make_shared<folly::IOThreadPoolExecutor>(
+        FLAGS_bench_io_threads, std::make_shared<CountingThreadFactory>("bench-io"));
+    folly::CPUThreadPoolExecutor workers(
+        FLAGS_bench_worker_threads, std::make_shared<CountingThreadFactory>("bench-worker"));
+    QueryEngine engine;
+    auto status = engine.init(ioExecutor);
+    if (!status.ok()) {
+        LOG(ERROR) << "Failed to init the query engine: " << status;
+        return EXIT_FAILURE;
+    }
+
+    std::atomic<bool> measuring{false};
+    std::atomic<bool> stopped{false};
+    std::vector<ClientStats> stats(FLAGS_bench_clients);
+    std::vector<std::thread> clients;
+    for (int32_t i = 0; i < FLAGS_bench_clients; ++i) {
+        clients.emplace_back(runClient,
+                             i + 1,
+                             &engine,
+                             &workers,
+                             &graph,
+                             &weights.value(),
+                             &measuring,
+                             &stopped,
+                             &stats[i]);
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(FLAGS_bench_warmup_secs));
+    auto allocsBefore = totalAllocs();
+    time::Duration measureTime;
+    measuring.store(true);
+    std::this_thread::sleep_for(std::chrono::seconds(FLAGS_bench_duration_secs));
+    measuring.store(false);
+    auto seconds = measureTime.elapsedInUSec() / 1000000.0;
+    auto allocs = totalAllocs() - allocsBefore;
+    stopped.store(true);
+    for (auto& client : clients) {
+        client.join();
+    }
+
+    std::vector<int64_t> total;
+    int64_t totalErrors = 0;
+    std::string report = folly::stringPrintf("%-8s %10s %10s %10s %10s %10s %10s %10s %8s\n",
+                                             "query",
+                                             "count",
+                                             "qps",
+                                             "avg(us)",
+                                             "p50(us)",
+                                             "p90(us)",
+                                             "p99(us)",
+                                             "p999(us)",
+                                             "errors");
+    for (size_t kind = 0; kind < kNumQueryKinds; ++kind) {
+        std::vector<int64_t> latencies;
+        int64_t errors = 0;
+        for (auto& s : stats) {
+            latencies.insert(latencies.end(), s.latencies[kind].begin(), s.latencies[kind].end());
+            errors += s.errors[kind];
+        }
+        if (latencies.empty() && errors == 0) {
+            continue;
+        }
+        total.insert(total.end(), latencies.begin(), latencies.end());
+        totalErrors += errors;
+        report += formatRow(kQueryKindNames[kind], latencies, errors, seconds);
+    }
+    auto numQueries = total.size() + totalErrors;
+    report += formatRow("total", total, totalErrors, seconds);
+    report += folly::stringPrintf("allocations/query: %.1f\n",
+                                  numQueries == 0 ? 0.0 : static_cast<double>(allocs) / numQueries);
+    std::cout << report;
+    return EXIT_SUCCESS;
+}
+
+}   // namespace
+}   // namespace graph
+}   // namespace nebula
+
+int main(int argc, char** argv) {
+    folly::init(&argc, &argv, true);
+    return nebula::graph::run();
+}
@@ -29,6 +29,28 @@ TEST(SessionManager, Basic) {
     ASSERT_EQ(session.get(), result.value().get());
 }
 
+TEST(SessionManager, ManySessions) {
+    auto sm = std::make_shared<SessionManager>();
+
+    std::vector<std::shared_ptr<Session>> sessions;
+    for (auto i = 0; i < 10000; ++i) {
+        sessions.emplace_back(sm->createSession());
+    }
+    for (auto i = 0u; i < sessions.size(); i += 2) {
+        ASSERT_EQ(sessions[i].get(), sm->removeSession(sessions[i]->id()).get());
+    }
+    for (auto i = 0u; i < sessions.size(); ++i) {
+        auto result = sm->findSession(sessions[i]->id());
+        if (i % 2 == 0) {
+            ASSERT_FALSE(result.ok());
+        } else {
+            ASSERT_TRUE(result.ok());
+            ASSERT_EQ(sessions[i].get(), result.value().get());
+        }
+    }
+    ASSERT_EQ(nullptr, sm->removeSession(sessions.front()->id()));
+}
+
 TEST(SessionManager, ExpiredSession) {
     FLAGS_session_idle_timeout_secs = 3;
     FLAGS_session_reclaim_interval_secs = 1;
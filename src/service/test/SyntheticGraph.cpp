@@ -0,0 +1,108 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "service/test/SyntheticGraph.h"
+
+#include <random>
+
+namespace nebula {
+namespace graph {
+
+constexpr GraphSpaceID SyntheticGraph::kSpaceId;
+constexpr TagID SyntheticGraph::kPersonTag;
+constexpr EdgeType SyntheticGraph::kKnowsEdge;
+constexpr IndexID SyntheticGraph::kNameIndex;
+constexpr IndexID SyntheticGraph::kAgeIndex;
+constexpr int32_t SyntheticGraph::kVidLength;
+constexpr int64_t SyntheticGraph::kMinAge;
+constexpr int64_t SyntheticGraph::kMaxAge;
+
+const char* SyntheticGraph::kSpaceName = "bench";
+const char* SyntheticGraph::kPersonTagName = "person";
+const char* SyntheticGraph::kKnowsEdgeName = "knows";
+
+// Chung-Lu model: the vertex of rank i gets the weight (i + 1)^(-1 / (exponent - 1)),
+// its out-degree is proportional to its weight, and the destinations are sampled
+// with the probability proportional to their weights, so both the out-degrees
+// and the in-degrees follow the power law.
+SyntheticGraph::SyntheticGraph(const Options& options) {
+    CHECK_GT(options.numVertices, 0UL);
+    CHECK_GT(options.exponent, 1.0);
+    auto n = options.numVertices;
+    std::mt19937_64 rng(options.seed);
+
+    std::vector<double> weights(n);
+    double sum = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        weights[i] = std::pow(static_cast<double>(i + 1), -1.0 / (options.exponent - 1.0));
+        sum += weights[i];
+    }
+    // Spread the hubs over the id space
+    std::vector<size_t> ranks(n);
+    std::iota(ranks.begin(), ranks.end(), 0);
+    std::shuffle(ranks.begin(), ranks.end(), rng);
+
+    vertices_.resize(n);
+    vidIndex_.reserve(n);
+    nameIndex_.reserve(n);
+    std::uniform_int_distribution<int64_t> ageDist(kMinAge, kMaxAge - 1);
+    for (size_t i = 0; i < n; ++i) {
+        auto& v = vertices_[i];
+        v.vid = folly::stringPrintf("v%lu", i);
+        v.name = folly::stringPrintf("name%lu", i);
+        v.age = ageDist(rng);
+        vidIndex_.emplace(v.vid, i);
+        nameIndex_.emplace(v.name, i);
+        ageIndex_.emplace(v.age, i);
+    }
+
+    std::discrete_distribution<size_t> dstDist(weights.begin(), weights.end());
+    std::uniform_int_distribution<int64_t> sinceDist(1990, 2020);
+    auto totalEdges = static_cast<double>(n * options.avgDegree);
+    for (size_t rank = 0; rank < n; ++rank) {
+        auto degree = static_cast<size_t>(std::llround(totalEdges * weights[rank] / sum));
+        auto src = ranks[rank];
+        auto& outEdges = vertices_[src].outEdges;
+        outEdges.reserve(degree);
+        // Parallel edges are distinguished by the rank
+        std::unordered_map<size_t, EdgeRanking> nextRanks;
+        for (size_t i = 0; i < degree; ++i) {
+            auto dst = ranks[dstDist(rng)];
+            if (dst == src) {
+                continue;
+            }
+            auto edgeRank = nextRanks[dst]++;
+            auto since = sinceDist(rng);
+            outEdges.emplace_back(Edge{dst, edgeRank, since});
+            vertices_[dst].inEdges.emplace_back(Edge{src, edgeRank, since});
+            ++numEdges_;
+        }
+    }
+}
+
+const SyntheticGraph::Vertex* SyntheticGraph::findVertex(const std::string& vid) const {
+    auto found = vidIndex_.find(vid);
+    return found == vidIndex_.end() ? nullptr : &vertices_[found->second];
+}
+
+std::vector<size_t> SyntheticGraph::scanName(const std::string& name) const {
+    auto found = nameIndex_.find(name);
+    if (found == nameIndex_.end()) {
+        return {};
+    }
+    return {found->second};
+}
+
+std::vector<size_t> SyntheticGraph::scanAge(int64_t begin, int64_t end) const {
+    std::vector<size_t> result;
+    for (auto it = ageIndex_.lower_bound(begin); it != ageIndex_.end() && it->first < end; ++it) {
+        result.emplace_back(it->second);
+    }
+    return result;
+}
+
+}   // namespace graph
+}   // namespace nebula
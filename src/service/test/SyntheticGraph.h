@@ -0,0 +1,102 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef SERVICE_TEST_SYNTHETICGRAPH_H_
+#define SERVICE_TEST_SYNTHETICGRAPH_H_
+
+#include "common/base/Base.h"
+
+namespace nebula {
+namespace graph {
+
+/***************************************************************************
+ *
+ * An in-memory graph whose out-degrees and in-degrees follow a power-law
+ * distribution, served by the fake meta and storage services.
+ *
+ *   space:  bench (vid FIXED_STRING(16))
+ *   tag:    person(name string, age int)
+ *   edge:   knows(since int)
+ *   index:  person_name_index on person(name)
+ *           person_age_index on person(age)
+ *
+ * The vertex ids are "v<n>" and the names are "name<n>", n in [0, numVertices).
+ *
+ **************************************************************************/
+class SyntheticGraph final {
+public:
+    static constexpr GraphSpaceID kSpaceId = 1;
+    static constexpr TagID kPersonTag = 2;
+    static constexpr EdgeType kKnowsEdge = 3;
+    static constexpr IndexID kNameIndex = 4;
+    static constexpr IndexID kAgeIndex = 5;
+    static constexpr int32_t kVidLength = 16;
+    static constexpr int64_t kMinAge = 18;
+    static constexpr int64_t kMaxAge = 80;
+
+    static const char* kSpaceName;
+    static const char* kPersonTagName;
+    static const char* kKnowsEdgeName;
+
+    struct Options {
+        size_t numVertices{100000};
+        // Average out-degree
+        size_t avgDegree{10};
+        // Exponent of the degree distribution, P(k) ~ k^(-exponent)
+        double exponent{2.1};
+        uint64_t seed{0};
+    };
+
+    struct Edge {
+        // Index of the other end
+        size_t other;
+        EdgeRanking rank;
+        int64_t since;
+    };
+
+    struct Vertex {
+        std::string vid;
+        std::string name;
+        int64_t age;
+        std::vector<Edge> outEdges;
+        std::vector<Edge> inEdges;
+    };
+
+    explicit SyntheticGraph(const Options& options);
+
+    size_t numVertices() const {
+        return vertices_.size();
+    }
+
+    size_t numEdges() const {
+        return numEdges_;
+    }
+
+    const Vertex& vertex(size_t idx) const {
+        return vertices_[idx];
+    }
+
+    // nullptr if not found
+    const Vertex* findVertex(const std::string& vid) const;
+
+    // Indices of the vertices with the name
+    std::vector<size_t> scanName(const std::string& name) const;
+
+    // Indices of the vertices whose age is in [begin, end)
+    std::vector<size_t> scanAge(int64_t begin, int64_t end) const;
+
+private:
+    std::vector<Vertex>                                 vertices_;
+    std::unordered_map<std::string, size_t>             vidIndex_;
+    std::unordered_map<std::string, size_t>             nameIndex_;
+    std::multimap<int64_t, size_t>                      ageIndex_;
+    size_t                                              numEdges_{0};
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // SERVICE_TEST_SYNTHETICGRAPH_H_
@@ -0,0 +1,237 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "util/GraphStats.h"
+
+#include <folly/SpinLock.h>
+
+#include "common/stats/StatsManager.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+using stats::StatsManager;
+
+// Histogram buckets of 1ms up to 1s for the storage rpcs and the whole queries,
+// the latencies beyond fall into the last bucket
+constexpr int64_t kLatencyBucketUs = 1000;
+constexpr int64_t kLatencyMinUs = 0;
+constexpr int64_t kLatencyMaxUs = 1000 * 1000;
+// Buckets of 10us up to 10ms for the executors and the phases before the
+// execution, most of which take less than 1ms. The same number of buckets.
+constexpr int64_t kFineLatencyBucketUs = 10;
+constexpr int64_t kFineLatencyMaxUs = 10 * 1000;
+// Enough for all the kinds of plan node
+constexpr size_t kMaxPlanNodeKinds = 256;
+constexpr int32_t kNotRegistered = -1;
+
+struct ExecutorStatsIndex {
+    std::atomic<int32_t> latency{kNotRegistered};
+    std::atomic<int32_t> rows{kNotRegistered};
+};
+
+std::array<ExecutorStatsIndex, kMaxPlanNodeKinds> gExecutorStats;
+folly::SpinLock gExecutorStatsLock;
+
+std::array<int32_t, static_cast<size_t>(GraphStats::StorageRpc::kMax)> gStorageRpcStats;
+std::array<int32_t, static_cast<size_t>(GraphStats::Phase::kMax)> gPhaseStats;
+struct CacheStatsIndex {
+    int32_t hits{kNotRegistered};
+    int32_t misses{kNotRegistered};
+};
+std::array<CacheStatsIndex, static_cast<size_t>(GraphStats::Cache::kMax)> gCacheStats;
+int32_t gQueueWaitStats{kNotRegistered};
+std::once_flag gInitFlag;
+
+int32_t registerLatencyHisto(const std::string& name) {
+    return StatsManager::registerHisto(name, kLatencyBucketUs, kLatencyMinUs, kLatencyMaxUs);
+}
+
+int32_t registerFineLatencyHisto(const std::string& name) {
+    return StatsManager::registerHisto(
+        name, kFineLatencyBucketUs, kLatencyMinUs, kFineLatencyMaxUs);
+}
+
+void registerStaticStats() {
+    for (size_t i = 0; i < gStorageRpcStats.size(); ++i) {
+        auto rpc = static_cast<GraphStats::StorageRpc>(i);
+        gStorageRpcStats[i] = registerLatencyHisto(
+            folly::stringPrintf("storage_%s_latency_us", GraphStats::toString(rpc)));
+    }
+    for (size_t i = 0; i < gPhaseStats.size(); ++i) {
+        auto phase = static_cast<GraphStats::Phase>(i);
+        auto name = folly::stringPrintf("query_%s_latency_us", GraphStats::toString(phase));
+        // The execution is the most of a query
+        gPhaseStats[i] = phase == GraphStats::Phase::kExecute ? registerLatencyHisto(name)
+                                                              : registerFineLatencyHisto(name);
+    }
+    gQueueWaitStats = registerLatencyHisto("worker_queue_wait_us");
+    for (size_t i = 0; i < gCacheStats.size(); ++i) {
+        auto name = GraphStats::toString(static_cast<GraphStats::Cache>(i));
+        gCacheStats[i].hits =
+            StatsManager::registerStats(folly::stringPrintf("cache_%s_hits", name));
+        gCacheStats[i].misses =
+            StatsManager::registerStats(folly::stringPrintf("cache_%s_misses", name));
+    }
+}
+
+void addValue(int32_t index, int64_t value) {
+    if (index != kNotRegistered) {
+        StatsManager::addValue(index, value);
+    }
+}
+
+}   // namespace
+
+// static
+void GraphStats::init() {
+    std::call_once(gInitFlag, registerStaticStats);
+}
+
+// static
+void GraphStats::addExecutorStats(PlanNode::Kind kind, int64_t latencyInUs, int64_t rows) {
+    auto slot = static_cast<size_t>(kind);
+    if (slot >= kMaxPlanNodeKinds) {
+        DLOG(FATAL) << "Too many kinds of plan node: " << slot;
+        return;
+    }
+    auto& index = gExecutorStats[slot];
+    if (index.latency.load(std::memory_order_acquire) == kNotRegistered) {
+        folly::SpinLockGuard g(gExecutorStatsLock);
+        if (index.latency.load(std::memory_order_relaxed) == kNotRegistered) {
+            auto name = PlanNode::toString(kind);
+            index.rows.store(StatsManager::registerStats(
+                                 folly::stringPrintf("executor_%s_rows", name)),
+                             std::memory_order_relaxed);
+            index.latency.store(
+                registerFineLatencyHisto(folly::stringPrintf("executor_%s_latency_us", name)),
+                std::memory_order_release);
+        }
+    }
+    addValue(index.latency.load(std::memory_order_relaxed), latencyInUs);
+    addValue(index.rows.load(std::memory_order_relaxed), rows);
+}
+
+// static
+void GraphStats::addStorageRpcLatency(StorageRpc rpc, int64_t latencyInUs) {
+    init();
+    addValue(gStorageRpcStats[static_cast<size_t>(rpc)], latencyInUs);
+}
+
+// static
+void GraphStats::addQueueWait(int64_t waitInUs) {
+    init();
+    addValue(gQueueWaitStats, waitInUs);
+}
+
+// static
+void GraphStats::addPhaseLatency(Phase phase, int64_t latencyInUs) {
+    init();
+    addValue(gPhaseStats[static_cast<size_t>(phase)], latencyInUs);
+}
+
+// static
+void GraphStats::addCacheLookups(Cache cache, int64_t hits, int64_t misses) {
+    init();
+    auto& index = gCacheStats[static_cast<size_t>(cache)];
+    if (hits > 0) {
+        addValue(index.hits, hits);
+    }
+    if (misses > 0) {
+        addValue(index.misses, misses);
+    }
+}
+
+// static
+const char* GraphStats::toString(Phase phase) {
+    switch (phase) {
+        case Phase::kParse:
+            return "parse";
+        case Phase::kValidate:
+            return "validate";
+        case Phase::kOptimize:
+            return "optimize";
+        case Phase::kExecute:
+            return "execute";
+        case Phase::kMax:
+            break;
+    }
+    LOG(FATAL) << "Unknown query phase " << static_cast<int32_t>(phase);
+    return nullptr;
+}
+
+// static
+const char* GraphStats::toString(StorageRpc rpc) {
+    switch (rpc) {
+        case StorageRpc::kGetNeighbors:
+            return "get_neighbors";
+        case StorageRpc::kGetProps:
+            return "get_props";
+        case StorageRpc::kLookupIndex:
+            return "lookup_index";
+        case StorageRpc::kScanVertex:
+            return "scan_vertex";
+        case StorageRpc::kAddVertices:
+            return "add_vertices";
+        case StorageRpc::kAddEdges:
+            return "add_edges";
+        case StorageRpc::kDeleteVertices:
+            return "delete_vertices";
+        case StorageRpc::kDeleteEdges:
+            return "delete_edges";
+        case StorageRpc::kUpdateVertex:
+            return "update_vertex";
+        case StorageRpc::kUpdateEdge:
+            return "update_edge";
+        case StorageRpc::kMax:
+            break;
+    }
+    LOG(FATAL) << "Unknown storage rpc " << static_cast<int32_t>(rpc);
+    return nullptr;
+}
+
+// static
+const char* GraphStats::toString(Cache cache) {
+    switch (cache) {
+        case Cache::kNeighbor:
+            return "neighbor";
+        case Cache::kVertexProp:
+            return "vertex_prop";
+        case Cache::kQueryResult:
+            return "query_result";
+        case Cache::kMax:
+            break;
+    }
+    LOG(FATAL) << "Unknown cache " << static_cast<int32_t>(cache);
+    return nullptr;
+}
+
+void QueueWaitRecorder::add(folly::Func func) {
+    auto enqueueTime = std::chrono::steady_clock::now();
+    executor_->add([enqueueTime, func = std::move(func)]() mutable {
+        auto wait = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - enqueueTime);
+        GraphStats::addQueueWait(wait.count());
+        func();
+    });
+}
+
+void QueueWaitRecorder::addWithPriority(folly::Func func, int8_t priority) {
+    auto enqueueTime = std::chrono::steady_clock::now();
+    executor_->addWithPriority(
+        [enqueueTime, func = std::move(func)]() mutable {
+            auto wait = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - enqueueTime);
+            GraphStats::addQueueWait(wait.count());
+            func();
+        },
+        priority);
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,112 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef UTIL_GRAPHSTATS_H_
+#define UTIL_GRAPHSTATS_H_
+
+#include <folly/Executor.h>
+
+#include "common/base/Base.h"
+#include "planner/PlanNode.h"
+
+namespace nebula {
+namespace graph {
+
+/***************************************************************************
+ *
+ * Metrics of graphd, registered into the stats::StatsManager and exported
+ * through the /get_stats of the web service, e.g.
+ *
+ *   /get_stats?stats=executor_GetNeighbors_latency_us.p99.60
+ *   /get_stats?stats=executor_GetNeighbors_rows.rate.60
+ *   /get_stats?stats=storage_get_neighbors_latency_us.p50.600
+ *   /get_stats?stats=worker_queue_wait_us.p99.60
+ *   /get_stats?stats=query_optimize_latency_us.avg.60
+ *   /get_stats?stats=cache_neighbor_hits.sum.60
+ *
+ * The histograms of executors are registered on the first use of each
+ * plan node kind, the others are registered in `init()'. The latencies of
+ * executors, and of parsing, validating and optimizing are in the buckets
+ * of 10us up to 10ms, the others in the buckets of 1ms up to 1s.
+ *
+ **************************************************************************/
+class GraphStats final {
+public:
+    enum class Phase : uint8_t {
+        kParse = 0,
+        kValidate,
+        kOptimize,
+        kExecute,
+        kMax,
+    };
+
+    enum class StorageRpc : uint8_t {
+        kGetNeighbors = 0,
+        kGetProps,
+        kLookupIndex,
+        kScanVertex,
+        kAddVertices,
+        kAddEdges,
+        kDeleteVertices,
+        kDeleteEdges,
+        kUpdateVertex,
+        kUpdateEdge,
+        kMax,
+    };
+
+    enum class Cache : uint8_t {
+        kNeighbor = 0,
+        kVertexProp,
+        kQueryResult,
+        kMax,
+    };
+
+    static void init();
+
+    // Latency of the whole executor from open to close, and its output rows
+    static void addExecutorStats(PlanNode::Kind kind, int64_t latencyInUs, int64_t rows);
+
+    static void addStorageRpcLatency(StorageRpc rpc, int64_t latencyInUs);
+
+    static void addQueueWait(int64_t waitInUs);
+
+    static void addPhaseLatency(Phase phase, int64_t latencyInUs);
+
+    // The hit rate is hits.sum / (hits.sum + misses.sum) of the same period
+    static void addCacheLookups(Cache cache, int64_t hits, int64_t misses);
+
+    static const char* toString(Phase phase);
+
+    static const char* toString(StorageRpc rpc);
+
+    static const char* toString(Cache cache);
+
+private:
+    GraphStats() = delete;
+};
+
+// Delegates the tasks to the worker thread pool and records how long each
+// task waits in the queue before it's picked up by a worker.
+class QueueWaitRecorder final : public folly::Executor {
+public:
+    explicit QueueWaitRecorder(folly::Executor* executor) : executor_(executor) {}
+
+    void add(folly::Func func) override;
+
+    void addWithPriority(folly::Func func, int8_t priority) override;
+
+    uint8_t getNumPriorities() const override {
+        return executor_->getNumPriorities();
+    }
+
+private:
+    folly::Executor*            executor_{nullptr};
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // UTIL_GRAPHSTATS_H_
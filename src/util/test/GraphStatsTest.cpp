@@ -0,0 +1,80 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "util/GraphStats.h"
+
+#include <folly/executors/InlineExecutor.h>
+#include <gtest/gtest.h>
+
+#include "common/stats/StatsManager.h"
+
+namespace nebula {
+namespace graph {
+
+using stats::StatsManager;
+
+TEST(GraphStatsTest, ExecutorStats) {
+    GraphStats::init();
+    GraphStats::addExecutorStats(PlanNode::Kind::kProject, 10, 3);
+    GraphStats::addExecutorStats(PlanNode::Kind::kProject, 20, 5);
+
+    auto rows = StatsManager::readValue("executor_Project_rows.sum.60");
+    ASSERT_TRUE(rows.ok()) << rows.status();
+    EXPECT_EQ(8, rows.value());
+    auto count = StatsManager::readValue("executor_Project_latency_us.count.60");
+    ASSERT_TRUE(count.ok()) << count.status();
+    EXPECT_EQ(2, count.value());
+}
+
+TEST(GraphStatsTest, StorageAndPhaseStats) {
+    GraphStats::addStorageRpcLatency(GraphStats::StorageRpc::kGetNeighbors, 100);
+    auto rpc = StatsManager::readValue("storage_get_neighbors_latency_us.count.60");
+    ASSERT_TRUE(rpc.ok()) << rpc.status();
+    EXPECT_EQ(1, rpc.value());
+
+    GraphStats::addPhaseLatency(GraphStats::Phase::kOptimize, 100);
+    auto phase = StatsManager::readValue("query_optimize_latency_us.count.60");
+    ASSERT_TRUE(phase.ok()) << phase.status();
+    EXPECT_EQ(1, phase.value());
+}
+
+TEST(GraphStatsTest, LatencyBuckets) {
+    // Half of 20us and half of 80us, the p90 is at most the end of the 80us
+    // bucket if it's 10us wide, while it's far beyond in a 1ms one
+    for (auto i = 0; i < 10; ++i) {
+        auto latency = i % 2 == 0 ? 20 : 80;
+        GraphStats::addExecutorStats(PlanNode::Kind::kFilter, latency, 1);
+        GraphStats::addPhaseLatency(GraphStats::Phase::kParse, latency);
+        GraphStats::addPhaseLatency(GraphStats::Phase::kExecute, latency);
+        GraphStats::addStorageRpcLatency(GraphStats::StorageRpc::kGetProps, latency);
+    }
+
+    for (auto* name : {"executor_Filter_latency_us.p90.60", "query_parse_latency_us.p90.60"}) {
+        auto p90 = StatsManager::readValue(name);
+        ASSERT_TRUE(p90.ok()) << p90.status();
+        EXPECT_LE(p90.value(), 90) << name;
+    }
+    for (auto* name : {"query_execute_latency_us.p90.60",
+                       "storage_get_props_latency_us.p90.60"}) {
+        auto p90 = StatsManager::readValue(name);
+        ASSERT_TRUE(p90.ok()) << p90.status();
+        EXPECT_GT(p90.value(), 100) << name;
+    }
+}
+
+TEST(GraphStatsTest, QueueWaitRecorder) {
+    QueueWaitRecorder recorder(&folly::InlineExecutor::instance());
+    bool executed = false;
+    recorder.add([&executed]() { executed = true; });
+    EXPECT_TRUE(executed);
+
+    auto wait = StatsManager::readValue("worker_queue_wait_us.count.60");
+    ASSERT_TRUE(wait.ok()) << wait.status();
+    EXPECT_EQ(1, wait.value());
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -273,6 +273,18 @@ Status ShowCollationValidator::toPlan() {
     return Status::OK();
 }
 
+Status ShowQueriesValidator::validateImpl() {
+    return Status::OK();
+}
+
+Status ShowQueriesValidator::toPlan() {
+    auto sentence = static_cast<ShowQueriesSentence *>(sentence_);
+    auto *node = ShowQueries::make(qctx_, nullptr, sentence->isSlow());
+    root_ = node;
+    tail_ = root_;
+    return Status::OK();
+}
+
 Status ShowConfigsValidator::validateImpl() {
     return Status::OK();
 }
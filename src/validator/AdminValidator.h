@@ -176,6 +176,19 @@ private:
     Status toPlan() override;
 };
 
+class ShowQueriesValidator final : public Validator {
+public:
+    ShowQueriesValidator(Sentence* sentence, QueryContext* context)
+        : Validator(sentence, context) {
+        setNoSpaceRequired();
+    }
+
+private:
+    Status validateImpl() override;
+
+    Status toPlan() override;
+};
+
 class ShowConfigsValidator final : public Validator {
 public:
     ShowConfigsValidator(Sentence* sentence, QueryContext* context)
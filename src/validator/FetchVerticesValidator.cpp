@@ -4,6 +4,7 @@
  * attached with Common Clause Condition 1.0, found in the LICENSES directory.
  */
 #include "validator/FetchVerticesValidator.h"
+#include "common/expression/VariableExpression.h"
 #include "planner/Query.h"
 #include "util/ExpressionUtils.h"
 #include "util/SchemaUtil.h"
@@ -111,6 +112,18 @@ Status FetchVerticesValidator::prepareVertices() {
     auto vids = sentence->vidList();
     srcVids_.rows.reserve(vids.size());
     for (const auto vid : vids) {
+        if (vid->kind() == Expression::Kind::kVar) {
+            if (qctx_->paramSlots() == nullptr) {
+                return Status::SemanticError(
+                    "`%s', the parameters are only allowed in the prepared statements.",
+                    vid->toString().c_str());
+            }
+            // bound at the execution
+            params_.emplace_back(static_cast<const VariableExpression *>(vid)->var(),
+                                 srcVids_.rows.size());
+            srcVids_.emplace_back(nebula::Row({Value::kNullValue}));
+            continue;
+        }
         DCHECK(ExpressionUtils::isConstExpr(vid));
         auto v = vid->eval(dummy);
         if (!SchemaUtil::isValidVid(v, space_.spaceDesc.vid_type)) {
@@ -241,6 +254,10 @@ Status FetchVerticesValidator::preparePropertiesWithoutYield() {
 std::string FetchVerticesValidator::buildConstantInput() {
     auto input = vctx_->anonVarGen()->getVar();
     qctx_->ectx()->setResult(input, ResultBuilder().value(Value(std::move(srcVids_))).finish());
+    for (auto &param : params_) {
+        qctx_->paramSlots()->add(
+            param.first, input, param.second, space_.spaceDesc.vid_type.get_type());
+    }
 
     src_ = qctx_->objPool()->makeAndAdd<VariablePropertyExpression>(new std::string(input),
                                                                     new std::string(kVid));
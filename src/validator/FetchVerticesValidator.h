@@ -39,6 +39,8 @@ private:
 
 private:
     DataSet srcVids_{{kVid}};  // src from constant
+    // the parameters of the prepared statement, and their rows in srcVids_
+    std::vector<std::pair<std::string, size_t>> params_;
     Expression* srcRef_{nullptr};  // src from runtime
     Expression* src_{nullptr};  // src in total
     bool onStar_{false};
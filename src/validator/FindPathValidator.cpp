@@ -20,11 +20,47 @@ Status FindPathValidator::validateImpl() {
     NG_RETURN_IF_ERROR(validateStarts(fpSentence->to(), to_));
     NG_RETURN_IF_ERROR(validateOver(fpSentence->over(), over_));
     NG_RETURN_IF_ERROR(validateStep(fpSentence->step(), steps_));
+    if (fpSentence->weight() != nullptr) {
+        NG_RETURN_IF_ERROR(validateWeight(*fpSentence->weight()));
+    }
+    return Status::OK();
+}
+
+Status FindPathValidator::validateWeight(const std::string& weight) {
+    if (from_.srcRef != nullptr || to_.srcRef != nullptr) {
+        return Status::SemanticError("Weighted shortest path only supports constant vids.");
+    }
+    for (auto edgeType : over_.edgeTypes) {
+        auto schema = qctx_->schemaMng()->getEdgeSchema(space_.id, edgeType);
+        if (schema == nullptr) {
+            return Status::SemanticError("No schema found for edge type `%d'.", edgeType);
+        }
+        if (schema->getFieldIndex(weight) < 0) {
+            return Status::SemanticError("Weight `%s' not found in edge type `%d'.",
+                                         weight.c_str(), edgeType);
+        }
+        switch (schema->getFieldType(weight)) {
+            case meta::cpp2::PropertyType::INT8:
+            case meta::cpp2::PropertyType::INT16:
+            case meta::cpp2::PropertyType::INT32:
+            case meta::cpp2::PropertyType::INT64:
+            case meta::cpp2::PropertyType::FLOAT:
+            case meta::cpp2::PropertyType::DOUBLE:
+                break;
+            default:
+                return Status::SemanticError("Weight `%s' must be a numeric property.",
+                                             weight.c_str());
+        }
+    }
+    weight_ = weight;
     return Status::OK();
 }
 
 Status FindPathValidator::toPlan() {
     // TODO: Implement the path plan.
+    if (!weight_.empty()) {
+        return weightedShortestPath();
+    }
     if (isShortest_ && from_.vids.size() == 1 && to_.vids.size() == 1) {
         return singlePairPlan();
     } else if (isShortest_) {
@@ -36,6 +72,33 @@ Status FindPathValidator::toPlan() {
     return Status::OK();
 }
 
+Status FindPathValidator::weightedShortestPath() {
+    std::vector<EdgeType> edgeTypes;
+    edgeTypes.reserve(over_.edgeTypes.size() * 2);
+    for (auto edgeType : over_.edgeTypes) {
+        if (over_.direction != storage::cpp2::EdgeDirection::IN_EDGE) {
+            edgeTypes.emplace_back(edgeType);
+        }
+        if (over_.direction != storage::cpp2::EdgeDirection::OUT_EDGE) {
+            edgeTypes.emplace_back(-edgeType);
+        }
+    }
+
+    auto* dijkstra = DijkstraShortestPath::make(qctx_,
+                                                nullptr,
+                                                space_.id,
+                                                from_.vids,
+                                                to_.vids,
+                                                std::move(edgeTypes),
+                                                weight_,
+                                                steps_.steps);
+    dijkstra->setColNames({"_path", "cost"});
+
+    root_ = dijkstra;
+    tail_ = root_;
+    return Status::OK();
+}
+
 Status FindPathValidator::singlePairPlan() {
     auto* bodyStart = StartNode::make(qctx_);
     auto* passThrough = PassThroughNode::make(qctx_, bodyStart);
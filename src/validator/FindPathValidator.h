@@ -48,8 +48,14 @@ private:
 
     Expression* buildAllPathsLoopCondition(uint32_t steps);
 
+    Status validateWeight(const std::string& weight);
+
+    Status weightedShortestPath();
+
 private:
     bool            isShortest_{false};
+    // The edge property as the cost, empty if unweighted
+    std::string     weight_;
     Starts          to_;
     Over            over_;
     Steps           steps_;
@@ -21,6 +21,11 @@ Status GetSubgraphValidator::validateImpl() {
     auto* gsSentence = static_cast<GetSubgraphSentence*>(sentence_);
 
     NG_RETURN_IF_ERROR(validateStep(gsSentence->step(), steps_));
+    if (steps_.distinct) {
+        // The subgraph never expands a vertex twice anyway
+        return Status::SemanticError("`%s' is not supported in GET SUBGRAPH.",
+                                     gsSentence->step()->toString().c_str());
+    }
     NG_RETURN_IF_ERROR(validateStarts(gsSentence->from(), from_));
     NG_RETURN_IF_ERROR(validateInBound(gsSentence->in()));
     NG_RETURN_IF_ERROR(validateOutBound(gsSentence->out()));
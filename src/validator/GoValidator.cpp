@@ -233,6 +233,9 @@ Status GoValidator::buildNStepsPlan() {
     VLOG(1) << gn->outputVar();
 
     PlanNode* dedupDstVids = projectDstVidsFromGN(gn, startVidsVar);
+    if (steps_.distinct) {
+        static_cast<Dedup*>(dedupDstVids)->setFrontier(true);
+    }
     PlanNode* loopBody = dedupDstVids;
 
     PlanNode* dedupSrcDstVids = nullptr;
@@ -293,6 +296,9 @@ Status GoValidator::buildMToNPlan() {
     VLOG(1) << gn->outputVar();
 
     PlanNode* dedupDstVids = projectDstVidsFromGN(gn, startVidsVar);
+    if (steps_.distinct) {
+        static_cast<Dedup*>(dedupDstVids)->setFrontier(true);
+    }
 
     PlanNode* dependencyForProjectResult = dedupDstVids;
 
@@ -12,6 +12,11 @@
 namespace nebula {
 namespace graph {
 
+static constexpr char kVertexID[] = "VertexID";
+static constexpr char kSrcVID[] = "SrcVID";
+static constexpr char kRanking[] = "Ranking";
+static constexpr char kDstVID[] = "DstVID";
+
 Status IndexScanValidator::validateImpl() {
     NG_RETURN_IF_ERROR(prepareFrom());
     NG_RETURN_IF_ERROR(prepareYield());
@@ -20,11 +25,18 @@ Status IndexScanValidator::validateImpl() {
 }
 
 Status IndexScanValidator::toPlan() {
-    return genSingleNodePlan<IndexScan>(spaceId_,
-                                        std::move(contexts_),
-                                        std::move(returnCols_),
-                                        isEdge_,
-                                        schemaId_);
+    NG_RETURN_IF_ERROR(genSingleNodePlan<IndexScan>(spaceId_,
+                                                    std::move(contexts_),
+                                                    std::move(returnCols_),
+                                                    isEdge_,
+                                                    schemaId_));
+    std::vector<std::string> colNames;
+    colNames.reserve(outputs_.size());
+    for (const auto &col : outputs_) {
+        colNames.emplace_back(col.name);
+    }
+    root_->setColNames(std::move(colNames));
+    return Status::OK();
 }
 
 Status IndexScanValidator::prepareFrom() {
@@ -43,6 +55,14 @@ Status IndexScanValidator::prepareFrom() {
 Status IndexScanValidator::prepareYield() {
     auto *sentence = static_cast<const LookupSentence *>(sentence_);
     returnCols_ = std::make_unique<std::vector<std::string>>();
+    // The vertex or the edge leads the returned columns
+    if (isEdge_) {
+        outputs_.emplace_back(kSrcVID, Value::Type::STRING);
+        outputs_.emplace_back(kRanking, Value::Type::INT);
+        outputs_.emplace_back(kDstVID, Value::Type::STRING);
+    } else {
+        outputs_.emplace_back(kVertexID, Value::Type::STRING);
+    }
     if (sentence->yieldClause() == nullptr) {
         return Status::OK();
     }
@@ -76,6 +96,7 @@ Status IndexScanValidator::prepareYield() {
                                          colName.c_str(), from->c_str());
         }
         returnCols_->emplace_back(colName);
+        outputs_.emplace_back(schemaName + "." + colName, SchemaUtil::propTypeToValueType(ret));
     }
     return Status::OK();
 }
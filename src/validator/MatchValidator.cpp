@@ -111,9 +111,15 @@ Status MatchValidator::validatePath(const MatchPath *path) {
         }
         auto *stepRange = edge->range();
         if (stepRange != nullptr) {
-            if (stepRange->min() != stepRange->max() ||
-                    stepRange->min() != 1) {
-                return Status::SemanticError("Variable steps not supported");
+            if (stepRange->min() < 0 || stepRange->max() < std::max<int64_t>(stepRange->min(), 1)) {
+                return Status::SemanticError("`%s': Invalid steps", edge->toString().c_str());
+            }
+            if (stepRange->max() == std::numeric_limits<int64_t>::max()) {
+                return Status::SemanticError("`%s': The max steps is required",
+                                             edge->toString().c_str());
+            }
+            if (stepRange->min() != 1 || stepRange->max() != 1) {
+                edgeInfos[i].range = stepRange;
             }
         }
         if (alias == nullptr) {
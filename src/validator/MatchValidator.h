@@ -34,6 +34,8 @@ public:
         std::vector<EdgeType>                   edgeTypes;
         MatchEdge::Direction                    direction{MatchEdge::Direction::OUT_EDGE};
         std::vector<std::string>                types;
+        // nullptr if it's exactly one step
+        const MatchStepRange                   *range{nullptr};
         const std::string                      *alias{nullptr};
         const MapExpression                    *props{nullptr};
         Expression                             *filter{nullptr};
@@ -47,6 +47,10 @@ Status TraversalValidator::validateStarts(const VerticesClause* clause, Starts&
         auto vidList = clause->vidList();
         QueryExpressionContext ctx;
         for (auto* expr : vidList) {
+            if (expr->kind() == Expression::Kind::kVar) {
+                NG_RETURN_IF_ERROR(validateParam(expr, starts));
+                continue;
+            }
             if (!evaluableExpr(expr)) {
                 return Status::SemanticError("`%s' is not an evaluable expression.",
                         expr->toString().c_str());
@@ -65,6 +69,23 @@ Status TraversalValidator::validateStarts(const VerticesClause* clause, Starts&
     return Status::OK();
 }
 
+Status TraversalValidator::validateParam(const Expression* expr, Starts& starts) {
+    if (qctx_->paramSlots() == nullptr) {
+        return Status::SemanticError("`%s', the parameters are only allowed in the prepared "
+                                     "statements.", expr->toString().c_str());
+    }
+    if (sentence_->kind() != Sentence::Kind::kGo) {
+        return Status::SemanticError("`%s', the parameters are only allowed in GO.",
+                                     expr->toString().c_str());
+    }
+    auto& param = static_cast<const VariableExpression*>(expr)->var();
+    starts.params.emplace_back(param, starts.vids.size());
+    // Bound at the execution
+    starts.vids.emplace_back(Value::kNullValue);
+    startVidList_->add(expr->clone().release());
+    return Status::OK();
+}
+
 Status TraversalValidator::validateOver(const OverClause* clause, Over& over) {
     if (clause == nullptr) {
         return Status::SemanticError("Over clause nullptr.");
@@ -109,6 +130,7 @@ Status TraversalValidator::validateStep(const StepClause* clause, Steps& step) {
     if (clause == nullptr) {
         return Status::SemanticError("Step clause nullptr.");
     }
+    step.distinct = clause->isDistinct();
     if (clause->isMToN()) {
         auto* mToN = qctx_->objPool()->makeAndAdd<StepClause::MToN>();
         mToN->mSteps = clause->mToN()->mSteps;
@@ -170,6 +192,10 @@ void TraversalValidator::buildConstantInput(const Starts& starts,
         ds.rows.emplace_back(std::move(row));
     }
     qctx_->ectx()->setResult(startVidsVar, ResultBuilder().value(Value(std::move(ds))).finish());
+    auto vidType = space_.spaceDesc.vid_type.get_type();
+    for (auto& param : starts.params) {
+        qctx_->paramSlots()->add(param.first, startVidsVar, param.second, vidType);
+    }
 
     vids = new VariablePropertyExpression(new std::string(startVidsVar), new std::string(kVid));
     qctx_->objPool()->add(vids);
@@ -29,6 +29,8 @@ protected:
         std::string             userDefinedVarName;
         std::string             firstBeginningSrcVidColName;
         std::vector<Value>      vids;
+        // The parameters of the prepared statement, and their rows in `vids'
+        std::vector<std::pair<std::string, size_t>>     params;
     };
 
     struct Over {
@@ -41,6 +43,8 @@ protected:
     struct Steps {
         StepClause::MToN*     mToN{nullptr};
         uint32_t              steps{1};
+        // Expand each vertex at most once
+        bool                  distinct{false};
     };
 
 protected:
@@ -50,6 +54,9 @@ protected:
 
     Status validateStarts(const VerticesClause* clause, Starts& starts);
 
+    // The start vid is a parameter of the prepared statement
+    Status validateParam(const Expression* expr, Starts& starts);
+
     Status validateOver(const OverClause* clause, Over& over);
 
     Status validateStep(const StepClause* clause, Steps& step);
@@ -159,6 +159,8 @@ std::unique_ptr<Validator> Validator::makeValidator(Sentence* sentence, QueryCon
             return std::make_unique<ShowCharsetValidator>(sentence, context);
         case Sentence::Kind::kShowCollation:
             return std::make_unique<ShowCollationValidator>(sentence, context);
+        case Sentence::Kind::kShowQueries:
+            return std::make_unique<ShowQueriesValidator>(sentence, context);
         case Sentence::Kind::kGetConfig:
             return std::make_unique<GetConfigValidator>(sentence, context);
         case Sentence::Kind::kSetConfig:
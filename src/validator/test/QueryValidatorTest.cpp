@@ -570,6 +570,38 @@ TEST_F(QueryValidatorTest, GoWithVariable) {
     }
 }
 
+TEST_F(QueryValidatorTest, GoWithParams) {
+    // Only in the prepared statements
+    EXPECT_FALSE(checkResult("GO FROM $id OVER like"));
+    EXPECT_FALSE(checkResult("FETCH PROP ON person $id"));
+
+    auto prepare = [this](const std::string& query) -> StatusOr<QueryContext*> {
+        auto result = GQLParser().parse(query);
+        NG_RETURN_IF_ERROR(result);
+        auto sentences = pool_->add(std::move(result).value().release());
+        auto qctx = buildContext();
+        qctx->setParamSlots(std::make_unique<ParamSlots>());
+        NG_RETURN_IF_ERROR(Validator::validate(sentences, qctx));
+        return qctx;
+    };
+    {
+        auto result = prepare("GO 2 STEPS FROM $id, \"1\", $id OVER like");
+        ASSERT_TRUE(result.ok()) << result.status();
+        auto& types = result.value()->paramSlots()->types();
+        ASSERT_EQ(1, types.size());
+        EXPECT_EQ(meta::cpp2::PropertyType::FIXED_STRING, types.at("id"));
+    }
+    {
+        auto result = prepare("FETCH PROP ON person $src, $dst");
+        ASSERT_TRUE(result.ok()) << result.status();
+        EXPECT_EQ(2, result.value()->paramSlots()->types().size());
+    }
+    {
+        auto result = prepare("GET SUBGRAPH FROM $id");
+        EXPECT_FALSE(result.ok());
+    }
+}
+
 TEST_F(QueryValidatorTest, GoReversely) {
     {
         std::string query = "GO FROM \"1\" OVER like REVERSELY "
@@ -1311,6 +1343,30 @@ TEST_F(QueryValidatorTest, FindPath) {
         };
         EXPECT_TRUE(checkResult(query, expected));
     }
+    // weighted
+    {
+        std::string query =
+            "FIND SHORTEST PATH FROM \"1\",\"2\" TO \"3\" OVER like WEIGHT likeness UPTO 5 STEPS";
+        std::vector<PlanNode::Kind> expected = {
+            PK::kDijkstraShortest,
+            PK::kStart,
+        };
+        EXPECT_TRUE(checkResult(query, expected, {"_path", "cost"}));
+    }
+    {
+        std::string query = "FIND SHORTEST PATH FROM \"1\" TO \"2\" OVER like WEIGHT start";
+        EXPECT_FALSE(checkResult(query));
+    }
+    {
+        std::string query = "FIND SHORTEST PATH FROM \"1\" TO \"2\" OVER like WEIGHT nonexist";
+        EXPECT_FALSE(checkResult(query));
+    }
+    {
+        std::string query =
+            "YIELD \"1\" AS src, \"2\" AS dst"
+            " | FIND SHORTEST PATH FROM $-.src TO $-.dst OVER like WEIGHT likeness";
+        EXPECT_FALSE(checkResult(query));
+    }
 
     // all
     {
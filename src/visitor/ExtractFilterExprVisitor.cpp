@@ -30,11 +30,12 @@ void ExtractFilterExprVisitor::visit(VersionedVariableExpression *) {
 }
 
 void ExtractFilterExprVisitor::visit(TagPropertyExpression *) {
-    canBePushed_ = false;
+    // Only the vertex props request reads the tag props in storage
+    canBePushed_ = pushType_ == PushType::kGetVertices;
 }
 
 void ExtractFilterExprVisitor::visit(EdgePropertyExpression *) {
-    canBePushed_ = true;
+    canBePushed_ = pushType_ == PushType::kGetNeighbors || pushType_ == PushType::kGetEdges;
 }
 
 void ExtractFilterExprVisitor::visit(InputPropertyExpression *) {
@@ -50,23 +51,23 @@ void ExtractFilterExprVisitor::visit(DestPropertyExpression *) {
 }
 
 void ExtractFilterExprVisitor::visit(SourcePropertyExpression *) {
-    canBePushed_ = true;
+    canBePushed_ = pushType_ == PushType::kGetNeighbors;
 }
 
 void ExtractFilterExprVisitor::visit(EdgeSrcIdExpression *) {
-    canBePushed_ = true;
+    visitEdgeKey();
 }
 
 void ExtractFilterExprVisitor::visit(EdgeTypeExpression *) {
-    canBePushed_ = true;
+    visitEdgeKey();
 }
 
 void ExtractFilterExprVisitor::visit(EdgeRankExpression *) {
-    canBePushed_ = true;
+    visitEdgeKey();
 }
 
 void ExtractFilterExprVisitor::visit(EdgeDstIdExpression *) {
-    canBePushed_ = true;
+    visitEdgeKey();
 }
 
 void ExtractFilterExprVisitor::visit(VertexExpression *) {
@@ -77,24 +78,49 @@ void ExtractFilterExprVisitor::visit(EdgeExpression *) {
     canBePushed_ = false;
 }
 
+void ExtractFilterExprVisitor::visitEdgeKey() {
+    canBePushed_ = pushType_ == PushType::kGetNeighbors || pushType_ == PushType::kGetEdges;
+}
+
+void ExtractFilterExprVisitor::addRemainedExpr(std::unique_ptr<Expression> expr) {
+    if (remainedExpr_ == nullptr) {
+        remainedExpr_ = std::move(expr);
+        return;
+    }
+    // Nested AND operands may leave more than one part which could not be pushed down
+    remainedExpr_ = std::make_unique<LogicalExpression>(
+        Expression::Kind::kLogicalAnd, remainedExpr_.release(), expr.release());
+}
+
+void ExtractFilterExprVisitor::visit(UnaryExpression *expr) {
+    auto splitForbidden = splitForbidden_;
+    splitForbidden_ = true;
+    ExprVisitorImpl::visit(expr);
+    splitForbidden_ = splitForbidden;
+}
+
 void ExtractFilterExprVisitor::visit(LogicalExpression *expr) {
-    if (expr->kind() == Expression::Kind::kLogicalAnd) {
+    if (expr->kind() == Expression::Kind::kLogicalAnd && !splitForbidden_) {
         expr->left()->accept(this);
         auto canBePushedLeft = canBePushed_;
+        canBePushed_ = true;
         expr->right()->accept(this);
         auto canBePushedRight = canBePushed_;
         canBePushed_ = canBePushedLeft || canBePushedRight;
         if (canBePushed_) {
             if (!canBePushedLeft) {
-                remainedExpr_ = expr->left()->clone();
+                addRemainedExpr(expr->left()->clone());
                 expr->setLeft(new ConstantExpression(true));
             } else if (!canBePushedRight) {
-                remainedExpr_ = expr->right()->clone();
+                addRemainedExpr(expr->right()->clone());
                 expr->setRight(new ConstantExpression(true));
             }
         }
     } else {
+        auto splitForbidden = splitForbidden_;
+        splitForbidden_ = true;
         ExprVisitorImpl::visit(expr);
+        splitForbidden_ = splitForbidden;
     }
 }
 
@@ -15,8 +15,30 @@ namespace graph {
 
 class ExtractFilterExprVisitor final : public ExprVisitorImpl {
 public:
+    // Which storage interface the filter will be pushed into. Each of them could
+    // only evaluate the properties it reads by itself.
+    enum class PushType : uint8_t {
+        kGetNeighbors,
+        kGetVertices,
+        kGetEdges,
+    };
+
     ExtractFilterExprVisitor() = default;
 
+    explicit ExtractFilterExprVisitor(PushType pushType) : pushType_(pushType) {}
+
+    static ExtractFilterExprVisitor makePushGetNeighbors() {
+        return ExtractFilterExprVisitor(PushType::kGetNeighbors);
+    }
+
+    static ExtractFilterExprVisitor makePushGetVertices() {
+        return ExtractFilterExprVisitor(PushType::kGetVertices);
+    }
+
+    static ExtractFilterExprVisitor makePushGetEdges() {
+        return ExtractFilterExprVisitor(PushType::kGetEdges);
+    }
+
     bool ok() const override {
         return canBePushed_;
     }
@@ -45,9 +67,18 @@ private:
     void visit(EdgeDstIdExpression *) override;
     void visit(VertexExpression *) override;
     void visit(EdgeExpression *) override;
+    void visit(UnaryExpression *) override;
     void visit(LogicalExpression *) override;
 
+    void visitEdgeKey();
+
+    void addRemainedExpr(std::unique_ptr<Expression> expr);
+
+    PushType pushType_{PushType::kGetNeighbors};
     bool canBePushed_{true};
+    // Only the operands of the outermost AND chain could be split,
+    // e.g. the A of `(A AND B) OR C' must be evaluated together with B
+    bool splitForbidden_{false};
     std::unique_ptr<Expression> remainedExpr_;
 };
 